@@ -0,0 +1,51 @@
+#include "GameEngine/Log.h"
+
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <fstream>
+
+const void* volatile Benchmark::s_Sink = nullptr;
+
+static std::vector<BenchmarkResult> s_Results;
+
+void Benchmark::Record(const std::string& name, double value, const std::string& unit, uint64_t iterations)
+{
+	s_Results.push_back({ name, value, unit, iterations });
+	HZ_INFO("{0:<48} {1:>14.3f} {2}", name, value, unit);
+}
+
+const std::vector<BenchmarkResult>& Benchmark::GetResults()
+{
+	return s_Results;
+}
+
+double Benchmark::Median(std::vector<double>& samples)
+{
+	std::sort(samples.begin(), samples.end());
+	return samples[samples.size() / 2];
+}
+
+bool Benchmark::WriteJson(const std::string& path)
+{
+	std::ofstream out(path);
+	if (!out)
+	{
+		HZ_ERROR("Could not open '{0}' for writing", path);
+		return false;
+	}
+
+	// I nomi sono scritti dal codice dei benchmark: contengono solo caratteri che non vanno escapati.
+	out << "{\n\t\"results\": [\n";
+	for (size_t i = 0; i < s_Results.size(); i++)
+	{
+		const BenchmarkResult& result = s_Results[i];
+		out << "\t\t{ \"name\": \"" << result.Name << "\", \"value\": " << result.Value
+			<< ", \"unit\": \"" << result.Unit << "\", \"iterations\": " << result.Iterations << " }"
+			<< (i + 1 < s_Results.size() ? ",\n" : "\n");
+	}
+	out << "\t]\n}\n";
+
+	HZ_INFO("{0} results written to {1}", s_Results.size(), path);
+	return true;
+}
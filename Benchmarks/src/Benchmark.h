@@ -0,0 +1,78 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct BenchmarkResult
+{
+	std::string Name;
+	double Value;
+	std::string Unit;
+	uint64_t Iterations;
+};
+
+// Raccoglie i risultati di tutti i gruppi di benchmark e li scrive in un file JSON,
+// un risultato per riga e in ordine di esecuzione, così due esecuzioni si confrontano con un semplice diff.
+class Benchmark
+{
+public:
+	// Esegue fn in più campioni da circa SampleMilliseconds e registra la mediana dei nanosecondi per chiamata.
+	template<typename Fn>
+	static double Run(const std::string& name, Fn&& fn)
+	{
+		uint64_t iterations = Calibrate(fn);
+
+		std::vector<double> samples(SampleCount);
+		for (double& sample : samples)
+		{
+			auto start = std::chrono::high_resolution_clock::now();
+			for (uint64_t i = 0; i < iterations; i++)
+				fn();
+			auto end = std::chrono::high_resolution_clock::now();
+			sample = std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+		}
+
+		double median = Median(samples);
+		Record(name, median, "ns/op", iterations * SampleCount);
+		return median;
+	}
+
+	// Per le misure che non sono "tempo per chiamata" (ms per frame, ACMR, speedup...).
+	static void Record(const std::string& name, double value, const std::string& unit, uint64_t iterations = 1);
+
+	static const std::vector<BenchmarkResult>& GetResults();
+	static bool WriteJson(const std::string& path);
+
+	// Impedisce al compilatore di eliminare un calcolo il cui risultato non viene usato.
+	template<typename T>
+	static void DoNotOptimize(const T& value)
+	{
+		s_Sink = &value;
+	}
+
+private:
+	template<typename Fn>
+	static uint64_t Calibrate(Fn& fn)
+	{
+		// Raddoppia le iterazioni finché un campione non dura abbastanza da essere misurato con precisione.
+		for (uint64_t iterations = 1;; iterations *= 2)
+		{
+			auto start = std::chrono::high_resolution_clock::now();
+			for (uint64_t i = 0; i < iterations; i++)
+				fn();
+			auto end = std::chrono::high_resolution_clock::now();
+			if (std::chrono::duration<double, std::milli>(end - start).count() >= SampleMilliseconds || iterations >= (1ull << 30))
+				return iterations;
+		}
+	}
+
+	static double Median(std::vector<double>& samples);
+
+private:
+	static const uint32_t SampleCount = 7;
+	static constexpr double SampleMilliseconds = 10.0;
+
+	static const void* volatile s_Sink;
+};
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <string>
+
+// Ogni gruppo di benchmark è una funzione libera: Main.cpp le esegue in sequenza.
+// I risultati vanno registrati con Benchmark::Run / Benchmark::Record (Benchmark.h).
+void RunEngineBenchmarks();
+void RunShaderBenchmarks();
+void RunPhysicsBenchmarks();
+// Confronta anche le varianti SIMD con glm: restituisce false se una di queste dà risultati diversi.
+bool RunMathBenchmarks();
+
+// Riesegue un file registrato con --capture (RenderCapture) e registra i tempi per frame.
+// Con null = true i comandi vanno al NullRendererAPI: resta solo il costo lato CPU.
+bool RunReplayBenchmark(const std::string& path, bool null);
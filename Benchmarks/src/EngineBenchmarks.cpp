@@ -0,0 +1,208 @@
+#include "GameEngine/Log.h"
+#include "GameEngine/LayerStack.h"
+#include "GameEngine/Events/ApplicationEvent.h"
+#include "GameEngine/Events/KeyEvent.h"
+#include "GameEngine/Events/MouseEvent.h"
+#include "GameEngine/Renderer/Buffer.h"
+#include "GameEngine/Renderer/Renderer.h"
+#include "GameEngine/Renderer/OrthographicCamera.h"
+#include "GameEngine/Renderer/PerspectiveCamera.h"
+#include "GameEngine/Renderer/MeshOptimizer.h"
+
+#include "Benchmark.h"
+#include "Benchmarks.h"
+#include "NullRenderer.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+using namespace GameEngine;
+
+static void RunEventBenchmarks()
+{
+	// Stessa sequenza di Application::OnEvent e di un layer tipico: tre Dispatch, di cui uno va a segno.
+	KeyPressedEvent event(65, 0);
+	uint32_t handled = 0;
+	Benchmark::Run("EventDispatcher::Dispatch (3 handlers)", [&]()
+	{
+		event.Handled = false;
+		EventDispatcher dispatcher(event);
+		dispatcher.Dispatch<WindowCloseEvent>([&](WindowCloseEvent&) { handled++; return true; });
+		dispatcher.Dispatch<MouseMovedEvent>([&](MouseMovedEvent&) { handled++; return true; });
+		dispatcher.Dispatch<KeyPressedEvent>([&](KeyPressedEvent&) { handled++; return false; });
+	});
+	Benchmark::DoNotOptimize(handled);
+}
+
+static void RunBufferLayoutBenchmarks()
+{
+	Benchmark::Run("BufferLayout construction (5 elements)", []()
+	{
+		BufferLayout layout = {
+			{ ShaderDataType::Float3, "a_Position" },
+			{ ShaderDataType::Float4, "a_Color" },
+			{ ShaderDataType::Float2, "a_TexCoord" },
+			{ ShaderDataType::Float, "a_TexIndex" },
+			{ ShaderDataType::Float, "a_TilingFactor" }
+		};
+		Benchmark::DoNotOptimize(layout);
+	});
+}
+
+class BenchmarkLayer : public Layer
+{
+public:
+	BenchmarkLayer()
+		: Layer("BenchmarkLayer") {}
+
+	virtual void OnUpdate(Timestep ts) override { m_Time += ts; }
+
+private:
+	float m_Time = 0.0f;
+};
+
+static void RunLayerStackBenchmarks()
+{
+	const uint32_t layerCount = 16;
+
+	BenchmarkLayer layers[layerCount];
+	BenchmarkLayer overlay;
+	Benchmark::Run("LayerStack push/pop (16 layers + 1 overlay)", [&]()
+	{
+		LayerStack stack;
+		for (BenchmarkLayer& layer : layers)
+			stack.PushLayer(&layer);
+		stack.PushOverlay(&overlay);
+
+		// Il distruttore di LayerStack cancella i layer rimasti: li togliamo tutti prima.
+		stack.PopOverlay(&overlay);
+		for (BenchmarkLayer& layer : layers)
+			stack.PopLayer(&layer);
+	});
+
+	LayerStack stack;
+	for (uint32_t i = 0; i < layerCount; i++)
+		stack.PushLayer(new BenchmarkLayer());
+
+	Benchmark::Run("LayerStack update iteration (16 layers)", [&]()
+	{
+		for (Layer* layer : stack)
+			layer->OnUpdate(Timestep(1.0f / 60.0f));
+	});
+}
+
+static void RunSubmitBenchmarks()
+{
+	NullRenderer::NullRendererAPI nullAPI;
+	RendererAPI* previous = RenderCommand::SetRendererAPI(&nullAPI);
+
+	Ref<Shader> shader = std::make_shared<NullRenderer::NullShader>();
+	Ref<VertexArray> vertexArray = std::make_shared<NullRenderer::NullVertexArray>();
+	glm::mat4 transform = glm::translate(glm::mat4(1.0f), glm::vec3(1.0f, 2.0f, 0.0f));
+
+	const uint32_t submitsPerFrame = 1000;
+	Benchmark::Run("Renderer::Submit (null backend)", [&]()
+	{
+		Renderer::Submit(shader, vertexArray, transform);
+	});
+	Benchmark::Run("Renderer::Submit x1000 (null backend)", [&]()
+	{
+		for (uint32_t i = 0; i < submitsPerFrame; i++)
+			Renderer::Submit(shader, vertexArray, transform);
+	});
+
+	// Materiali senza parametri, così non serve creare uniform buffer: misura accodamento, ordinamento e bind evitati.
+	Ref<Material> materials[4];
+	Ref<MaterialInstance> instances[16];
+	for (uint32_t i = 0; i < 4; i++)
+		materials[i] = std::make_shared<Material>(std::make_shared<NullRenderer::NullShader>());
+	for (uint32_t i = 0; i < 16; i++)
+		instances[i] = std::make_shared<MaterialInstance>(materials[i % 4]);
+
+	Benchmark::Run("Renderer::Submit material x1000 + EndScene (null backend)", [&]()
+	{
+		for (uint32_t i = 0; i < submitsPerFrame; i++)
+			Renderer::Submit(instances[(i * 7) % 16], vertexArray, transform);
+		Renderer::EndScene();
+	});
+	Benchmark::DoNotOptimize(nullAPI.GetDrawCalls());
+
+	RenderCommand::SetRendererAPI(previous);
+}
+
+static void RunCameraBenchmarks()
+{
+	OrthographicCamera orthographic(-1.6f, 1.6f, -0.9f, 0.9f);
+	PerspectiveCamera perspective(45.0f, 16.0f / 9.0f);
+	float t = 0.0f;
+
+	// Ogni iterazione sporca la view, quindi misura il ricalcolo completo (view + projection * view).
+	Benchmark::Run("OrthographicCamera move + recompute", [&]()
+	{
+		t += 0.001f;
+		orthographic.SetPosition({ t, -t, 0.0f });
+		orthographic.SetRotation(t);
+		Benchmark::DoNotOptimize(orthographic.GetProjectionViewMatrix());
+	});
+	Benchmark::Run("PerspectiveCamera move + recompute", [&]()
+	{
+		t += 0.001f;
+		perspective.SetPosition({ t, 1.0f, 5.0f });
+		perspective.SetRotation({ t, -t, 0.0f });
+		Benchmark::DoNotOptimize(perspective.GetProjectionViewMatrix());
+	});
+	Benchmark::Run("PerspectiveCamera cached matrices", [&]()
+	{
+		Benchmark::DoNotOptimize(perspective.GetProjectionViewMatrix());
+	});
+}
+
+static void RunMeshOptimizerBenchmarks()
+{
+	// Griglia di 128x128 quad con i triangoli in ordine casuale: il caso peggiore per la post-transform cache.
+	const uint32_t gridSize = 128;
+	std::vector<glm::vec3> positions;
+	for (uint32_t y = 0; y <= gridSize; y++)
+		for (uint32_t x = 0; x <= gridSize; x++)
+			positions.push_back({ (float)x, (float)y, 0.0f });
+
+	std::vector<uint32_t> triangles;
+	for (uint32_t y = 0; y < gridSize; y++)
+	{
+		for (uint32_t x = 0; x < gridSize; x++)
+		{
+			uint32_t i = y * (gridSize + 1) + x;
+			triangles.insert(triangles.end(), { i, i + 1, i + gridSize + 2 });
+			triangles.insert(triangles.end(), { i, i + gridSize + 2, i + gridSize + 1 });
+		}
+	}
+
+	uint32_t seed = 1;
+	for (uint32_t t = (uint32_t)triangles.size() / 3 - 1; t > 0; t--)
+	{
+		seed = seed * 1664525u + 1013904223u;
+		uint32_t other = seed % (t + 1);
+		for (uint32_t k = 0; k < 3; k++)
+			std::swap(triangles[t * 3 + k], triangles[other * 3 + k]);
+	}
+
+	std::vector<uint32_t> optimized(triangles.size());
+	const uint32_t vertexCount = (uint32_t)positions.size();
+	const uint32_t indexCount = (uint32_t)triangles.size();
+	Benchmark::Run("MeshOptimizer::OptimizeVertexCache (32k triangles)", [&]()
+	{
+		MeshOptimizer::OptimizeVertexCache(optimized.data(), triangles.data(), indexCount, vertexCount);
+	});
+
+	Benchmark::Record("MeshOptimizer ACMR before", MeshOptimizer::AnalyzeVertexCache(triangles.data(), indexCount, vertexCount).ACMR, "vertices/triangle");
+	Benchmark::Record("MeshOptimizer ACMR after", MeshOptimizer::AnalyzeVertexCache(optimized.data(), indexCount, vertexCount).ACMR, "vertices/triangle");
+}
+
+void RunEngineBenchmarks()
+{
+	RunEventBenchmarks();
+	RunBufferLayoutBenchmarks();
+	RunLayerStackBenchmarks();
+	RunSubmitBenchmarks();
+	RunCameraBenchmarks();
+	RunMeshOptimizerBenchmarks();
+}
@@ -0,0 +1,42 @@
+#include "GameEngine/Log.h"
+
+#include "Benchmark.h"
+#include "Benchmarks.h"
+
+// Uso: Benchmarks [output.json] [--replay <capture> [--null]]
+// Il file JSON può essere confrontato con quello generato su un altro commit per trovare le regressioni.
+// Con --replay viene eseguito solo il replay di una cattura (Sandbox --capture <capture>), su OpenGL o con --null sul NullRendererAPI.
+int main(int argc, char** argv)
+{
+	GameEngine::Log::Init();
+
+	std::string outputPath = "BenchmarkResults.json";
+	std::string replayPath;
+	bool null = false;
+	for (int i = 1; i < argc; i++)
+	{
+		std::string argument = argv[i];
+		if (argument == "--replay" && i + 1 < argc)
+			replayPath = argv[++i];
+		else if (argument == "--null")
+			null = true;
+		else
+			outputPath = argument;
+	}
+
+	if (!replayPath.empty())
+	{
+		if (!RunReplayBenchmark(replayPath, null))
+			return 1;
+		return Benchmark::WriteJson(outputPath) ? 0 : 1;
+	}
+
+	RunEngineBenchmarks();
+	RunShaderBenchmarks();
+	RunPhysicsBenchmarks();
+	bool mathKernelsMatch = RunMathBenchmarks();
+
+	if (!Benchmark::WriteJson(outputPath))
+		return 1;
+	return mathKernelsMatch ? 0 : 1;
+}
@@ -0,0 +1,154 @@
+#include "GameEngine/Log.h"
+#include "GameEngine/Math/MathKernels.h"
+
+#include "Benchmark.h"
+#include "Benchmarks.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <random>
+
+using namespace GameEngine;
+
+struct MathInputs
+{
+	std::vector<glm::vec3> Points;
+	std::vector<glm::vec3> Translations;
+	std::vector<glm::quat> Rotations;
+	std::vector<glm::vec3> Scales;
+	std::vector<glm::mat4> Transforms;
+	std::vector<BoundingBox> Boxes;
+	glm::mat4 Matrix;
+	Frustum CameraFrustum;
+};
+
+// Il conteggio dispari esercita anche le code dei loop vettoriali.
+static MathInputs GenerateInputs(uint32_t count)
+{
+	std::mt19937 random(42);
+	std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+	std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+	std::uniform_real_distribution<float> size(0.1f, 5.0f);
+
+	MathInputs inputs;
+	inputs.Points.resize(count);
+	inputs.Translations.resize(count);
+	inputs.Rotations.resize(count);
+	inputs.Scales.resize(count);
+	inputs.Boxes.resize(count);
+	for (uint32_t i = 0; i < count; i++)
+	{
+		inputs.Points[i] = { position(random), position(random), position(random) };
+		inputs.Translations[i] = { position(random), position(random), position(random) };
+		inputs.Scales[i] = { size(random), size(random), size(random) };
+
+		glm::vec4 q = { unit(random), unit(random), unit(random), unit(random) };
+		q /= std::sqrt(glm::dot(q, q));
+		inputs.Rotations[i] = glm::quat(q.w, q.x, q.y, q.z);
+
+		glm::vec3 center = inputs.Translations[i];
+		glm::vec3 extents = inputs.Scales[i];
+		inputs.Boxes[i] = { center - extents, center + extents };
+	}
+
+	inputs.Transforms.resize(count);
+	for (uint32_t i = 0; i < count; i++)
+		inputs.Transforms[i] = glm::translate(glm::mat4(1.0f), inputs.Translations[i]) * glm::mat4_cast(inputs.Rotations[i]) * glm::scale(glm::mat4(1.0f), inputs.Scales[i]);
+
+	glm::mat4 projection = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 150.0f);
+	glm::mat4 view = glm::lookAt(glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(1.0f, 0.2f, 0.5f), glm::vec3(0.0f, 1.0f, 0.0f));
+	inputs.Matrix = projection * view;
+	inputs.CameraFrustum = Frustum::FromMatrix(inputs.Matrix);
+	return inputs;
+}
+
+static float MaxError(const glm::vec3& a, const glm::vec3& b)
+{
+	glm::vec3 d = glm::abs(a - b);
+	return std::max(d.x, std::max(d.y, d.z));
+}
+
+// Riferimento per il culling: stesso test di MathKernels ma scritto per piano e vertice,
+// senza la forma centro/estensione. Un box è fuori solo se tutti e 8 i vertici sono fuori da un piano.
+static bool ReferenceVisible(const Frustum& frustum, const BoundingBox& box)
+{
+	for (const glm::vec4& plane : frustum.Planes)
+	{
+		glm::vec3 positive = {
+			plane.x >= 0.0f ? box.Max.x : box.Min.x,
+			plane.y >= 0.0f ? box.Max.y : box.Min.y,
+			plane.z >= 0.0f ? box.Max.z : box.Min.z
+		};
+		if (glm::dot(glm::vec3(plane), positive) + plane.w < 0.0f)
+			return false;
+	}
+	return true;
+}
+
+bool RunMathBenchmarks()
+{
+	const uint32_t count = 100003;
+	MathInputs inputs = GenerateInputs(count);
+
+	// Riferimenti calcolati con glm, un elemento alla volta.
+	std::vector<glm::vec3> expectedPoints(count);
+	std::vector<glm::vec3> expectedCorners(count * 4);
+	std::vector<uint8_t> expectedVisible(count);
+	const glm::vec4 quad[4] = { { -0.5f, -0.5f, 0.0f, 1.0f }, { 0.5f, -0.5f, 0.0f, 1.0f }, { 0.5f, 0.5f, 0.0f, 1.0f }, { -0.5f, 0.5f, 0.0f, 1.0f } };
+	for (uint32_t i = 0; i < count; i++)
+	{
+		expectedPoints[i] = glm::vec3(inputs.Matrix * glm::vec4(inputs.Points[i], 1.0f));
+		for (uint32_t k = 0; k < 4; k++)
+			expectedCorners[i * 4 + k] = glm::vec3(inputs.Transforms[i] * quad[k]);
+		expectedVisible[i] = ReferenceVisible(inputs.CameraFrustum, inputs.Boxes[i]) ? 1 : 0;
+	}
+
+	std::vector<glm::vec3> points(count);
+	std::vector<glm::mat4> transforms(count);
+	std::vector<glm::vec3> corners(count * 4);
+	std::vector<uint8_t> visible(count);
+
+	const SimdLevel selected = MathKernels::GetLevel();
+	HZ_INFO("MathKernels, {0} elements, selected variant: {1}", count, MathKernels::GetLevelName(selected));
+
+	bool match = true;
+
+	const SimdLevel levels[] = { SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2, SimdLevel::AVX512 };
+	for (SimdLevel level : levels)
+	{
+		if (!MathKernels::SetLevel(level))
+		{
+			HZ_INFO("{0:>8} not supported", MathKernels::GetLevelName(level));
+			continue;
+		}
+
+		std::string suffix = std::string(" (") + MathKernels::GetLevelName(level) + ", 100k)";
+		Benchmark::Run("MathKernels::TransformPoints" + suffix, [&]() { MathKernels::TransformPoints(inputs.Matrix, inputs.Points.data(), points.data(), count); });
+		Benchmark::Run("MathKernels::ComposeTRS" + suffix, [&]() { MathKernels::ComposeTRS(inputs.Translations.data(), inputs.Rotations.data(), inputs.Scales.data(), transforms.data(), count); });
+		Benchmark::Run("MathKernels::ComputeQuadCorners" + suffix, [&]() { MathKernels::ComputeQuadCorners(inputs.Transforms.data(), corners.data(), count); });
+		Benchmark::Run("MathKernels::CullBoxes" + suffix, [&]() { MathKernels::CullBoxes(inputs.CameraFrustum, inputs.Boxes.data(), visible.data(), count); });
+
+		// Verifica rispetto a glm: errore massimo assoluto e box classificati diversamente.
+		float pointError = 0.0f, composeError = 0.0f, cornerError = 0.0f;
+		uint32_t cullMismatches = 0;
+		for (uint32_t i = 0; i < count; i++)
+		{
+			pointError = std::max(pointError, MaxError(points[i], expectedPoints[i]));
+			for (uint32_t c = 0; c < 4; c++)
+				composeError = std::max(composeError, MaxError(glm::vec3(transforms[i][c]), glm::vec3(inputs.Transforms[i][c])));
+			for (uint32_t k = 0; k < 4; k++)
+				cornerError = std::max(cornerError, MaxError(corners[i * 4 + k], expectedCorners[i * 4 + k]));
+			cullMismatches += visible[i] != expectedVisible[i];
+		}
+
+		const float tolerance = 1e-3f;
+		if (pointError > tolerance || composeError > tolerance || cornerError > tolerance || cullMismatches > 0)
+		{
+			HZ_ERROR("{0:>8} differs from glm: error {1} / {2} / {3}, {4} misclassified boxes", MathKernels::GetLevelName(level), pointError, composeError, cornerError, cullMismatches);
+			match = false;
+		}
+	}
+
+	MathKernels::SetLevel(selected);
+	return match;
+}
@@ -0,0 +1,190 @@
+#pragma once
+
+#include "GameEngine/Renderer/RendererAPI.h"
+#include "GameEngine/Renderer/Shader.h"
+#include "GameEngine/Renderer/VertexArray.h"
+#include "GameEngine/Renderer/Buffer.h"
+#include "GameEngine/Renderer/Texture.h"
+#include "GameEngine/Renderer/UniformBuffer.h"
+#include "GameEngine/Renderer/StorageBuffer.h"
+#include "GameEngine/Renderer/Framebuffer.h"
+
+// Backend che non chiama nessuna API grafica: misura solo il costo lato CPU del Renderer.
+namespace NullRenderer {
+
+	class NullRendererAPI : public GameEngine::RendererAPI
+	{
+	public:
+		virtual void Init() override {}
+		virtual void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) override {}
+		virtual void SetClearColor(const glm::vec4& color) override {}
+		virtual void Clear() override {}
+
+		virtual void DrawIndexed(const GameEngine::Ref<GameEngine::VertexArray>& vertexArray, uint32_t indexCount = 0) override { m_DrawCalls++; }
+		virtual void DrawIndexedInstanced(const GameEngine::Ref<GameEngine::VertexArray>& vertexArray, uint32_t instanceCount, uint32_t indexCount = 0) override { m_DrawCalls++; }
+		virtual void DrawIndexedIndirect(const GameEngine::Ref<GameEngine::VertexArray>& vertexArray, const GameEngine::Ref<GameEngine::StorageBuffer>& commands, uint32_t drawCount, uint32_t offset = 0) override { m_DrawCalls++; }
+		virtual void DispatchCompute(uint32_t groupsX, uint32_t groupsY = 1, uint32_t groupsZ = 1) override {}
+
+		uint64_t GetDrawCalls() const { return m_DrawCalls; }
+
+	private:
+		uint64_t m_DrawCalls = 0;
+	};
+
+	class NullShader : public GameEngine::Shader
+	{
+	public:
+		virtual void Bind() const override {}
+		virtual void Unbind() const override {}
+
+		virtual void SetInt(const std::string& name, int value) override {}
+		virtual void SetIntArray(const std::string& name, int* values, uint32_t count) override {}
+		virtual void SetFloat3(const std::string& name, const glm::vec3& value) override {}
+		virtual void SetFloat4(const std::string& name, const glm::vec4& value) override {}
+		virtual void SetMat4(const std::string& name, const glm::mat4& value) override {}
+	};
+
+	class NullVertexArray : public GameEngine::VertexArray
+	{
+	public:
+		virtual void Bind() const override {}
+		virtual void Unbind() const override {}
+
+		virtual void AddVertexBuffer(const GameEngine::Ref<GameEngine::VertexBuffer>& vertexBuffer, uint32_t instanceDivisor = 0) override { m_VertexBuffers.push_back(vertexBuffer); }
+		virtual void SetIndexBuffer(const GameEngine::Ref<GameEngine::IndexBuffer>& indexBuffer) override { m_IndexBuffer = indexBuffer; }
+
+		virtual const std::vector<GameEngine::Ref<GameEngine::VertexBuffer>>& GetVertexBuffers() const override { return m_VertexBuffers; }
+		virtual const GameEngine::Ref<GameEngine::IndexBuffer>& GetIndexBuffers() const override { return m_IndexBuffer; }
+		virtual uint32_t GetVertexCount() const override { return 0; }
+
+	private:
+		std::vector<GameEngine::Ref<GameEngine::VertexBuffer>> m_VertexBuffers;
+		GameEngine::Ref<GameEngine::IndexBuffer> m_IndexBuffer;
+	};
+
+	class NullVertexBuffer : public GameEngine::VertexBuffer
+	{
+	public:
+		NullVertexBuffer(uint32_t size) : m_Data(size) {}
+
+		virtual void Bind() const override {}
+		virtual void Unbind() const override {}
+
+		virtual void SetData(const void* data, uint32_t size) override { m_Size = size; }
+		// Memoria di appoggio: chi scrive nel buffer mappato deve trovare memoria valida.
+		virtual void* Map(uint32_t size) override
+		{
+			if (size > m_Data.size())
+				m_Data.resize(size);
+			m_Size = size;
+			return m_Data.data();
+		}
+		virtual void Unmap() override {}
+
+		virtual uint32_t GetSize() const override { return m_Size; }
+
+		virtual const GameEngine::BufferLayout& GetLayout() const override { return m_Layout; }
+		virtual void SetLayout(const GameEngine::BufferLayout& layout) override { m_Layout = layout; }
+
+	private:
+		std::vector<uint8_t> m_Data;
+		uint32_t m_Size = 0;
+		GameEngine::BufferLayout m_Layout;
+	};
+
+	class NullIndexBuffer : public GameEngine::IndexBuffer
+	{
+	public:
+		NullIndexBuffer(uint32_t count) : m_Count(count) {}
+
+		virtual void Bind() const override {}
+		virtual void Unbind() const override {}
+
+		virtual uint32_t GetCount() const override { return m_Count; }
+		virtual uint32_t GetIndexSize() const override { return sizeof(uint32_t); }
+
+	private:
+		uint32_t m_Count;
+	};
+
+	class NullTexture2D : public GameEngine::Texture2D
+	{
+	public:
+		NullTexture2D(uint32_t width, uint32_t height) : m_Width(width), m_Height(height) {}
+
+		virtual uint32_t GetWidth() const override { return m_Width; }
+		virtual uint32_t GetHeight() const override { return m_Height; }
+		virtual uint32_t GetRendererID() const override { return 0; }
+
+		virtual void SetData(void* data, uint32_t size) override {}
+		virtual void Bind(uint32_t slot = 0) const override {}
+
+	private:
+		uint32_t m_Width, m_Height;
+	};
+
+	class NullTextureArray : public GameEngine::TextureArray
+	{
+	public:
+		NullTextureArray(uint32_t width, uint32_t height, uint32_t layers) : m_Width(width), m_Height(height), m_Layers(layers) {}
+
+		virtual uint32_t GetWidth() const override { return m_Width; }
+		virtual uint32_t GetHeight() const override { return m_Height; }
+		virtual uint32_t GetLayerCount() const override { return m_Layers; }
+		virtual uint32_t GetRendererID() const override { return 0; }
+
+		virtual void SetData(void* data, uint32_t size) override {}
+		virtual void SetLayerData(uint32_t layer, const void* data, uint32_t size) override {}
+		virtual void Bind(uint32_t slot = 0) const override {}
+
+	private:
+		uint32_t m_Width, m_Height, m_Layers;
+	};
+
+	class NullUniformBuffer : public GameEngine::UniformBuffer
+	{
+	public:
+		virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) override {}
+		virtual void Bind(uint32_t binding) const override {}
+	};
+
+	class NullStorageBuffer : public GameEngine::StorageBuffer
+	{
+	public:
+		NullStorageBuffer(uint32_t size) : m_Size(size) {}
+
+		virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) override {}
+		virtual void Bind(uint32_t binding) const override {}
+
+		virtual uint32_t GetSize() const override { return m_Size; }
+		virtual uint32_t GetRendererID() const override { return 0; }
+
+	private:
+		uint32_t m_Size;
+	};
+
+	class NullFramebuffer : public GameEngine::Framebuffer
+	{
+	public:
+		NullFramebuffer(const GameEngine::FramebufferSpecification& spec) : m_Specification(spec) {}
+
+		virtual void Bind() override {}
+		virtual void Unbind() override {}
+
+		virtual void Resize(uint32_t width, uint32_t height) override
+		{
+			m_Specification.Width = width;
+			m_Specification.Height = height;
+		}
+
+		virtual void ClearColorAttachment(uint32_t index, const glm::vec4& value) override {}
+		virtual void BlitToScreen(uint32_t srcWidth, uint32_t srcHeight, uint32_t dstWidth, uint32_t dstHeight) const override {}
+
+		virtual uint32_t GetColorAttachmentRendererID(uint32_t index = 0) const override { return 0; }
+		virtual const GameEngine::FramebufferSpecification& GetSpecification() const override { return m_Specification; }
+
+	private:
+		GameEngine::FramebufferSpecification m_Specification;
+	};
+
+}
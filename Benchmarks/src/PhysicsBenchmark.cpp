@@ -0,0 +1,89 @@
+#include "GameEngine/Log.h"
+#include "GameEngine/Core/JobSystem.h"
+#include "GameEngine/Physics/CollisionWorld.h"
+
+#include "Benchmark.h"
+#include "Benchmarks.h"
+
+#include <chrono>
+#include <random>
+
+using namespace GameEngine;
+
+struct PhysicsResult
+{
+	double StepMilliseconds;
+	size_t Contacts;
+};
+
+// Body distribuiti uniformemente con densità costante: al crescere di N l'area cresce in proporzione,
+// così il numero medio di vicini per body non cambia e la scalabilità misurata è quella della struttura.
+static PhysicsResult RunScene(uint32_t bodyCount, uint32_t steps)
+{
+	std::mt19937 random(1234);
+	const float worldSize = std::sqrt((float)bodyCount) * 2.0f;
+	std::uniform_real_distribution<float> position(0.0f, worldSize);
+	std::uniform_real_distribution<float> velocity(-1.0f, 1.0f);
+
+	CollisionWorld world;
+	std::vector<BodyID> bodies(bodyCount);
+	std::vector<glm::vec2> velocities(bodyCount);
+	for (uint32_t i = 0; i < bodyCount; i++)
+	{
+		ColliderDesc desc;
+		desc.Type = i % 2 ? ColliderType::Circle : ColliderType::Box;
+		desc.Position = { position(random), position(random) };
+		desc.HalfExtents = { 0.5f, 0.5f };
+		desc.Radius = 0.5f;
+		bodies[i] = world.CreateBody(desc);
+		velocities[i] = { velocity(random), velocity(random) };
+	}
+	world.Step();
+
+	const float dt = 1.0f / 60.0f;
+	double total = 0.0;
+	for (uint32_t step = 0; step < steps; step++)
+	{
+		for (uint32_t i = 0; i < bodyCount; i++)
+		{
+			glm::vec2 p = world.GetPosition(bodies[i]) + velocities[i] * dt;
+			if (p.x < 0.0f || p.x > worldSize) velocities[i].x = -velocities[i].x;
+			if (p.y < 0.0f || p.y > worldSize) velocities[i].y = -velocities[i].y;
+			world.SetPosition(bodies[i], p);
+		}
+
+		auto start = std::chrono::high_resolution_clock::now();
+		world.Step();
+		auto end = std::chrono::high_resolution_clock::now();
+		total += std::chrono::duration<double, std::milli>(end - start).count();
+	}
+
+	return { total / steps, world.GetContacts().size() };
+}
+
+void RunPhysicsBenchmarks()
+{
+	const uint32_t bodyCounts[] = { 1000, 10000, 50000, 100000 };
+	const uint32_t steps = 60;
+
+	for (uint32_t bodyCount : bodyCounts)
+	{
+		PhysicsResult serial = RunScene(bodyCount, steps);
+
+		GameEngine::JobSystem::Init();
+		PhysicsResult parallel = RunScene(bodyCount, steps);
+		uint32_t threads = GameEngine::JobSystem::GetWorkerCount() + 1;
+		GameEngine::JobSystem::Shutdown();
+
+		// I contatti devono coincidere: l'output non dipende dal numero di thread.
+		if (serial.Contacts != parallel.Contacts)
+			HZ_ERROR("Contact count mismatch: {0} vs {1}", serial.Contacts, parallel.Contacts);
+
+		// Il numero di thread dipende dalla macchina: non fa parte del nome, così i risultati restano confrontabili.
+		std::string scene = "CollisionWorld::Step " + std::to_string(bodyCount) + " bodies";
+		Benchmark::Record(scene + ", 1 thread", serial.StepMilliseconds, "ms/step", steps);
+		Benchmark::Record(scene + ", job system", parallel.StepMilliseconds, "ms/step", steps);
+		Benchmark::Record(scene + ", contacts", (double)parallel.Contacts, "contacts");
+		HZ_INFO("{0} threads, speedup {1:.2f}x", threads, serial.StepMilliseconds / parallel.StepMilliseconds);
+	}
+}
@@ -0,0 +1,605 @@
+#include "GameEngine/Log.h"
+#include "GameEngine/Window.h"
+#include "GameEngine/Renderer/RenderCapture.h"
+#include "GameEngine/Renderer/RenderCommand.h"
+
+#include "Benchmark.h"
+#include "Benchmarks.h"
+#include "NullRenderer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <unordered_map>
+
+using namespace GameEngine;
+
+// Risorse ricreate durante il replay, indicizzate con gli id del file di cattura.
+struct ReplayResources
+{
+	std::unordered_map<uint32_t, std::string> Strings;
+	std::unordered_map<uint32_t, Ref<VertexBuffer>> VertexBuffers;
+	std::unordered_map<uint32_t, Ref<IndexBuffer>> IndexBuffers;
+	std::unordered_map<uint32_t, Ref<VertexArray>> VertexArrays;
+	std::unordered_map<uint32_t, Ref<Shader>> Shaders;
+	// Contiene anche gli array di texture, che condividono con le Texture2D le op TextureSetData e TextureBind.
+	std::unordered_map<uint32_t, Ref<Texture>> Textures;
+	std::unordered_map<uint32_t, Ref<TextureArray>> TextureArrays;
+	std::unordered_map<uint32_t, Ref<UniformBuffer>> UniformBuffers;
+	std::unordered_map<uint32_t, Ref<StorageBuffer>> StorageBuffers;
+	std::unordered_map<uint32_t, Ref<Framebuffer>> Framebuffers;
+
+	void Destroy(uint32_t id)
+	{
+		VertexBuffers.erase(id);
+		IndexBuffers.erase(id);
+		VertexArrays.erase(id);
+		Shaders.erase(id);
+		Textures.erase(id);
+		TextureArrays.erase(id);
+		UniformBuffers.erase(id);
+		StorageBuffers.erase(id);
+		Framebuffers.erase(id);
+	}
+};
+
+template<typename T>
+static T* Find(std::unordered_map<uint32_t, Ref<T>>& resources, uint32_t id)
+{
+	auto it = resources.find(id);
+	return it != resources.end() ? it->second.get() : nullptr;
+}
+
+template<typename T>
+static const Ref<T>& FindRef(std::unordered_map<uint32_t, Ref<T>>& resources, uint32_t id)
+{
+	static const Ref<T> s_Null;
+	auto it = resources.find(id);
+	return it != resources.end() ? it->second : s_Null;
+}
+
+static glm::vec4 ReadVec4(RenderCaptureReader& reader)
+{
+	glm::vec4 value;
+	for (int i = 0; i < 4; i++)
+		value[i] = reader.ReadFloat();
+	return value;
+}
+
+// Esegue i record fino al prossimo FrameEnd. Restituisce false a fine file o se il file è corrotto.
+// Le chiamate su risorse sconosciute (create prima dell'avvio della cattura) vengono ignorate.
+static bool ReplayFrame(RenderCaptureReader& reader, ReplayResources& resources, bool null)
+{
+	RenderCaptureOp op;
+	while (reader.Next(op))
+	{
+		switch (op)
+		{
+			case RenderCaptureOp::FrameEnd:
+				return true;
+
+			case RenderCaptureOp::DefineString:
+			{
+				uint32_t id = reader.ReadU32();
+				resources.Strings[id] = reader.ReadString();
+				break;
+			}
+
+			case RenderCaptureOp::Destroy:
+				resources.Destroy(reader.ReadU32());
+				break;
+
+			case RenderCaptureOp::CreateVertexBuffer:
+			{
+				uint32_t id = reader.ReadU32();
+				uint32_t size = reader.ReadU32();
+				bool hasData = reader.ReadU8() != 0;
+				const uint8_t* data = hasData ? reader.ReadBlob(size) : nullptr;
+				if (null)
+					resources.VertexBuffers[id] = std::make_shared<NullRenderer::NullVertexBuffer>(size);
+				else
+					resources.VertexBuffers[id].reset(hasData ? VertexBuffer::Create(data, size) : VertexBuffer::Create(size));
+				break;
+			}
+
+			case RenderCaptureOp::CreateIndexBuffer:
+			{
+				uint32_t id = reader.ReadU32();
+				uint32_t count = reader.ReadU32();
+				const uint8_t* data = reader.ReadBytes(count * sizeof(uint32_t));
+				if (!data)
+					break;
+
+				if (null)
+				{
+					resources.IndexBuffers[id] = std::make_shared<NullRenderer::NullIndexBuffer>(count);
+				}
+				else
+				{
+					std::vector<uint32_t> indices(count);
+					memcpy(indices.data(), data, count * sizeof(uint32_t));
+					resources.IndexBuffers[id].reset(IndexBuffer::Create(indices.data(), count));
+				}
+				break;
+			}
+
+			case RenderCaptureOp::CreateVertexArray:
+			{
+				uint32_t id = reader.ReadU32();
+				if (null)
+					resources.VertexArrays[id] = std::make_shared<NullRenderer::NullVertexArray>();
+				else
+					resources.VertexArrays[id].reset(VertexArray::Create());
+				break;
+			}
+
+			case RenderCaptureOp::CreateShader:
+			{
+				uint32_t id = reader.ReadU32();
+				std::string vertexSrc = reader.ReadString();
+				std::string fragmentSrc = reader.ReadString();
+				if (null)
+					resources.Shaders[id] = std::make_shared<NullRenderer::NullShader>();
+				else
+					resources.Shaders[id].reset(Shader::Create(vertexSrc, fragmentSrc));
+				break;
+			}
+
+			case RenderCaptureOp::CreateTexture2D:
+			{
+				uint32_t id = reader.ReadU32();
+				uint32_t width = reader.ReadU32();
+				uint32_t height = reader.ReadU32();
+				if (null)
+					resources.Textures[id] = std::make_shared<NullRenderer::NullTexture2D>(width, height);
+				else
+					resources.Textures[id].reset(Texture2D::Create(width, height));
+				break;
+			}
+
+			case RenderCaptureOp::CreateUniformBuffer:
+			{
+				uint32_t id = reader.ReadU32();
+				uint32_t size = reader.ReadU32();
+				uint32_t binding = reader.ReadU32();
+				if (null)
+					resources.UniformBuffers[id] = std::make_shared<NullRenderer::NullUniformBuffer>();
+				else
+					resources.UniformBuffers[id].reset(UniformBuffer::Create(size, binding));
+				break;
+			}
+
+			case RenderCaptureOp::CreateFramebuffer:
+			{
+				uint32_t id = reader.ReadU32();
+				FramebufferSpecification spec;
+				spec.Width = reader.ReadU32();
+				spec.Height = reader.ReadU32();
+				uint32_t count = reader.ReadU32();
+				for (uint32_t i = 0; i < count; i++)
+					spec.Attachments.push_back((FramebufferTextureFormat)reader.ReadU8());
+				if (null)
+					resources.Framebuffers[id] = std::make_shared<NullRenderer::NullFramebuffer>(spec);
+				else
+					resources.Framebuffers[id].reset(Framebuffer::Create(spec));
+				break;
+			}
+
+			case RenderCaptureOp::VertexBufferSetLayout:
+			{
+				VertexBuffer* vertexBuffer = Find(resources.VertexBuffers, reader.ReadU32());
+				uint32_t count = reader.ReadU32();
+				std::vector<BufferElement> elements;
+				for (uint32_t i = 0; i < count; i++)
+				{
+					ShaderDataType type = (ShaderDataType)reader.ReadU8();
+					bool normalized = reader.ReadU8() != 0;
+					elements.emplace_back(type, resources.Strings[reader.ReadU32()], normalized);
+				}
+				if (vertexBuffer)
+					vertexBuffer->SetLayout(BufferLayout(elements));
+				break;
+			}
+
+			case RenderCaptureOp::VertexBufferSetData:
+			{
+				VertexBuffer* vertexBuffer = Find(resources.VertexBuffers, reader.ReadU32());
+				uint32_t size;
+				const uint8_t* data = reader.ReadBlob(size);
+				if (vertexBuffer && data)
+					vertexBuffer->SetData(data, size);
+				break;
+			}
+
+			case RenderCaptureOp::VertexArrayAddVertexBuffer:
+			{
+				VertexArray* vertexArray = Find(resources.VertexArrays, reader.ReadU32());
+				const Ref<VertexBuffer>& vertexBuffer = FindRef(resources.VertexBuffers, reader.ReadU32());
+				uint32_t instanceDivisor = reader.ReadU32();
+				if (vertexArray && vertexBuffer)
+					vertexArray->AddVertexBuffer(vertexBuffer, instanceDivisor);
+				break;
+			}
+
+			case RenderCaptureOp::VertexArraySetIndexBuffer:
+			{
+				VertexArray* vertexArray = Find(resources.VertexArrays, reader.ReadU32());
+				const Ref<IndexBuffer>& indexBuffer = FindRef(resources.IndexBuffers, reader.ReadU32());
+				if (vertexArray && indexBuffer)
+					vertexArray->SetIndexBuffer(indexBuffer);
+				break;
+			}
+
+			case RenderCaptureOp::VertexArrayBind:
+			case RenderCaptureOp::VertexArrayUnbind:
+			{
+				if (VertexArray* vertexArray = Find(resources.VertexArrays, reader.ReadU32()))
+				{
+					if (op == RenderCaptureOp::VertexArrayBind)
+						vertexArray->Bind();
+					else
+						vertexArray->Unbind();
+				}
+				break;
+			}
+
+			case RenderCaptureOp::ShaderBind:
+			case RenderCaptureOp::ShaderUnbind:
+			{
+				if (Shader* shader = Find(resources.Shaders, reader.ReadU32()))
+				{
+					if (op == RenderCaptureOp::ShaderBind)
+						shader->Bind();
+					else
+						shader->Unbind();
+				}
+				break;
+			}
+
+			case RenderCaptureOp::ShaderSetInt:
+			{
+				Shader* shader = Find(resources.Shaders, reader.ReadU32());
+				const std::string& name = resources.Strings[reader.ReadU32()];
+				int value = (int)reader.ReadU32();
+				if (shader)
+					shader->SetInt(name, value);
+				break;
+			}
+
+			case RenderCaptureOp::ShaderSetIntArray:
+			{
+				Shader* shader = Find(resources.Shaders, reader.ReadU32());
+				const std::string& name = resources.Strings[reader.ReadU32()];
+				uint32_t count = reader.ReadU32();
+				const uint8_t* data = reader.ReadBytes(count * sizeof(int));
+				if (shader && data)
+				{
+					std::vector<int> values(count);
+					memcpy(values.data(), data, count * sizeof(int));
+					shader->SetIntArray(name, values.data(), count);
+				}
+				break;
+			}
+
+			case RenderCaptureOp::ShaderSetFloat3:
+			{
+				Shader* shader = Find(resources.Shaders, reader.ReadU32());
+				const std::string& name = resources.Strings[reader.ReadU32()];
+				glm::vec3 value;
+				for (int i = 0; i < 3; i++)
+					value[i] = reader.ReadFloat();
+				if (shader)
+					shader->SetFloat3(name, value);
+				break;
+			}
+
+			case RenderCaptureOp::ShaderSetFloat4:
+			{
+				Shader* shader = Find(resources.Shaders, reader.ReadU32());
+				const std::string& name = resources.Strings[reader.ReadU32()];
+				glm::vec4 value = ReadVec4(reader);
+				if (shader)
+					shader->SetFloat4(name, value);
+				break;
+			}
+
+			case RenderCaptureOp::ShaderSetMat4:
+			{
+				Shader* shader = Find(resources.Shaders, reader.ReadU32());
+				const std::string& name = resources.Strings[reader.ReadU32()];
+				glm::mat4 value;
+				for (int i = 0; i < 4; i++)
+					value[i] = ReadVec4(reader);
+				if (shader)
+					shader->SetMat4(name, value);
+				break;
+			}
+
+			case RenderCaptureOp::TextureSetData:
+			{
+				Texture* texture = Find(resources.Textures, reader.ReadU32());
+				uint32_t size;
+				const uint8_t* data = reader.ReadBlob(size);
+				if (texture && data)
+					texture->SetData((void*)data, size);
+				break;
+			}
+
+			case RenderCaptureOp::TextureBind:
+			{
+				Texture* texture = Find(resources.Textures, reader.ReadU32());
+				uint32_t slot = reader.ReadU32();
+				if (texture)
+					texture->Bind(slot);
+				break;
+			}
+
+			case RenderCaptureOp::UniformBufferSetData:
+			{
+				UniformBuffer* uniformBuffer = Find(resources.UniformBuffers, reader.ReadU32());
+				uint32_t offset = reader.ReadU32();
+				uint32_t size;
+				const uint8_t* data = reader.ReadBlob(size);
+				if (uniformBuffer && data)
+					uniformBuffer->SetData(data, size, offset);
+				break;
+			}
+
+			case RenderCaptureOp::UniformBufferBind:
+			{
+				UniformBuffer* uniformBuffer = Find(resources.UniformBuffers, reader.ReadU32());
+				uint32_t binding = reader.ReadU32();
+				if (uniformBuffer)
+					uniformBuffer->Bind(binding);
+				break;
+			}
+
+			case RenderCaptureOp::FramebufferBind:
+			case RenderCaptureOp::FramebufferUnbind:
+			{
+				if (Framebuffer* framebuffer = Find(resources.Framebuffers, reader.ReadU32()))
+				{
+					if (op == RenderCaptureOp::FramebufferBind)
+						framebuffer->Bind();
+					else
+						framebuffer->Unbind();
+				}
+				break;
+			}
+
+			case RenderCaptureOp::FramebufferResize:
+			{
+				Framebuffer* framebuffer = Find(resources.Framebuffers, reader.ReadU32());
+				uint32_t width = reader.ReadU32();
+				uint32_t height = reader.ReadU32();
+				if (framebuffer)
+					framebuffer->Resize(width, height);
+				break;
+			}
+
+			case RenderCaptureOp::FramebufferClearColorAttachment:
+			{
+				Framebuffer* framebuffer = Find(resources.Framebuffers, reader.ReadU32());
+				uint32_t index = reader.ReadU32();
+				glm::vec4 value = ReadVec4(reader);
+				if (framebuffer)
+					framebuffer->ClearColorAttachment(index, value);
+				break;
+			}
+
+			case RenderCaptureOp::FramebufferBlitToScreen:
+			{
+				Framebuffer* framebuffer = Find(resources.Framebuffers, reader.ReadU32());
+				uint32_t size[4];
+				for (uint32_t& value : size)
+					value = reader.ReadU32();
+				if (framebuffer)
+					framebuffer->BlitToScreen(size[0], size[1], size[2], size[3]);
+				break;
+			}
+
+			case RenderCaptureOp::SetViewport:
+			{
+				uint32_t viewport[4];
+				for (uint32_t& value : viewport)
+					value = reader.ReadU32();
+				RenderCommand::SetViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+				break;
+			}
+
+			case RenderCaptureOp::SetClearColor:
+				RenderCommand::SetClearColor(ReadVec4(reader));
+				break;
+
+			case RenderCaptureOp::Clear:
+				RenderCommand::Clear();
+				break;
+
+			case RenderCaptureOp::DrawIndexed:
+			{
+				const Ref<VertexArray>& vertexArray = FindRef(resources.VertexArrays, reader.ReadU32());
+				uint32_t indexCount = reader.ReadU32();
+				if (vertexArray)
+					RenderCommand::DrawIndexed(vertexArray, indexCount);
+				break;
+			}
+
+			case RenderCaptureOp::DrawIndexedInstanced:
+			{
+				const Ref<VertexArray>& vertexArray = FindRef(resources.VertexArrays, reader.ReadU32());
+				uint32_t instanceCount = reader.ReadU32();
+				uint32_t indexCount = reader.ReadU32();
+				if (vertexArray)
+					RenderCommand::DrawIndexedInstanced(vertexArray, instanceCount, indexCount);
+				break;
+			}
+
+			case RenderCaptureOp::CreateStorageBuffer:
+			{
+				uint32_t id = reader.ReadU32();
+				uint32_t size = reader.ReadU32();
+				uint32_t binding = reader.ReadU32();
+				if (null)
+					resources.StorageBuffers[id] = std::make_shared<NullRenderer::NullStorageBuffer>(size);
+				else
+					resources.StorageBuffers[id].reset(StorageBuffer::Create(size, binding));
+				break;
+			}
+
+			case RenderCaptureOp::StorageBufferSetData:
+			{
+				StorageBuffer* storageBuffer = Find(resources.StorageBuffers, reader.ReadU32());
+				uint32_t offset = reader.ReadU32();
+				uint32_t size;
+				const uint8_t* data = reader.ReadBlob(size);
+				if (storageBuffer && data)
+					storageBuffer->SetData(data, size, offset);
+				break;
+			}
+
+			case RenderCaptureOp::StorageBufferBind:
+			{
+				StorageBuffer* storageBuffer = Find(resources.StorageBuffers, reader.ReadU32());
+				uint32_t binding = reader.ReadU32();
+				if (storageBuffer)
+					storageBuffer->Bind(binding);
+				break;
+			}
+
+			case RenderCaptureOp::DrawIndexedIndirect:
+			{
+				const Ref<VertexArray>& vertexArray = FindRef(resources.VertexArrays, reader.ReadU32());
+				const Ref<StorageBuffer>& commands = FindRef(resources.StorageBuffers, reader.ReadU32());
+				uint32_t drawCount = reader.ReadU32();
+				uint32_t offset = reader.ReadU32();
+				if (vertexArray && commands)
+					RenderCommand::DrawIndexedIndirect(vertexArray, commands, drawCount, offset);
+				break;
+			}
+
+			case RenderCaptureOp::CreateTextureArray:
+			{
+				uint32_t id = reader.ReadU32();
+				uint32_t width = reader.ReadU32();
+				uint32_t height = reader.ReadU32();
+				uint32_t layers = reader.ReadU32();
+				if (null)
+					resources.TextureArrays[id] = std::make_shared<NullRenderer::NullTextureArray>(width, height, layers);
+				else
+					resources.TextureArrays[id].reset(TextureArray::Create(width, height, layers));
+				resources.Textures[id] = resources.TextureArrays[id];
+				break;
+			}
+
+			case RenderCaptureOp::TextureArraySetLayerData:
+			{
+				TextureArray* textureArray = Find(resources.TextureArrays, reader.ReadU32());
+				uint32_t layer = reader.ReadU32();
+				uint32_t size;
+				const uint8_t* data = reader.ReadBlob(size);
+				if (textureArray && data)
+					textureArray->SetLayerData(layer, data, size);
+				break;
+			}
+
+			case RenderCaptureOp::CreateComputeShader:
+			{
+				uint32_t id = reader.ReadU32();
+				std::string computeSrc = reader.ReadString();
+				if (null)
+					resources.Shaders[id] = std::make_shared<NullRenderer::NullShader>();
+				else
+					resources.Shaders[id].reset(Shader::CreateCompute(computeSrc));
+				break;
+			}
+
+			case RenderCaptureOp::DispatchCompute:
+			{
+				uint32_t groupsX = reader.ReadU32();
+				uint32_t groupsY = reader.ReadU32();
+				uint32_t groupsZ = reader.ReadU32();
+				RenderCommand::DispatchCompute(groupsX, groupsY, groupsZ);
+				break;
+			}
+
+			default:
+				HZ_ERROR("Unhandled render capture op {0}", (uint32_t)op);
+				return false;
+		}
+
+		if (reader.HasError())
+			break;
+	}
+
+	if (reader.HasError())
+		HZ_ERROR("Render capture is truncated or corrupted");
+	return false;
+}
+
+bool RunReplayBenchmark(const std::string& path, bool null)
+{
+	RenderCaptureReader reader(path);
+	if (!reader.IsValid())
+		return false;
+
+	const RenderCaptureHeader& header = reader.GetHeader();
+	HZ_INFO("Replaying '{0}': {1} frames at {2}x{3} ({4})", path, header.FrameCount, header.Width, header.Height, null ? "null renderer" : "OpenGL");
+
+	// Il replay su OpenGL usa un contesto offscreen delle dimensioni della finestra catturata:
+	// i tempi non dipendono dal compositor né dal vsync.
+	Scope<Window> window;
+	NullRenderer::NullRendererAPI nullAPI;
+	RendererAPI* previousAPI = nullptr;
+	if (null)
+		previousAPI = RenderCommand::SetRendererAPI(&nullAPI);
+	else
+		window.reset(Window::Create(WindowProps("Replay", header.Width, header.Height, true)));
+	RenderCommand::Init();
+
+	ReplayResources resources;
+	std::vector<double> frameTimes;
+	frameTimes.reserve(header.FrameCount);
+
+	while (true)
+	{
+		auto start = std::chrono::high_resolution_clock::now();
+		if (!ReplayFrame(reader, resources, null))
+			break;
+
+		// In headless OnUpdate attende la fine del lavoro della GPU: il tempo misurato è quello dell'intero frame.
+		if (window)
+			window->OnUpdate();
+		auto end = std::chrono::high_resolution_clock::now();
+		frameTimes.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+	}
+
+	// Le risorse vanno distrutte finché il contesto è ancora valido.
+	resources = ReplayResources();
+	if (previousAPI)
+		RenderCommand::SetRendererAPI(previousAPI);
+
+	if (reader.HasError() || frameTimes.empty())
+		return false;
+
+	// Il primo frame comprende la creazione delle risorse (compilazione degli shader, upload): va tenuto separato.
+	const std::string name = std::string("Replay ") + (null ? "null renderer" : "OpenGL");
+	Benchmark::Record(name + ", first frame", frameTimes.front(), "ms");
+	if (frameTimes.size() < 2)
+		return true;
+
+	std::vector<double> sorted(frameTimes.begin() + 1, frameTimes.end());
+	std::sort(sorted.begin(), sorted.end());
+	auto percentile = [&sorted](double p) { return sorted[std::min((size_t)(p * sorted.size()), sorted.size() - 1)]; };
+
+	double total = 0.0;
+	for (double frameTime : sorted)
+		total += frameTime;
+
+	Benchmark::Record(name + ", avg", total / sorted.size(), "ms/frame", sorted.size());
+	Benchmark::Record(name + ", p50", percentile(0.5), "ms/frame", sorted.size());
+	Benchmark::Record(name + ", p95", percentile(0.95), "ms/frame", sorted.size());
+	Benchmark::Record(name + ", p99", percentile(0.99), "ms/frame", sorted.size());
+	Benchmark::Record(name + ", worst", sorted.back(), "ms/frame", sorted.size());
+	for (size_t i = 0; i < frameTimes.size(); i++)
+		Benchmark::Record(name + ", frame " + std::to_string(i), frameTimes[i], "ms");
+	return true;
+}
@@ -0,0 +1,89 @@
+#include "GameEngine/Log.h"
+#include "Platform/OpenGL/OpenGLContext.h"
+#include "Platform/OpenGL/OpenGLShader.h"
+
+#include "Benchmark.h"
+#include "Benchmarks.h"
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+using namespace GameEngine;
+
+static const char* s_VertexSource = R"(
+	#version 330 core
+
+	layout(location = 0) in vec3 a_Position;
+
+	uniform mat4 u_Transform;
+
+	void main()
+	{
+		gl_Position = u_Transform * vec4(a_Position, 1.0);
+	}
+)";
+
+static const char* s_FragmentSource = R"(
+	#version 330 core
+
+	layout(location = 0) out vec4 color;
+
+	uniform vec4 u_Color;
+	uniform int u_Texture;
+
+	void main()
+	{
+		color = u_Color * float(u_Texture + 1);
+	}
+)";
+
+void RunShaderBenchmarks()
+{
+	// Gli upload richiedono un contesto OpenGL: ne creiamo uno con una finestra nascosta.
+	// Senza display (ad es. su una macchina di CI) il gruppo viene saltato.
+	if (!glfwInit())
+	{
+		HZ_WARN("OpenGLShader benchmarks skipped: GLFW could not be initialized");
+		return;
+	}
+
+	glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+	GLFWwindow* window = glfwCreateWindow(64, 64, "Benchmarks", nullptr, nullptr);
+	if (!window)
+	{
+		HZ_WARN("OpenGLShader benchmarks skipped: could not create an OpenGL context");
+		glfwTerminate();
+		return;
+	}
+
+	{
+		OpenGLContext context(window);
+		context.Init();
+
+		OpenGLShader shader(s_VertexSource, s_FragmentSource);
+		shader.Bind();
+
+		glm::mat4 transform(1.0f);
+		glm::vec4 color(1.0f, 0.5f, 0.25f, 1.0f);
+		Benchmark::Run("OpenGLShader::UploadUniformMat4", [&]()
+		{
+			transform[3].x += 0.001f;
+			shader.UploadUniformMat4("u_Transform", transform);
+		});
+		Benchmark::Run("OpenGLShader::UploadUniformFloat4", [&]()
+		{
+			color.a += 0.001f;
+			shader.UploadUniformFloat4("u_Color", color);
+		});
+		Benchmark::Run("OpenGLShader::UploadUniformInt", [&]()
+		{
+			shader.UploadUniformInt("u_Texture", 0);
+		});
+
+		// Forza l'esecuzione dei comandi accodati dal driver, così il loro costo non finisce fuori dalle misure.
+		glFinish();
+	}
+
+	glfwDestroyWindow(window);
+	glfwTerminate();
+}
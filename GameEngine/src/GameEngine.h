@@ -7,22 +7,56 @@
 #include "GameEngine/Log.h"
 
 #include "GameEngine/Core/Timestep.h"
+#include "GameEngine/Core/JobSystem.h"
+#include "GameEngine/Core/MPSCQueue.h"
+#include "GameEngine/Core/Coroutine.h"
+#include "GameEngine/Core/FrameTimeTracker.h"
 
 #include "GameEngine/Input.h"
 #include "GameEngine/KeyCodes.h"
 #include "GameEngine/MouseButtonCodes.h"
 
 #include "GameEngine/ImGui/ImGuiLayer.h"
+#include "GameEngine/ImGui/StatisticsOverlay.h"
+
+#include "GameEngine/Asset/AssetManager.h"
+
+#include "GameEngine/Math/MathKernels.h"
+
+#include "GameEngine/Physics/CollisionWorld.h"
 
 // ---------- Renderer ----------
 #include "GameEngine/Renderer/Renderer.h"
+#include "GameEngine/Renderer/Renderer2D.h"
 #include "GameEngine/Renderer/RenderCommand.h"
 
 #include "GameEngine/Renderer/Buffer.h"
+#include "GameEngine/Renderer/VertexPacking.h"
+#include "GameEngine/Renderer/MeshOptimizer.h"
 #include "GameEngine/Renderer/Shader.h"
+#include "GameEngine/Renderer/ShaderFile.h"
+#include "GameEngine/Renderer/Material.h"
+#include "GameEngine/Renderer/MultiDrawBatch.h"
+#include "GameEngine/Renderer/CulledInstanceBatch.h"
+#include "GameEngine/Renderer/UniformBuffer.h"
+#include "GameEngine/Renderer/StorageBuffer.h"
 #include "GameEngine/Renderer/VertexArray.h"
+#include "GameEngine/Renderer/Texture.h"
+#include "GameEngine/Renderer/TextureLibrary.h"
+#include "GameEngine/Renderer/Framebuffer.h"
+#include "GameEngine/Renderer/GPUTimer.h"
+#include "GameEngine/Renderer/GPUFence.h"
+#include "GameEngine/Renderer/ResourceLoader.h"
+#include "GameEngine/Renderer/DynamicResolution.h"
+#include "GameEngine/Renderer/RenderCapture.h"
+#include "GameEngine/Renderer/SpriteAtlas.h"
+#include "GameEngine/Renderer/Font.h"
+#include "GameEngine/Renderer/Tilemap.h"
+#include "GameEngine/Renderer/ParticleSystem.h"
 
+#include "GameEngine/Renderer/Camera.h"
 #include "GameEngine/Renderer/OrthographicCamera.h"
+#include "GameEngine/Renderer/PerspectiveCamera.h"
 // ----------------------------------------
 
 
@@ -5,32 +5,103 @@
 
 #include <glad/glad.h>
 #include "GameEngine/Renderer/Renderer.h"
+#include "GameEngine/Renderer/Renderer2D.h"
+#include "GameEngine/Renderer/RenderCapture.h"
+#include "GameEngine/Renderer/ResourceLoader.h"
+#include "GameEngine/Asset/AssetManager.h"
+#include "GameEngine/Core/JobSystem.h"
+#include "GameEngine/Core/Coroutine.h"
 
 #include "Input.h"
 
-#include <GLFW/glfw3.h>
+#include <chrono>
+#include <fstream>
 
 namespace GameEngine {
 
 	Application* Application::s_Instance = nullptr;
+	ApplicationCommandLine Application::s_CommandLine;
+
+	// Da ridotta a icona l'applicazione si sveglia comunque con questo intervallo (in secondi),
+	// per consegnare il lavoro degli altri thread.
+	static const float s_MinimizedWakeInterval = 0.25f;
+
+	// Oltre questo numero di elementi in attesa Post fallisce: i produttori non possono far crescere la coda senza limiti.
+	static const uint32_t s_MainThreadQueueCapacity = 4096;
+
+	ApplicationCommandLine ApplicationCommandLine::Parse(int argc, char** argv)
+	{
+		ApplicationCommandLine commandLine;
+		for (int i = 1; i < argc; i++)
+		{
+			std::string argument = argv[i];
+			if (argument == "--headless")
+				commandLine.Headless = true;
+			else if (argument == "--frames" && i + 1 < argc)
+				commandLine.FrameCount = (uint32_t)std::stoul(argv[++i]);
+			else if (argument == "--stats" && i + 1 < argc)
+				commandLine.StatsPath = argv[++i];
+			else if (argument == "--csv" && i + 1 < argc)
+				commandLine.CsvPath = argv[++i];
+			else if (argument == "--capture" && i + 1 < argc)
+				commandLine.CapturePath = argv[++i];
+			else if (argument == "--capture-frames" && i + 1 < argc)
+				commandLine.CaptureFrames = (uint32_t)std::stoul(argv[++i]);
+			else if (argument == "--unfocused-fps" && i + 1 < argc)
+				commandLine.UnfocusedFrameRate = std::stof(argv[++i]);
+			else
+				HZ_CORE_WARN("Unknown command line argument '{0}'", argument);
+		}
+		return commandLine;
+	}
+
+	// Non usiamo glfwGetTime: in modalità headless GLFW non viene inizializzato.
+	float Application::GetTime()
+	{
+		static const auto s_Start = std::chrono::steady_clock::now();
+		return std::chrono::duration<float>(std::chrono::steady_clock::now() - s_Start).count();
+	}
 
 	Application::Application() 
+		: m_MainThreadQueue(s_MainThreadQueueCapacity)
 	{
 		// Prima ci assicuriamo che l'applicazione non sia già stata istanziata.
 		// Se non lo è, la instanziamo nel costruttore.
 		HZ_CORE_ASSERT(!s_Instance, "Application already exists!");
 		s_Instance = this;
 
-		m_Window = std::unique_ptr<Window>(Window::Create());
+		WindowProps props;
+		props.Headless = s_CommandLine.Headless;
+		m_Window = std::unique_ptr<Window>(Window::Create(props));
 		m_Window->SetEventCallback(HZ_BIND_EVENT_FN(Application::OnEvent));
+		m_IdleSettings.UnfocusedFrameRate = s_CommandLine.UnfocusedFrameRate;
+
+		// La cattura parte prima di Renderer::Init: le risorse create all'avvio devono finire nel file.
+		if (!s_CommandLine.CapturePath.empty())
+			RenderCapture::Begin(s_CommandLine.CapturePath, s_CommandLine.CaptureFrames, m_Window->GetWidth(), m_Window->GetHeight());
+
+		JobSystem::Init();
+		CoroutineScheduler::Init();
+		AssetManager::Init();
+		Renderer::Init();
+		ResourceLoader::Init(m_Window->GetContext());
 
 		m_ImGuiLayer = new ImGuiLayer();
 		PushOverlay(m_ImGuiLayer);
+
+		m_StatisticsOverlay = new StatisticsOverlay();
+		PushOverlay(m_StatisticsOverlay);
 	}
 
 	Application::~Application()
 	{
-
+		RenderCapture::End();
+		// Le coroutine sospese possono tenere in vita risorse del renderer e attendere job del JobSystem.
+		CoroutineScheduler::Shutdown();
+		ResourceLoader::Shutdown();
+		Renderer::Shutdown();
+		AssetManager::Shutdown();
+		JobSystem::Shutdown();
 	}
 
 	void Application::PushLayer(Layer* layer)
@@ -50,6 +121,10 @@ namespace GameEngine {
 		EventDispatcher dispatcher(e);
 		// Se l'evento e è di tipo WindowCloseEvent, il dispatcher chiamerà OnWindowClose()
 		dispatcher.Dispatch<WindowCloseEvent>(HZ_BIND_EVENT_FN(Application::OnWindowClose));
+		dispatcher.Dispatch<WindowResizeEvent>(HZ_BIND_EVENT_FN(Application::OnWindowResize));
+		dispatcher.Dispatch<WindowIconifyEvent>(HZ_BIND_EVENT_FN(Application::OnWindowIconify));
+		dispatcher.Dispatch<WindowFocusEvent>(HZ_BIND_EVENT_FN(Application::OnWindowFocus));
+		dispatcher.Dispatch<WindowLostFocusEvent>(HZ_BIND_EVENT_FN(Application::OnWindowLostFocus));
 
 		for (auto it = m_LayerStack.rbegin(); it != m_LayerStack.rend(); ++it)
 		{
@@ -60,30 +135,213 @@ namespace GameEngine {
 		}
 	}
 
+	bool Application::Post(std::function<void()> task)
+	{
+		if (m_MainThreadQueue.TryPush(std::move(task)))
+			return true;
+
+		m_MainThreadQueueRejected.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	void Application::DrainMainThreadQueue()
+	{
+		// Solo gli elementi presenti ora: una funzione che ripubblica se stessa viene eseguita al frame successivo.
+		uint32_t count = m_MainThreadQueue.GetSize();
+		m_MainThreadQueueHighWatermark = std::max(m_MainThreadQueueHighWatermark, count);
+
+		m_MainThreadQueueDrained = 0;
+		std::function<void()> task;
+		while (m_MainThreadQueueDrained < count && m_MainThreadQueue.TryPop(task))
+		{
+			task();
+			m_MainThreadQueueDrained++;
+		}
+	}
+
+	Application::MainThreadQueueStatistics Application::GetMainThreadQueueStats() const
+	{
+		MainThreadQueueStatistics stats;
+		stats.Capacity = m_MainThreadQueue.GetCapacity();
+		stats.Posted = m_MainThreadQueue.GetPushCount();
+		stats.Rejected = m_MainThreadQueueRejected.load(std::memory_order_relaxed);
+		stats.Drained = m_MainThreadQueueDrained;
+		stats.HighWatermark = m_MainThreadQueueHighWatermark;
+		return stats;
+	}
+
 	bool Application::OnWindowClose(WindowCloseEvent& e)
 	{
 		m_Running = false;
 		return true;
 	}
 
+	// Gli eventi della finestra proseguono verso i layer: qui registriamo solo lo stato.
+	bool Application::OnWindowResize(WindowResizeEvent& e)
+	{
+		// Su alcune piattaforme la finestra ridotta a icona arriva solo come area client di 0x0.
+		m_Minimized = e.GetWidth() == 0 || e.GetHeight() == 0;
+		return false;
+	}
+
+	bool Application::OnWindowIconify(WindowIconifyEvent& e)
+	{
+		m_Minimized = e.IsIconified();
+		return false;
+	}
+
+	bool Application::OnWindowFocus(WindowFocusEvent& e)
+	{
+		m_Focused = true;
+		return false;
+	}
+
+	bool Application::OnWindowLostFocus(WindowLostFocusEvent& e)
+	{
+		m_Focused = false;
+		return false;
+	}
+
 	void Application::Run()
 	{
+		const uint32_t frameCount = s_CommandLine.FrameCount;
+		const bool recordCsv = !s_CommandLine.CsvPath.empty();
+		if (frameCount > 0)
+		{
+			m_FrameTimes.reserve(frameCount);
+			if (recordCsv)
+				m_FrameStats.reserve(frameCount);
+		}
+
+		m_LastFrameTime = GetTime();
 		while (m_Running)
 		{
-			float time = (float)glfwGetTime();
+			// Niente da mostrare: nessun frame, quindi niente lavoro per CPU e GPU finché non arriva un evento.
+			if (m_Minimized && m_IdleSettings.PauseWhenMinimized && !m_Window->IsHeadless())
+			{
+				m_Window->WaitEvents(s_MinimizedWakeInterval);
+				ResourceLoader::ProcessCompletions();
+				DrainMainThreadQueue();
+				// Il primo timestep dopo il ripristino non deve comprendere la pausa.
+				m_LastFrameTime = GetTime();
+				continue;
+			}
+
+			float time = GetTime();
 			Timestep timestep = time - m_LastFrameTime;
 			m_LastFrameTime = time;
 
+			Renderer::ResetStats();
+			Renderer2D::ResetStats();
+
+			// Le risorse caricate in background e già pronte sulla GPU vengono consegnate prima dei layer.
+			ResourceLoader::ProcessCompletions();
+			DrainMainThreadQueue();
+			CoroutineScheduler::Update();
+
 			for (Layer* layer : m_LayerStack)
 				layer->OnUpdate(timestep);
 			
-			m_ImGuiLayer->Begin();
-			for (Layer* layer : m_LayerStack)
-				layer->OnImGuiRender();
+			// Con la cache dell'ImGuiLayer l'UI viene ricostruita solo quando serve.
+			if (m_ImGuiLayer->Begin())
+			{
+				for (Layer* layer : m_LayerStack)
+					layer->OnImGuiRender();
+			}
 			m_ImGuiLayer->End();
 
 			m_Window->OnUpdate();
+			RenderCapture::EndFrame();
+
+			// Il tempo misurato comprende l'intero frame, swap (o glFinish in headless) incluso.
+			float frameTime = (GetTime() - time) * 1000.0f;
+			m_FrameTimeTracker.AddFrame(frameTime);
+
+			if (frameCount > 0 || recordCsv)
+			{
+				m_FrameTimes.push_back(frameTime);
+				if (recordCsv)
+					m_FrameStats.push_back(Renderer::GetStats());
+				if (frameCount > 0 && m_FrameTimes.size() >= frameCount)
+					m_Running = false;
+			}
+
+			// Senza focus il resto del periodo si passa in attesa di eventi, che vengono comunque consegnati subito.
+			// Il frame successivo parte alla scadenza, o prima se la finestra ritrova il focus (o viene chiusa).
+			// Il tempo di attesa non entra nelle statistiche del frame.
+			if (!m_Focused && m_IdleSettings.UnfocusedFrameRate > 0.0f && !m_Window->IsHeadless())
+			{
+				float nextFrameTime = time + 1.0f / m_IdleSettings.UnfocusedFrameRate;
+				float remaining;
+				while (!m_Focused && m_Running && (remaining = nextFrameTime - GetTime()) > 0.0f)
+					m_Window->WaitEvents(remaining);
+			}
 		}
+
+		if (frameCount > 0)
+			ReportFrameTimes();
+		if (recordCsv)
+			WriteFrameCsv();
+	}
+
+	void Application::WriteFrameCsv() const
+	{
+		std::ofstream out(s_CommandLine.CsvPath);
+		if (!out)
+		{
+			HZ_CORE_ERROR("Could not write frame statistics to '{0}'", s_CommandLine.CsvPath);
+			return;
+		}
+
+		out << "frame,frame_ms,draw_calls,indices,vertices,state_changes,shader_binds,bytes_uploaded\n";
+		for (size_t i = 0; i < m_FrameStats.size(); i++)
+		{
+			const Renderer::Statistics& stats = m_FrameStats[i];
+			out << i << ',' << m_FrameTimes[i] << ',' << stats.DrawCalls << ',' << stats.Indices << ',' << stats.Vertices << ','
+				<< stats.StateChanges << ',' << stats.ShaderBinds << ',' << stats.BufferBytesUploaded << '\n';
+		}
+
+		HZ_CORE_INFO("Wrote {0} frames to '{1}'", m_FrameStats.size(), s_CommandLine.CsvPath);
+	}
+
+	void Application::ReportFrameTimes() const
+	{
+		if (m_FrameTimes.empty())
+			return;
+
+		std::vector<float> sorted = m_FrameTimes;
+		std::sort(sorted.begin(), sorted.end());
+		auto percentile = [&sorted](float p) { return sorted[std::min((size_t)(p * sorted.size()), sorted.size() - 1)]; };
+
+		double total = 0.0;
+		for (float frameTime : m_FrameTimes)
+			total += frameTime;
+		float average = (float)(total / m_FrameTimes.size());
+
+		HZ_CORE_INFO("{0} frames in {1:.1f} ms: avg {2:.3f} ms ({3:.1f} FPS), min {4:.3f}, p50 {5:.3f}, p95 {6:.3f}, p99 {7:.3f}, max {8:.3f}",
+			m_FrameTimes.size(), total, average, 1000.0f / average, sorted.front(), percentile(0.5f), percentile(0.95f), percentile(0.99f), sorted.back());
+
+		if (s_CommandLine.StatsPath.empty())
+			return;
+
+		std::ofstream out(s_CommandLine.StatsPath);
+		if (!out)
+		{
+			HZ_CORE_ERROR("Could not write frame statistics to '{0}'", s_CommandLine.StatsPath);
+			return;
+		}
+
+		out << "{\n"
+			<< "\t\"frames\": " << m_FrameTimes.size() << ",\n"
+			<< "\t\"headless\": " << (m_Window->IsHeadless() ? "true" : "false") << ",\n"
+			<< "\t\"total_ms\": " << total << ",\n"
+			<< "\t\"avg_ms\": " << average << ",\n"
+			<< "\t\"min_ms\": " << sorted.front() << ",\n"
+			<< "\t\"p50_ms\": " << percentile(0.5f) << ",\n"
+			<< "\t\"p95_ms\": " << percentile(0.95f) << ",\n"
+			<< "\t\"p99_ms\": " << percentile(0.99f) << ",\n"
+			<< "\t\"max_ms\": " << sorted.back() << "\n"
+			<< "}\n";
 	}
 
 }
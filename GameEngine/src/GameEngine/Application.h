@@ -8,11 +8,36 @@
 #include "GameEngine/Events/ApplicationEvent.h"
 
 #include "GameEngine/Core/Timestep.h"
+#include "GameEngine/Core/FrameTimeTracker.h"
+#include "GameEngine/Core/MPSCQueue.h"
+#include "GameEngine/Renderer/Renderer.h"
 
 #include "ImGui/ImGuiLayer.h"
+#include "ImGui/StatisticsOverlay.h"
 
 namespace GameEngine {
 
+	// Opzioni lette dalla riga di comando in EntryPoint, prima di creare l'applicazione.
+	struct ApplicationCommandLine
+	{
+		// --headless: nessuna finestra visibile, contesto OpenGL offscreen.
+		bool Headless = false;
+		// --frames N: esce dopo N frame e stampa le statistiche sui tempi per frame (0 = nessun limite).
+		uint32_t FrameCount = 0;
+		// --stats <file>: salva le statistiche anche in un file JSON.
+		std::string StatsPath;
+		// --csv <file>: all'uscita scrive una riga per frame con tempo e contatori del renderer.
+		std::string CsvPath;
+		// --capture <file>: registra i comandi del renderer dei primi frame, da rieseguire con Benchmarks --replay.
+		std::string CapturePath;
+		// --capture-frames N: numero di frame registrati con --capture.
+		uint32_t CaptureFrames = 60;
+		// --unfocused-fps N: frame al secondo quando la finestra non ha il focus (0 = nessun limite).
+		float UnfocusedFrameRate = 10.0f;
+
+		static ApplicationCommandLine Parse(int argc, char** argv);
+	};
+
 	class Application
 	{
 	public:
@@ -26,24 +51,92 @@ namespace GameEngine {
 		void PushLayer(Layer* layer);
 		void PushOverlay(Layer* layer);
 
+		// Da qualunque thread: la funzione viene eseguita sul thread principale all'inizio del prossimo frame,
+		// prima dei layer. Restituisce false se la coda è piena; il chiamante decide se riprovare o rinunciare.
+		bool Post(std::function<void()> task);
+		// Da qualunque thread: l'evento arriva a OnEvent sul thread principale, come quelli della finestra.
+		template<typename T, typename... Args>
+		bool PostEvent(Args&&... args)
+		{
+			Ref<T> event = std::make_shared<T>(std::forward<Args>(args)...);
+			return Post([this, event]() { OnEvent(*event); });
+		}
+
+		struct MainThreadQueueStatistics
+		{
+			uint32_t Capacity = 0;
+			uint64_t Posted = 0;
+			// Post falliti perché la coda era piena.
+			uint64_t Rejected = 0;
+			// Elementi eseguiti nell'ultimo frame e massimo trovato in coda a inizio frame.
+			uint32_t Drained = 0;
+			uint32_t HighWatermark = 0;
+		};
+		MainThreadQueueStatistics GetMainThreadQueueStats() const;
+
+		// Comportamento del loop quando non c'è niente da mostrare. Non si applica in modalità headless.
+		struct IdleSettings
+		{
+			// Finestra ridotta a icona: nessun frame, il thread dorme in attesa di eventi.
+			// Continuano solo le completion del ResourceLoader e la coda del thread principale; layer e coroutine si fermano.
+			bool PauseWhenMinimized = true;
+			// Finestra senza focus: al massimo UnfocusedFrameRate frame al secondo (0 = nessun limite).
+			float UnfocusedFrameRate = 10.0f;
+		};
+		inline IdleSettings& GetIdleSettings() { return m_IdleSettings; }
+		inline bool IsMinimized() const { return m_Minimized; }
+		inline bool IsFocused() const { return m_Focused; }
+
 		// Vogliamo richiamare il singleton di Application
 		// da qualsiasi punto del programma.
 		inline static Application& Get() { return *s_Instance; }
 
 		inline Window& GetWindow() { return *m_Window; }
+		inline ImGuiLayer* GetImGuiLayer() { return m_ImGuiLayer; }
+		inline const FrameTimeTracker& GetFrameTimeTracker() const { return m_FrameTimeTracker; }
+
+		// Tempo in secondi dall'avvio.
+		static float GetTime();
+
+		static void SetCommandLine(const ApplicationCommandLine& commandLine) { s_CommandLine = commandLine; }
+		inline static const ApplicationCommandLine& GetCommandLine() { return s_CommandLine; }
 
 	private:
 		bool OnWindowClose(WindowCloseEvent& e);
+		bool OnWindowResize(WindowResizeEvent& e);
+		bool OnWindowIconify(WindowIconifyEvent& e);
+		bool OnWindowFocus(WindowFocusEvent& e);
+		bool OnWindowLostFocus(WindowLostFocusEvent& e);
+		void DrainMainThreadQueue();
+		void ReportFrameTimes() const;
+		void WriteFrameCsv() const;
 
 	private:
 		std::unique_ptr<Window> m_Window;
 		ImGuiLayer* m_ImGuiLayer;
+		StatisticsOverlay* m_StatisticsOverlay;
 		bool m_Running = true;
+		bool m_Minimized = false;
+		bool m_Focused = true;
+		IdleSettings m_IdleSettings;
 		LayerStack m_LayerStack;
 		float m_LastFrameTime = 0.0f;
+		// Ultimi frame, sempre registrati: alimentano StatisticsOverlay.
+		FrameTimeTracker m_FrameTimeTracker;
+		// Storia completa in millisecondi, registrata solo con --frames o --csv.
+		std::vector<float> m_FrameTimes;
+		// Contatori del renderer per ogni frame, solo con --csv.
+		std::vector<Renderer::Statistics> m_FrameStats;
+
+		// Funzioni ed eventi inviati al thread principale da altri thread.
+		MPSCQueue<std::function<void()>> m_MainThreadQueue;
+		std::atomic<uint64_t> m_MainThreadQueueRejected{ 0 };
+		uint32_t m_MainThreadQueueDrained = 0;
+		uint32_t m_MainThreadQueueHighWatermark = 0;
 
 	private:
 		static Application* s_Instance;
+		static ApplicationCommandLine s_CommandLine;
 	};
 
 	// To be defined in CLIENT
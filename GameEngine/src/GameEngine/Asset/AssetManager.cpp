@@ -0,0 +1,263 @@
+#include "hzpch.h"
+#include "AssetManager.h"
+
+#include <fstream>
+
+namespace GameEngine {
+
+	struct AssetSlot
+	{
+		Ref<void> Asset;
+		std::type_index Type = typeid(void);
+		AssetKey Key = 0;
+		uint64_t Size = 0;
+		uint32_t Generation = 1;
+		uint32_t RefCount = 0;
+
+		// Posizione nella lista LRU, valida solo se RefCount == 0.
+		std::list<uint32_t>::iterator LRUPosition;
+	};
+
+	struct AssetManagerData
+	{
+		std::vector<AssetSlot> Slots;
+		std::vector<uint32_t> FreeSlots;
+		std::unordered_map<AssetKey, uint32_t> SlotByKey;
+
+		// In testa gli asset rilasciati più di recente, in coda i candidati all'eviction.
+		std::list<uint32_t> LRU;
+
+		uint64_t MemoryUsage = 0;
+		uint64_t MemoryBudget = 0;
+
+		AssetManager::Statistics Stats;
+	};
+
+	static AssetManagerData* s_Data = nullptr;
+
+	void AssetManager::Init(uint64_t memoryBudget)
+	{
+		s_Data = new AssetManagerData();
+		s_Data->MemoryBudget = memoryBudget;
+	}
+
+	void AssetManager::Shutdown()
+	{
+		delete s_Data;
+		s_Data = nullptr;
+	}
+
+	AssetKey AssetManager::HashKey(const std::string& text, AssetKey seed)
+	{
+		// FNV-1a a 64 bit: veloce e sufficiente per distinguere percorsi e sorgenti.
+		AssetKey hash = seed;
+		for (char c : text)
+		{
+			hash ^= (uint8_t)c;
+			hash *= 1099511628211ull;
+		}
+		return hash;
+	}
+
+	AssetHandle AssetManager::LoadImpl(AssetKey key, std::type_index type, const std::function<Ref<void>(uint64_t&)>& loader)
+	{
+		HZ_CORE_ASSERT(s_Data, "AssetManager not initialized!");
+
+		auto it = s_Data->SlotByKey.find(key);
+		if (it != s_Data->SlotByKey.end())
+		{
+			AssetSlot& slot = s_Data->Slots[it->second];
+			HZ_CORE_ASSERT(slot.Type == type, "Asset key already used by a different asset type!");
+
+			if (slot.RefCount++ == 0)
+				s_Data->LRU.erase(slot.LRUPosition);
+
+			s_Data->Stats.Hits++;
+			return { it->second, slot.Generation };
+		}
+
+		s_Data->Stats.Misses++;
+
+		uint64_t size = 0;
+		Ref<void> asset = loader(size);
+		if (!asset)
+			return {};
+
+		uint32_t index;
+		if (!s_Data->FreeSlots.empty())
+		{
+			index = s_Data->FreeSlots.back();
+			s_Data->FreeSlots.pop_back();
+		}
+		else
+		{
+			index = (uint32_t)s_Data->Slots.size();
+			s_Data->Slots.emplace_back();
+		}
+
+		AssetSlot& slot = s_Data->Slots[index];
+		slot.Asset = asset;
+		slot.Type = type;
+		slot.Key = key;
+		slot.Size = size;
+		slot.RefCount = 1;
+
+		s_Data->SlotByKey[key] = index;
+		s_Data->MemoryUsage += size;
+
+		// Il nuovo asset potrebbe aver superato il budget: facciamo spazio tra quelli non referenziati.
+		EvictUnreferenced();
+
+		return { index, slot.Generation };
+	}
+
+	Ref<void> AssetManager::GetImpl(AssetHandle handle, std::type_index type)
+	{
+		if (!s_Data || !handle.IsValid() || handle.Index >= s_Data->Slots.size())
+			return nullptr;
+
+		const AssetSlot& slot = s_Data->Slots[handle.Index];
+		if (slot.Generation != handle.Generation || slot.Type != type)
+			return nullptr;
+
+		return slot.Asset;
+	}
+
+	void AssetManager::Retain(AssetHandle handle)
+	{
+		if (!s_Data || !handle.IsValid() || handle.Index >= s_Data->Slots.size())
+			return;
+
+		AssetSlot& slot = s_Data->Slots[handle.Index];
+		if (slot.Generation != handle.Generation)
+			return;
+
+		if (slot.RefCount++ == 0)
+			s_Data->LRU.erase(slot.LRUPosition);
+	}
+
+	void AssetManager::Release(AssetHandle handle)
+	{
+		// I layer possono essere distrutti dopo lo Shutdown dell'AssetManager.
+		if (!s_Data || !handle.IsValid() || handle.Index >= s_Data->Slots.size())
+			return;
+
+		AssetSlot& slot = s_Data->Slots[handle.Index];
+		if (slot.Generation != handle.Generation || slot.RefCount == 0)
+			return;
+
+		if (--slot.RefCount == 0)
+		{
+			s_Data->LRU.push_front(handle.Index);
+			slot.LRUPosition = s_Data->LRU.begin();
+			EvictUnreferenced();
+		}
+	}
+
+	void AssetManager::EvictUnreferenced()
+	{
+		while (s_Data->MemoryUsage > s_Data->MemoryBudget && !s_Data->LRU.empty())
+		{
+			uint32_t index = s_Data->LRU.back();
+			s_Data->LRU.pop_back();
+
+			AssetSlot& slot = s_Data->Slots[index];
+			s_Data->MemoryUsage -= slot.Size;
+			s_Data->SlotByKey.erase(slot.Key);
+
+			slot.Asset.reset();
+			slot.Size = 0;
+			// Invalida tutti gli handle ancora in circolazione per questo slot.
+			slot.Generation++;
+			if (slot.Generation == 0)
+				slot.Generation = 1;
+
+			s_Data->FreeSlots.push_back(index);
+			s_Data->Stats.Evictions++;
+		}
+	}
+
+	void AssetManager::SetMemoryBudget(uint64_t bytes)
+	{
+		s_Data->MemoryBudget = bytes;
+		EvictUnreferenced();
+	}
+
+	AssetHandle AssetManager::LoadShader(const std::string& vertexSrc, const std::string& fragmentSrc)
+	{
+		AssetKey key = HashKey(fragmentSrc, HashKey(vertexSrc, HashKey("shader:")));
+		return Load<Shader>(key, [&](uint64_t& outSize)
+		{
+			// La dimensione reale del program dipende dal driver: usiamo quella dei sorgenti come stima.
+			outSize = vertexSrc.size() + fragmentSrc.size();
+			return Ref<Shader>(Shader::Create(vertexSrc, fragmentSrc));
+		});
+	}
+
+	AssetHandle AssetManager::LoadShaderFile(const std::string& path)
+	{
+		return Load<ShaderFile>(HashKey(path, HashKey("shaderfile:")), [&](uint64_t& outSize) -> Ref<ShaderFile>
+		{
+			Ref<ShaderFile> shaderFile = std::make_shared<ShaderFile>(path);
+			if (!shaderFile->IsLoaded())
+				return nullptr;
+
+			outSize = shaderFile->GetSourceSize();
+			return shaderFile;
+		});
+	}
+
+	AssetHandle AssetManager::LoadFile(const std::string& path)
+	{
+		return Load<std::vector<uint8_t>>(HashKey(path, HashKey("file:")), [&](uint64_t& outSize) -> Ref<std::vector<uint8_t>>
+		{
+			Ref<std::vector<uint8_t>> data = ReadFile(path);
+			if (data)
+				outSize = data->size();
+			return data;
+		});
+	}
+
+	AssetHandle AssetManager::AddFile(const std::string& path, const Ref<std::vector<uint8_t>>& contents)
+	{
+		return Load<std::vector<uint8_t>>(HashKey(path, HashKey("file:")), [&](uint64_t& outSize) -> Ref<std::vector<uint8_t>>
+		{
+			if (contents)
+				outSize = contents->size();
+			return contents;
+		});
+	}
+
+	Ref<std::vector<uint8_t>> AssetManager::ReadFile(const std::string& path)
+	{
+		std::ifstream in(path, std::ios::in | std::ios::binary);
+		if (!in)
+		{
+			HZ_CORE_ERROR("Could not open file '{0}'", path);
+			return nullptr;
+		}
+
+		Ref<std::vector<uint8_t>> data = std::make_shared<std::vector<uint8_t>>();
+		in.seekg(0, std::ios::end);
+		data->resize((size_t)in.tellg());
+		in.seekg(0, std::ios::beg);
+		in.read((char*)data->data(), data->size());
+		return data;
+	}
+
+	AssetManager::Statistics AssetManager::GetStats()
+	{
+		Statistics stats = s_Data->Stats;
+		stats.LoadedAssets = (uint32_t)s_Data->SlotByKey.size();
+		stats.UnreferencedAssets = (uint32_t)s_Data->LRU.size();
+		stats.MemoryUsage = s_Data->MemoryUsage;
+		stats.MemoryBudget = s_Data->MemoryBudget;
+		return stats;
+	}
+
+	void AssetManager::ResetStats()
+	{
+		s_Data->Stats = Statistics();
+	}
+
+}
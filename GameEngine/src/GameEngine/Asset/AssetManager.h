@@ -0,0 +1,96 @@
+#pragma once
+
+#include "GameEngine/Core.h"
+#include "GameEngine/Renderer/Shader.h"
+#include "GameEngine/Renderer/ShaderFile.h"
+
+#include <list>
+#include <typeindex>
+
+namespace GameEngine {
+
+	// Handle leggero verso un asset. La generation permette di riconoscere gli handle
+	// "scaduti": quando uno slot viene liberato (eviction) la sua generation aumenta
+	// e tutti gli handle che puntavano al vecchio contenuto diventano invalidi.
+	struct AssetHandle
+	{
+		uint32_t Index = 0;
+		uint32_t Generation = 0;
+
+		// La generation 0 non viene mai assegnata, quindi un handle costruito di default è nullo.
+		inline bool IsValid() const { return Generation != 0; }
+
+		bool operator==(const AssetHandle& other) const { return Index == other.Index && Generation == other.Generation; }
+		bool operator!=(const AssetHandle& other) const { return !(*this == other); }
+	};
+
+	using AssetKey = uint64_t;
+
+	// Cache degli asset condivisa da tutta l'applicazione.
+	// - Load*() deduplica per chiave (percorso o hash del contenuto) e incrementa il reference count.
+	// - Release() lo decrementa: a 0 l'asset non viene distrutto subito ma finisce in una lista LRU,
+	//   così un nuovo Load() della stessa chiave (ad es. ricaricando un livello) è un hit.
+	// - Gli asset non referenziati vengono distrutti, dal meno recente, solo quando
+	//   la memoria occupata supera il budget.
+	class AssetManager
+	{
+	public:
+		struct Statistics
+		{
+			uint64_t Hits = 0;
+			uint64_t Misses = 0;
+			uint64_t Evictions = 0;
+
+			uint32_t LoadedAssets = 0;
+			uint32_t UnreferencedAssets = 0;
+			uint64_t MemoryUsage = 0;
+			uint64_t MemoryBudget = 0;
+		};
+
+		static void Init(uint64_t memoryBudget = 256ull * 1024 * 1024);
+		static void Shutdown();
+
+		// loader viene chiamato solo in caso di miss e deve restituire l'asset e la sua dimensione stimata in byte.
+		template<typename T>
+		static AssetHandle Load(AssetKey key, const std::function<Ref<T>(uint64_t& outSize)>& loader)
+		{
+			return LoadImpl(key, typeid(T), [&loader](uint64_t& outSize) -> Ref<void> { return loader(outSize); });
+		}
+
+		// Restituisce nullptr se l'handle è nullo, scaduto o di un altro tipo.
+		template<typename T>
+		static Ref<T> Get(AssetHandle handle)
+		{
+			return std::static_pointer_cast<T>(GetImpl(handle, typeid(T)));
+		}
+
+		// Shader identificati dall'hash dei sorgenti: due layer con lo stesso codice condividono lo stesso program.
+		static AssetHandle LoadShader(const std::string& vertexSrc, const std::string& fragmentSrc);
+		// File .glsl identificati dal percorso: le varianti compilate restano nel ShaderFile condiviso.
+		static AssetHandle LoadShaderFile(const std::string& path);
+		// Contenuto di un file su disco, identificato dal percorso.
+		static AssetHandle LoadFile(const std::string& path);
+		// Come LoadFile, con il contenuto già letto (ad es. da ReadFile su un worker).
+		// Se il file è già in cache il contenuto passato viene ignorato.
+		static AssetHandle AddFile(const std::string& path, const Ref<std::vector<uint8_t>>& contents);
+		// Legge il file senza passare dalla cache: l'unica funzione dell'AssetManager chiamabile da qualunque thread.
+		static Ref<std::vector<uint8_t>> ReadFile(const std::string& path);
+
+		// Incrementa il reference count di un handle già ottenuto (ad es. per condividerlo con un altro layer).
+		static void Retain(AssetHandle handle);
+		static void Release(AssetHandle handle);
+
+		static void SetMemoryBudget(uint64_t bytes);
+
+		static AssetKey HashKey(const std::string& text, AssetKey seed = 14695981039346656037ull);
+
+		static Statistics GetStats();
+		static void ResetStats();
+
+	private:
+		static AssetHandle LoadImpl(AssetKey key, std::type_index type, const std::function<Ref<void>(uint64_t&)>& loader);
+		static Ref<void> GetImpl(AssetHandle handle, std::type_index type);
+		static void EvictUnreferenced();
+	};
+
+}
@@ -12,8 +12,17 @@
 #else 
 	#define HAZEL_API
 #endif
+#elif defined(HZ_PLATFORM_LINUX)
+	#define HAZEL_API
+#else
+	#error GameEngine only supports Windows and Linux!
+#endif
+
+#ifdef HZ_PLATFORM_WINDOWS
+	#define HZ_DEBUGBREAK() __debugbreak()
 #else
-	#error GameEngine only support Windows!
+	#include <csignal>
+	#define HZ_DEBUGBREAK() raise(SIGTRAP)
 #endif
 
 #ifdef HZ_DEBUG
@@ -22,8 +31,8 @@
 
 
 #ifdef HZ_ENABLE_ASSERTS
-	#define HZ_ASSERT(x, ...) { if(!(x)) { HZ_ERROR("Assertion Failed: {0}", __VA_ARGS__); __debugbreak(); } }
-	#define HZ_CORE_ASSERT(x, ...) { if(!(x)) { HZ_CORE_ERROR("Assertion Failed: {0}", __VA_ARGS__); __debugbreak(); } }
+	#define HZ_ASSERT(x, ...) { if(!(x)) { HZ_ERROR("Assertion Failed: {0}", __VA_ARGS__); HZ_DEBUGBREAK(); } }
+	#define HZ_CORE_ASSERT(x, ...) { if(!(x)) { HZ_CORE_ERROR("Assertion Failed: {0}", __VA_ARGS__); HZ_DEBUGBREAK(); } }
 #else
 	#define HZ_ASSERT(x, ...)
 	#define HZ_CORE_ASSERT(x, ...)
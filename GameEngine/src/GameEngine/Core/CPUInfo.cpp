@@ -0,0 +1,82 @@
+#include "hzpch.h"
+#include "CPUInfo.h"
+
+#ifdef HZ_ARCH_X64
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+	#else
+		#include <cpuid.h>
+	#endif
+#endif
+
+namespace GameEngine {
+
+#ifdef HZ_ARCH_X64
+	static void CPUID(int leaf, int subleaf, int registers[4])
+	{
+#if defined(_MSC_VER)
+		__cpuidex(registers, leaf, subleaf);
+#else
+		unsigned int eax, ebx, ecx, edx;
+		__cpuid_count(leaf, subleaf, eax, ebx, ecx, edx);
+		registers[0] = (int)eax; registers[1] = (int)ebx; registers[2] = (int)ecx; registers[3] = (int)edx;
+#endif
+	}
+
+	// Registro XCR0: indica quali registri estesi il sistema operativo salva nei context switch.
+	static uint64_t ReadXCR0()
+	{
+#if defined(_MSC_VER)
+		return _xgetbv(0);
+#else
+		unsigned int eax, edx;
+		__asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+		return ((uint64_t)edx << 32) | eax;
+#endif
+	}
+
+	static CPUFeatures DetectFeatures()
+	{
+		CPUFeatures features;
+
+		int regs[4];
+		CPUID(0, 0, regs);
+		int maxLeaf = regs[0];
+
+		CPUID(1, 0, regs);
+		features.SSE41 = (regs[2] & BIT(19)) != 0;
+		bool osxsave = (regs[2] & BIT(27)) != 0;
+		bool avx = (regs[2] & BIT(28)) != 0;
+		bool fma = (regs[2] & BIT(12)) != 0;
+
+		// La CPU può supportare AVX ma il sistema operativo potrebbe non salvare i registri YMM/ZMM.
+		uint64_t xcr0 = osxsave ? ReadXCR0() : 0;
+		bool osYMM = (xcr0 & 0x6) == 0x6;
+		bool osZMM = (xcr0 & 0xE6) == 0xE6;
+
+		features.AVX = avx && osYMM;
+		features.FMA = fma && osYMM;
+
+		if (maxLeaf >= 7)
+		{
+			CPUID(7, 0, regs);
+			features.AVX2 = features.AVX && (regs[1] & BIT(5)) != 0;
+			features.AVX512F = osZMM && (regs[1] & BIT(16)) != 0;
+		}
+
+		return features;
+	}
+#else
+	static CPUFeatures DetectFeatures()
+	{
+		return CPUFeatures();
+	}
+#endif
+
+	const CPUFeatures& CPUInfo::GetFeatures()
+	{
+		static CPUFeatures s_Features = DetectFeatures();
+		return s_Features;
+	}
+
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "GameEngine/Core.h"
+
+#if defined(_M_X64) || defined(__x86_64__)
+	#define HZ_ARCH_X64 1
+#endif
+
+// Le funzioni che usano intrinsics AVX/AVX2/AVX-512 vanno marcate con questi attributi:
+// GCC e Clang altrimenti rifiutano di compilarle senza -mavx globale (che però renderebbe
+// l'intero eseguibile incompatibile con le CPU più vecchie). MSVC non ne ha bisogno.
+#if defined(__GNUC__) || defined(__clang__)
+	#define HZ_TARGET_AVX		__attribute__((target("avx")))
+	#define HZ_TARGET_AVX2		__attribute__((target("avx2,fma")))
+	#define HZ_TARGET_AVX512	__attribute__((target("avx512f")))
+#else
+	#define HZ_TARGET_AVX
+	#define HZ_TARGET_AVX2
+	#define HZ_TARGET_AVX512
+#endif
+
+namespace GameEngine {
+
+	// Set di istruzioni disponibili sulla CPU corrente, rilevati una sola volta tramite CPUID.
+	// Su x64 SSE2 fa parte dell'ABI, quindi è sempre disponibile; sulle altre architetture tutto resta false.
+	struct CPUFeatures
+	{
+		bool SSE41 = false;
+		bool AVX = false;
+		bool AVX2 = false;
+		bool FMA = false;
+		bool AVX512F = false;
+	};
+
+	class CPUInfo
+	{
+	public:
+		static const CPUFeatures& GetFeatures();
+	};
+
+}
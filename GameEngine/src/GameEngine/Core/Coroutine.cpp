@@ -0,0 +1,315 @@
+#include "hzpch.h"
+#include "Coroutine.h"
+
+#include "GameEngine/Application.h"
+#include "GameEngine/Core/JobSystem.h"
+#include "GameEngine/Core/MPSCQueue.h"
+
+#include <thread>
+#include <unordered_map>
+
+namespace GameEngine {
+
+	#pragma region Pool dei frame
+
+	// Liste libere per classi di 64 byte fino a 4 KB: i frame delle coroutine di un layer hanno quasi sempre
+	// la stessa dimensione, quindi dopo i primi avvii ogni allocazione è un pop da una lista.
+	// Usato solo dal thread principale, come le coroutine.
+	struct CoroutineFramePool
+	{
+		static const size_t Granularity = 64;
+		static const size_t ClassCount = 64;
+
+		std::vector<void*> FreeLists[ClassCount];
+		uint64_t Allocations = 0;
+		uint64_t PooledAllocations = 0;
+
+		~CoroutineFramePool()
+		{
+			for (auto& freeList : FreeLists)
+			{
+				for (void* frame : freeList)
+					::operator delete(frame);
+			}
+		}
+	};
+
+	static CoroutineFramePool s_FramePool;
+
+	void* Coroutine::promise_type::operator new(size_t size)
+	{
+		s_FramePool.Allocations++;
+
+		size_t sizeClass = (size + CoroutineFramePool::Granularity - 1) / CoroutineFramePool::Granularity;
+		if (sizeClass >= CoroutineFramePool::ClassCount)
+			return ::operator new(size);
+
+		std::vector<void*>& freeList = s_FramePool.FreeLists[sizeClass];
+		if (freeList.empty())
+			return ::operator new(sizeClass * CoroutineFramePool::Granularity);
+
+		s_FramePool.PooledAllocations++;
+		void* frame = freeList.back();
+		freeList.pop_back();
+		return frame;
+	}
+
+	void Coroutine::promise_type::operator delete(void* frame, size_t size)
+	{
+		size_t sizeClass = (size + CoroutineFramePool::Granularity - 1) / CoroutineFramePool::Granularity;
+		if (sizeClass >= CoroutineFramePool::ClassCount)
+		{
+			::operator delete(frame);
+			return;
+		}
+
+		s_FramePool.FreeLists[sizeClass].push_back(frame);
+	}
+
+	#pragma endregion
+
+	void Coroutine::promise_type::unhandled_exception()
+	{
+		HZ_CORE_ERROR("Unhandled exception in a coroutine");
+		std::terminate();
+	}
+
+	Coroutine& Coroutine::operator=(Coroutine&& other) noexcept
+	{
+		if (this != &other)
+		{
+			if (m_Handle)
+				m_Handle.destroy();
+			m_Handle = other.m_Handle;
+			other.m_Handle = nullptr;
+		}
+		return *this;
+	}
+
+	Coroutine::~Coroutine()
+	{
+		if (m_Handle)
+			m_Handle.destroy();
+	}
+
+	struct CoroutineState
+	{
+		Coroutine::Handle Handle;
+		const void* Owner;
+		// Un worker sta eseguendo un job che scrive nel frame: la distruzione va rimandata al suo termine.
+		bool WaitingWorker = false;
+		// In esecuzione, anche se ha avviato un'altra coroutine che gira in questo momento: il frame è sullo stack
+		// e la distruzione va rimandata alla sospensione.
+		bool Running = false;
+		bool Cancelled = false;
+	};
+
+	struct CoroutineSchedulerData
+	{
+		std::unordered_map<uint64_t, CoroutineState> Coroutines;
+		uint64_t NextID = 1;
+
+		std::vector<uint64_t> NextFrame;
+		std::vector<uint64_t> ResumingNow;
+		std::vector<std::pair<float, uint64_t>> Timers;
+		// Id delle coroutine il cui job è terminato, scritti dai worker.
+		MPSCQueue<uint64_t> FinishedWorkers{ 1024 };
+		uint32_t PendingWorkers = 0;
+
+		CoroutineScheduler::Statistics Stats;
+	};
+
+	static CoroutineSchedulerData* s_Data = nullptr;
+
+	void CoroutineScheduler::Init()
+	{
+		s_Data = new CoroutineSchedulerData();
+	}
+
+	void CoroutineScheduler::Shutdown()
+	{
+		if (!s_Data)
+			return;
+
+		// I job in corso scrivono nei frame: prima di distruggerli aspettiamo che terminino tutti.
+		uint64_t id;
+		while (s_Data->PendingWorkers > 0)
+		{
+			if (s_Data->FinishedWorkers.TryPop(id))
+				s_Data->PendingWorkers--;
+			else
+				std::this_thread::yield();
+		}
+
+		for (auto& [coroutineID, state] : s_Data->Coroutines)
+			state.Handle.destroy();
+
+		delete s_Data;
+		s_Data = nullptr;
+	}
+
+	// Riprende la coroutine e la distrugge se è terminata o è stata cancellata durante l'esecuzione.
+	static void Resume(uint64_t id)
+	{
+		auto it = s_Data->Coroutines.find(id);
+		if (it == s_Data->Coroutines.end())
+			return;
+
+		Coroutine::Handle handle = it->second.Handle;
+		it->second.Running = true;
+		handle.resume();
+		s_Data->Stats.Resumed++;
+
+		// La coroutine può aver avviato altre coroutine: l'iteratore non è più valido.
+		it = s_Data->Coroutines.find(id);
+		it->second.Running = false;
+		if (handle.done() || (it->second.Cancelled && !it->second.WaitingWorker))
+		{
+			handle.destroy();
+			s_Data->Coroutines.erase(it);
+		}
+	}
+
+	uint64_t CoroutineScheduler::Start(Coroutine coroutine, const void* owner)
+	{
+		HZ_CORE_ASSERT(s_Data, "CoroutineScheduler not initialized!");
+
+		Coroutine::Handle handle = coroutine.Release();
+		uint64_t id = s_Data->NextID++;
+		handle.promise().ID = id;
+		s_Data->Coroutines[id] = { handle, owner };
+
+		// Può essere chiamata da un'altra coroutine: dopo la prima sospensione si torna a quella.
+		Resume(id);
+		return id;
+	}
+
+	void CoroutineScheduler::Cancel(uint64_t id)
+	{
+		if (!s_Data)
+			return;
+
+		auto it = s_Data->Coroutines.find(id);
+		if (it == s_Data->Coroutines.end())
+			return;
+
+		CoroutineState& state = it->second;
+		if (state.Running || state.WaitingWorker)
+		{
+			state.Cancelled = true;
+			return;
+		}
+
+		state.Handle.destroy();
+		s_Data->Coroutines.erase(it);
+	}
+
+	void CoroutineScheduler::CancelAll(const void* owner)
+	{
+		if (!s_Data)
+			return;
+
+		std::vector<uint64_t> ids;
+		for (auto& [id, state] : s_Data->Coroutines)
+		{
+			if (state.Owner == owner)
+				ids.push_back(id);
+		}
+		for (uint64_t id : ids)
+			Cancel(id);
+	}
+
+	void CoroutineScheduler::Update()
+	{
+		s_Data->Stats.Resumed = 0;
+
+		// Le liste contengono id: una coroutine cancellata nel frattempo viene semplicemente ignorata.
+		uint64_t id;
+		while (s_Data->FinishedWorkers.TryPop(id))
+		{
+			s_Data->PendingWorkers--;
+			auto it = s_Data->Coroutines.find(id);
+			if (it == s_Data->Coroutines.end())
+				continue;
+
+			it->second.WaitingWorker = false;
+			if (it->second.Cancelled)
+				Cancel(id);
+			else
+				Resume(id);
+		}
+
+		float time = Application::GetTime();
+		for (size_t i = 0; i < s_Data->Timers.size();)
+		{
+			if (s_Data->Timers[i].first > time)
+			{
+				i++;
+				continue;
+			}
+
+			id = s_Data->Timers[i].second;
+			s_Data->Timers[i] = s_Data->Timers.back();
+			s_Data->Timers.pop_back();
+			Resume(id);
+		}
+
+		// Chi attende di nuovo NextFrame finisce nella lista nuova e riparte al prossimo Update.
+		std::swap(s_Data->ResumingNow, s_Data->NextFrame);
+		for (uint64_t nextID : s_Data->ResumingNow)
+			Resume(nextID);
+		s_Data->ResumingNow.clear();
+	}
+
+	CoroutineScheduler::Statistics CoroutineScheduler::GetStats()
+	{
+		Statistics stats = s_Data ? s_Data->Stats : Statistics();
+		stats.ActiveCoroutines = s_Data ? (uint32_t)s_Data->Coroutines.size() : 0;
+		stats.FrameAllocations = s_FramePool.Allocations;
+		stats.PooledFrameAllocations = s_FramePool.PooledAllocations;
+		return stats;
+	}
+
+	void CoroutineScheduler::WaitNextFrame(Coroutine::Handle handle)
+	{
+		s_Data->NextFrame.push_back(handle.promise().ID);
+	}
+
+	void CoroutineScheduler::WaitUntil(Coroutine::Handle handle, float time)
+	{
+		s_Data->Timers.push_back({ time, handle.promise().ID });
+	}
+
+	void CoroutineScheduler::WaitWorker(Coroutine::Handle handle, std::function<void()> work)
+	{
+		uint64_t id = handle.promise().ID;
+		s_Data->Coroutines[id].WaitingWorker = true;
+		s_Data->PendingWorkers++;
+
+		JobSystem::Execute([id, work = std::move(work)]()
+		{
+			work();
+			// La coda è piena solo se il thread principale è indietro di migliaia di job: aspettiamo che la svuoti.
+			while (!s_Data->FinishedWorkers.TryPush(id))
+				std::this_thread::yield();
+		});
+	}
+
+	void SecondsAwaiter::await_suspend(Coroutine::Handle handle)
+	{
+		CoroutineScheduler::WaitUntil(handle, Application::GetTime() + Seconds);
+	}
+
+	void AssetLoadAwaiter::await_suspend(Coroutine::Handle handle)
+	{
+		Suspend(handle, [this]() { m_Contents = AssetManager::ReadFile(m_Path); });
+	}
+
+	AssetHandle AssetLoadAwaiter::await_resume()
+	{
+		if (!m_Contents)
+			return {};
+		return AssetManager::AddFile(m_Path, m_Contents);
+	}
+
+}
@@ -0,0 +1,188 @@
+#pragma once
+
+#include "GameEngine/Core.h"
+#include "GameEngine/Asset/AssetManager.h"
+
+#include <coroutine>
+#include <optional>
+#include <type_traits>
+
+namespace GameEngine {
+
+	// Tipo di ritorno delle coroutine gestite da CoroutineScheduler:
+	//
+	// Coroutine MyLayer::Intro()
+	// {
+	//     AssetHandle level = co_await LoadAsset("assets/level.bin");
+	//     uint32_t count = co_await RunOnWorker([] { return ExpensiveCount(); });
+	//     co_await Seconds(1.0f);
+	//     while (true) { ...; co_await NextFrame(); }
+	// }
+	//
+	// La coroutine parte sospesa e inizia solo con CoroutineScheduler::Start (o Layer::StartCoroutine).
+	// Viene creata, ripresa e distrutta sempre sul thread principale: anche il codice dopo RunOnWorker e LoadAsset
+	// gira lì, quindi può usare renderer e asset come OnUpdate.
+	class Coroutine
+	{
+	public:
+		struct promise_type
+		{
+			// Assegnato da CoroutineScheduler::Start.
+			uint64_t ID = 0;
+
+			Coroutine get_return_object() { return Coroutine(std::coroutine_handle<promise_type>::from_promise(*this)); }
+			std::suspend_always initial_suspend() noexcept { return {}; }
+			// Il frame resta in vita alla fine: è lo scheduler a distruggerlo.
+			std::suspend_always final_suspend() noexcept { return {}; }
+			void return_void() {}
+			void unhandled_exception();
+
+			// I frame vengono da un pool: avviare una coroutine per ogni evento non costa un'allocazione ogni volta.
+			static void* operator new(size_t size);
+			static void operator delete(void* frame, size_t size);
+		};
+
+		using Handle = std::coroutine_handle<promise_type>;
+
+		Coroutine(Coroutine&& other) noexcept : m_Handle(other.m_Handle) { other.m_Handle = nullptr; }
+		Coroutine& operator=(Coroutine&& other) noexcept;
+		Coroutine(const Coroutine&) = delete;
+		Coroutine& operator=(const Coroutine&) = delete;
+		// Una coroutine mai avviata viene distrutta con l'oggetto.
+		~Coroutine();
+
+		// Passa il frame a chi lo gestirà (lo scheduler): l'oggetto resta vuoto.
+		Handle Release() { Handle handle = m_Handle; m_Handle = nullptr; return handle; }
+
+	private:
+		explicit Coroutine(Handle handle) : m_Handle(handle) {}
+
+	private:
+		Handle m_Handle;
+	};
+
+	class CoroutineScheduler
+	{
+	public:
+		static void Init();
+		// Distrugge le coroutine sospese, dopo aver atteso quelle in attesa di un worker.
+		static void Shutdown();
+
+		// Esegue la coroutine fino alla prima sospensione. owner permette di cancellare in blocco
+		// le coroutine di un oggetto (Layer lo fa nel distruttore). Restituisce l'id per Cancel.
+		static uint64_t Start(Coroutine coroutine, const void* owner = nullptr);
+		static void Cancel(uint64_t id);
+		static void CancelAll(const void* owner);
+
+		// Una volta per frame, dal thread principale: riprende le coroutine pronte (worker terminati, timer scaduti,
+		// attese del frame successivo).
+		static void Update();
+
+		struct Statistics
+		{
+			uint32_t ActiveCoroutines = 0;
+			// Riprese nell'ultimo Update.
+			uint32_t Resumed = 0;
+			// Frame allocati in totale e quanti sono stati riusati dal pool.
+			uint64_t FrameAllocations = 0;
+			uint64_t PooledFrameAllocations = 0;
+		};
+		static Statistics GetStats();
+
+	private:
+		static void WaitNextFrame(Coroutine::Handle handle);
+		static void WaitUntil(Coroutine::Handle handle, float time);
+		// Esegue work su un worker del JobSystem; la coroutine viene ripresa al primo Update successivo al termine.
+		static void WaitWorker(Coroutine::Handle handle, std::function<void()> work);
+
+		friend struct NextFrameAwaiter;
+		friend struct SecondsAwaiter;
+		friend class WorkerAwaiterBase;
+	};
+
+	#pragma region Awaiter
+
+	struct NextFrameAwaiter
+	{
+		bool await_ready() const noexcept { return false; }
+		void await_suspend(Coroutine::Handle handle) { CoroutineScheduler::WaitNextFrame(handle); }
+		void await_resume() const noexcept {}
+	};
+
+	struct SecondsAwaiter
+	{
+		float Seconds;
+
+		bool await_ready() const noexcept { return Seconds <= 0.0f; }
+		void await_suspend(Coroutine::Handle handle);
+		void await_resume() const noexcept {}
+	};
+
+	class WorkerAwaiterBase
+	{
+	public:
+		bool await_ready() const noexcept { return false; }
+
+	protected:
+		// work può scrivere nell'awaiter: il frame non viene distrutto finché il worker non ha finito, anche se la coroutine è cancellata.
+		void Suspend(Coroutine::Handle handle, std::function<void()> work) { CoroutineScheduler::WaitWorker(handle, std::move(work)); }
+	};
+
+	template<typename F>
+	class WorkerAwaiter : public WorkerAwaiterBase
+	{
+	public:
+		using Result = std::invoke_result_t<F>;
+
+		WorkerAwaiter(F function) : m_Function(std::move(function)) {}
+
+		void await_suspend(Coroutine::Handle handle)
+		{
+			Suspend(handle, [this]()
+			{
+				if constexpr (std::is_void_v<Result>)
+					m_Function();
+				else
+					m_Result.emplace(m_Function());
+			});
+		}
+
+		Result await_resume()
+		{
+			if constexpr (!std::is_void_v<Result>)
+				return std::move(*m_Result);
+		}
+
+	private:
+		struct Empty {};
+
+		F m_Function;
+		std::conditional_t<std::is_void_v<Result>, Empty, std::optional<Result>> m_Result;
+	};
+
+	// Il file viene letto da un worker; la registrazione nell'AssetManager, che non è thread-safe,
+	// avviene alla ripresa sul thread principale.
+	class AssetLoadAwaiter : public WorkerAwaiterBase
+	{
+	public:
+		AssetLoadAwaiter(std::string path) : m_Path(std::move(path)) {}
+
+		void await_suspend(Coroutine::Handle handle);
+		// Handle nullo se il file non può essere letto.
+		AssetHandle await_resume();
+
+	private:
+		std::string m_Path;
+		Ref<std::vector<uint8_t>> m_Contents;
+	};
+
+	#pragma endregion
+
+	inline NextFrameAwaiter NextFrame() { return {}; }
+	inline SecondsAwaiter Seconds(float seconds) { return { seconds }; }
+	template<typename F>
+	WorkerAwaiter<F> RunOnWorker(F function) { return WorkerAwaiter<F>(std::move(function)); }
+	// Come AssetManager::LoadFile, ma senza bloccare il frame durante la lettura.
+	inline AssetLoadAwaiter LoadAsset(const std::string& path) { return AssetLoadAwaiter(path); }
+
+}
@@ -0,0 +1,73 @@
+#include "hzpch.h"
+#include "FrameTimeTracker.h"
+
+namespace GameEngine {
+
+	FrameTimeTracker::FrameTimeTracker(uint32_t windowSize)
+		: m_Samples(windowSize, 0.0f)
+	{
+		HZ_CORE_ASSERT(windowSize > 0, "FrameTimeTracker needs at least one sample!");
+		m_Sorted.reserve(windowSize);
+	}
+
+	void FrameTimeTracker::AddFrame(float milliseconds)
+	{
+		m_Samples[m_Next] = milliseconds;
+		m_Next = (m_Next + 1) % (uint32_t)m_Samples.size();
+		m_Count = std::min(m_Count + 1, (uint32_t)m_Samples.size());
+		m_SortedValid = false;
+	}
+
+	const std::vector<float>& FrameTimeTracker::GetSorted() const
+	{
+		if (!m_SortedValid)
+		{
+			m_Sorted.assign(m_Samples.begin(), m_Samples.begin() + m_Count);
+			std::sort(m_Sorted.begin(), m_Sorted.end());
+			m_SortedValid = true;
+		}
+		return m_Sorted;
+	}
+
+	float FrameTimeTracker::GetPercentile(float p) const
+	{
+		const std::vector<float>& sorted = GetSorted();
+		if (sorted.empty())
+			return 0.0f;
+
+		size_t index = std::min((size_t)(std::max(p, 0.0f) * sorted.size()), sorted.size() - 1);
+		return sorted[index];
+	}
+
+	float FrameTimeTracker::GetWorst() const
+	{
+		const std::vector<float>& sorted = GetSorted();
+		return sorted.empty() ? 0.0f : sorted.back();
+	}
+
+	float FrameTimeTracker::GetAverage() const
+	{
+		if (m_Count == 0)
+			return 0.0f;
+
+		double total = 0.0;
+		for (uint32_t i = 0; i < m_Count; i++)
+			total += m_Samples[i];
+		return (float)(total / m_Count);
+	}
+
+	void FrameTimeTracker::GetHistogram(float* buckets, uint32_t bucketCount, float maxMilliseconds) const
+	{
+		std::fill(buckets, buckets + bucketCount, 0.0f);
+		if (bucketCount == 0 || maxMilliseconds <= 0.0f)
+			return;
+
+		const float scale = bucketCount / maxMilliseconds;
+		for (uint32_t i = 0; i < m_Count; i++)
+		{
+			uint32_t bucket = std::min((uint32_t)std::max(m_Samples[i] * scale, 0.0f), bucketCount - 1);
+			buckets[bucket] += 1.0f;
+		}
+	}
+
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "GameEngine/Core.h"
+
+#include <vector>
+
+namespace GameEngine {
+
+	// Tempi per frame (in millisecondi) degli ultimi WindowSize frame, in un buffer circolare.
+	// I percentili vengono calcolati su richiesta e riusati finché non arriva un nuovo frame.
+	class FrameTimeTracker
+	{
+	public:
+		FrameTimeTracker(uint32_t windowSize = 300);
+
+		void AddFrame(float milliseconds);
+
+		inline uint32_t GetSampleCount() const { return m_Count; }
+		inline uint32_t GetWindowSize() const { return (uint32_t)m_Samples.size(); }
+
+		// p in [0, 1]: GetPercentile(0.99f) è il tempo sotto cui cade il 99% dei frame della finestra.
+		float GetPercentile(float p) const;
+		float GetWorst() const;
+		float GetAverage() const;
+
+		// Campioni grezzi: il più vecchio si trova in GetOffset(), come si aspettano ImGui::PlotLines/PlotHistogram.
+		inline const float* GetSamples() const { return m_Samples.data(); }
+		inline uint32_t GetOffset() const { return m_Count < m_Samples.size() ? 0 : m_Next; }
+
+		// Distribuzione dei tempi: bucketCount intervalli uguali in [0, maxMilliseconds),
+		// i frame più lenti finiscono nell'ultimo.
+		void GetHistogram(float* buckets, uint32_t bucketCount, float maxMilliseconds) const;
+
+	private:
+		const std::vector<float>& GetSorted() const;
+
+	private:
+		std::vector<float> m_Samples;
+		uint32_t m_Next = 0;
+		uint32_t m_Count = 0;
+
+		mutable std::vector<float> m_Sorted;
+		mutable bool m_SortedValid = false;
+	};
+
+}
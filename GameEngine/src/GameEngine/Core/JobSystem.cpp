@@ -0,0 +1,143 @@
+#include "hzpch.h"
+#include "JobSystem.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace GameEngine {
+
+	uint32_t JobSystem::s_WorkerCount = 0;
+
+	struct JobSystemData
+	{
+		std::vector<std::thread> Workers;
+		std::deque<std::function<void()>> Queue;
+		std::mutex QueueMutex;
+		std::condition_variable WakeCondition;
+		bool Running = true;
+	};
+
+	static JobSystemData* s_Data = nullptr;
+
+	static void WorkerLoop()
+	{
+		while (true)
+		{
+			std::function<void()> job;
+			{
+				std::unique_lock<std::mutex> lock(s_Data->QueueMutex);
+				s_Data->WakeCondition.wait(lock, [] { return !s_Data->Running || !s_Data->Queue.empty(); });
+
+				// Allo shutdown i job rimasti vengono comunque completati.
+				if (s_Data->Queue.empty())
+					return;
+
+				job = std::move(s_Data->Queue.front());
+				s_Data->Queue.pop_front();
+			}
+
+			job();
+		}
+	}
+
+	void JobSystem::Init(uint32_t workerCount)
+	{
+		if (workerCount == 0)
+		{
+			uint32_t cores = std::thread::hardware_concurrency();
+			workerCount = cores > 1 ? cores - 1 : 1;
+		}
+
+		s_Data = new JobSystemData();
+		s_WorkerCount = workerCount;
+		for (uint32_t i = 0; i < workerCount; i++)
+			s_Data->Workers.emplace_back(WorkerLoop);
+
+		HZ_CORE_INFO("JobSystem: {0} worker threads", workerCount);
+	}
+
+	void JobSystem::Shutdown()
+	{
+		if (!s_Data)
+			return;
+
+		{
+			std::lock_guard<std::mutex> lock(s_Data->QueueMutex);
+			s_Data->Running = false;
+		}
+		s_Data->WakeCondition.notify_all();
+
+		for (auto& worker : s_Data->Workers)
+			worker.join();
+
+		delete s_Data;
+		s_Data = nullptr;
+		s_WorkerCount = 0;
+	}
+
+	void JobSystem::Execute(std::function<void()> job)
+	{
+		if (!s_Data)
+		{
+			job();
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(s_Data->QueueMutex);
+			s_Data->Queue.push_back(std::move(job));
+		}
+		s_Data->WakeCondition.notify_one();
+	}
+
+	void JobSystem::ParallelFor(uint32_t count, uint32_t batchSize, const std::function<void(uint32_t, uint32_t)>& fn)
+	{
+		if (count == 0)
+			return;
+
+		batchSize = std::max(batchSize, 1u);
+		const uint32_t batchCount = (count + batchSize - 1) / batchSize;
+		if (!s_Data || batchCount == 1)
+		{
+			// Stessa suddivisione in blocchi del caso parallelo: il chiamante può contare sui limiti dei blocchi.
+			for (uint32_t begin = 0; begin < count; begin += batchSize)
+				fn(begin, std::min(begin + batchSize, count));
+			return;
+		}
+
+		// I blocchi non sono assegnati in anticipo: ogni thread prende il prossimo libero,
+		// così un worker lento non rallenta tutti gli altri.
+		struct SharedState
+		{
+			std::atomic<uint32_t> NextBatch{ 0 };
+			std::atomic<uint32_t> CompletedBatches{ 0 };
+		};
+		auto state = std::make_shared<SharedState>();
+
+		auto runBatches = [state, count, batchSize, batchCount, &fn]()
+		{
+			uint32_t batch;
+			while ((batch = state->NextBatch.fetch_add(1)) < batchCount)
+			{
+				uint32_t begin = batch * batchSize;
+				uint32_t end = std::min(begin + batchSize, count);
+				fn(begin, end);
+				state->CompletedBatches.fetch_add(1, std::memory_order_release);
+			}
+		};
+
+		uint32_t helpers = std::min(s_WorkerCount, batchCount - 1);
+		for (uint32_t i = 0; i < helpers; i++)
+			Execute(runBatches);
+
+		runBatches();
+
+		// fn è catturata per riferimento: non possiamo uscire finché qualcuno la sta ancora usando.
+		while (state->CompletedBatches.load(std::memory_order_acquire) < batchCount)
+			std::this_thread::yield();
+	}
+
+}
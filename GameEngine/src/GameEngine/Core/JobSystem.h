@@ -0,0 +1,30 @@
+#pragma once
+
+#include "GameEngine/Core.h"
+
+namespace GameEngine {
+
+	// Pool di worker thread condiviso dal motore.
+	// Se il JobSystem non è inizializzato (o non ha worker) tutto viene eseguito sul thread chiamante.
+	class JobSystem
+	{
+	public:
+		// workerCount = 0: un worker per ogni core logico, meno il main thread.
+		static void Init(uint32_t workerCount = 0);
+		static void Shutdown();
+
+		inline static uint32_t GetWorkerCount() { return s_WorkerCount; }
+
+		// Accoda un job da eseguire su un worker, senza attenderne il completamento.
+		static void Execute(std::function<void()> job);
+
+		// Divide [0, count) in blocchi di batchSize elementi ed esegue fn(begin, end) in parallelo.
+		// Anche il thread chiamante partecipa; la funzione ritorna quando tutti i blocchi sono terminati.
+		// I blocchi iniziano sempre a multipli di batchSize, quindi begin / batchSize identifica il blocco.
+		static void ParallelFor(uint32_t count, uint32_t batchSize, const std::function<void(uint32_t, uint32_t)>& fn);
+
+	private:
+		static uint32_t s_WorkerCount;
+	};
+
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "GameEngine/Core.h"
+
+#include <atomic>
+#include <vector>
+
+namespace GameEngine {
+
+	// Coda limitata senza lock: più thread inseriscono con TryPush, un solo thread estrae con TryPop.
+	// Ogni cella ha un numero di sequenza che dice se è libera per il produttore di turno o pronta per il consumatore,
+	// così un inserimento costa un compare-exchange sulla posizione di coda e nessun mutex.
+	// Quando la coda è piena TryPush fallisce subito: decide il chiamante se scartare, riprovare o fare altro.
+	template<typename T>
+	class MPSCQueue
+	{
+	public:
+		// La capacità viene arrotondata alla potenza di due successiva.
+		MPSCQueue(uint32_t capacity)
+		{
+			uint32_t size = 2;
+			while (size < capacity)
+				size *= 2;
+
+			m_Mask = size - 1;
+			m_Cells = std::vector<Cell>(size);
+			for (uint32_t i = 0; i < size; i++)
+				m_Cells[i].Sequence.store(i, std::memory_order_relaxed);
+		}
+
+		MPSCQueue(const MPSCQueue&) = delete;
+		MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+		// Da qualunque thread. Restituisce false se la coda è piena.
+		bool TryPush(T value)
+		{
+			Cell* cell;
+			uint64_t position = m_EnqueuePosition.load(std::memory_order_relaxed);
+			while (true)
+			{
+				cell = &m_Cells[position & m_Mask];
+				uint64_t sequence = cell->Sequence.load(std::memory_order_acquire);
+				int64_t difference = (int64_t)sequence - (int64_t)position;
+				if (difference == 0)
+				{
+					// Cella libera: la prenotiamo spostando in avanti la posizione di coda.
+					if (m_EnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+						break;
+				}
+				else if (difference < 0)
+				{
+					// Il consumatore non ha ancora liberato la cella di un giro fa.
+					return false;
+				}
+				else
+				{
+					// Un altro produttore ci ha preceduto.
+					position = m_EnqueuePosition.load(std::memory_order_relaxed);
+				}
+			}
+
+			cell->Value = std::move(value);
+			cell->Sequence.store(position + 1, std::memory_order_release);
+			return true;
+		}
+
+		// Solo dal thread consumatore. Restituisce false se la coda è vuota (o il prossimo elemento non è ancora scritto).
+		bool TryPop(T& value)
+		{
+			Cell& cell = m_Cells[m_DequeuePosition & m_Mask];
+			uint64_t sequence = cell.Sequence.load(std::memory_order_acquire);
+			if (sequence != m_DequeuePosition + 1)
+				return false;
+
+			value = std::move(cell.Value);
+			// Le risorse dell'elemento (ad es. le catture di una closure) non restano vive nella cella.
+			cell.Value = T();
+			cell.Sequence.store(m_DequeuePosition + m_Mask + 1, std::memory_order_release);
+			m_DequeuePosition++;
+			return true;
+		}
+
+		inline uint32_t GetCapacity() const { return m_Mask + 1; }
+		// Elementi inseriti in totale, compresi quelli già estratti.
+		inline uint64_t GetPushCount() const { return m_EnqueuePosition.load(std::memory_order_relaxed); }
+		// Solo dal thread consumatore: mentre i produttori inseriscono il valore è già vecchio appena letto.
+		inline uint32_t GetSize() const { return (uint32_t)(m_EnqueuePosition.load(std::memory_order_relaxed) - m_DequeuePosition); }
+
+	private:
+		// Una cella per linea di cache: produttori e consumatore su celle vicine non si contendono la stessa linea.
+		struct alignas(64) Cell
+		{
+			std::atomic<uint64_t> Sequence{ 0 };
+			T Value;
+		};
+
+		std::vector<Cell> m_Cells;
+		uint32_t m_Mask;
+
+		alignas(64) std::atomic<uint64_t> m_EnqueuePosition{ 0 };
+		alignas(64) uint64_t m_DequeuePosition = 0;
+	};
+
+}
@@ -1,6 +1,6 @@
 #pragma once
 
-#ifdef HZ_PLATFORM_WINDOWS
+#if defined(HZ_PLATFORM_WINDOWS) || defined(HZ_PLATFORM_LINUX)
 
 extern GameEngine::Application* GameEngine::CreateApplication();
 
@@ -8,6 +8,7 @@ int main(int argc, char** argv)
 {
 
 	GameEngine::Log::Init();
+	GameEngine::Application::SetCommandLine(GameEngine::ApplicationCommandLine::Parse(argc, argv));
 
 	auto app = GameEngine::CreateApplication();
 	app->Run();
@@ -38,6 +38,48 @@ namespace GameEngine {
 		EVENT_CLASS_CATEGORY(EventCategoryApplication)
 	};
 
+	// La finestra ha ricevuto il focus della tastiera.
+	class WindowFocusEvent : public Event
+	{
+	public:
+		WindowFocusEvent() {}
+
+		EVENT_CLASS_TYPE(WindowFocus)
+		EVENT_CLASS_CATEGORY(EventCategoryApplication)
+	};
+
+	class WindowLostFocusEvent : public Event
+	{
+	public:
+		WindowLostFocusEvent() {}
+
+		EVENT_CLASS_TYPE(WindowLostFocus)
+		EVENT_CLASS_CATEGORY(EventCategoryApplication)
+	};
+
+	// La finestra è stata ridotta a icona (iconified = true) o ripristinata.
+	class WindowIconifyEvent : public Event
+	{
+	public:
+		WindowIconifyEvent(bool iconified)
+			: m_Iconified(iconified) {}
+
+		inline bool IsIconified() const { return m_Iconified; }
+
+		std::string ToString() const override
+		{
+			std::stringstream ss;
+			ss << "WindowIconifyEvent: " << (m_Iconified ? "iconified" : "restored");
+			return ss.str();
+		}
+
+		EVENT_CLASS_TYPE(WindowIconify)
+		EVENT_CLASS_CATEGORY(EventCategoryApplication)
+
+	private:
+		bool m_Iconified;
+	};
+
 	class AppTickEvent : public Event
 	{
 	public:
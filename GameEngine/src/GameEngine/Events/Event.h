@@ -12,7 +12,7 @@ namespace GameEngine {
 	enum class EventType
 	{
 		None = 0,
-		WindowClose, WindowResize, WindowFocus, WindowLostFocus, WindowMoved,
+		WindowClose, WindowResize, WindowFocus, WindowLostFocus, WindowMoved, WindowIconify,
 		AppTick, AppUpdate, AppRender,
 		KeyPressed, KeyReleased, KeyTyped,
 		MouseButtonPressed, MouseButtonReleased, MouseMoved, MouseScrolled
@@ -34,8 +34,9 @@ namespace GameEngine {
 	};
 
 
-// EventType::##type viene trasformato dal preprocessore in EventType::TypeName
-#define EVENT_CLASS_TYPE(type) static EventType GetStaticType() { return EventType::##type; }\
+// EventType::type viene trasformato dal preprocessore in EventType::TypeName.
+// Niente ## prima di type: "::" e un identificatore non formano un token valido e GCC/Clang lo rifiutano.
+#define EVENT_CLASS_TYPE(type) static EventType GetStaticType() { return EventType::type; }\
 								virtual EventType GetEventType() const override { return GetStaticType(); }\
 								virtual const char* GetName() const override { return #type; }
 
@@ -15,10 +15,21 @@
 
 namespace GameEngine {
 
+	// Frame ricostruiti dopo ogni input prima di tornare ad usare la cache.
+	static const uint32_t s_SettleFrames = 3;
+
 	ImGuiLayer::ImGuiLayer()
 		: Layer("ImGuiLayer")
 	{
-
+		// In debug l'UI viene ricostruita ad ogni frame e mostra la demo; nelle build di release il costo
+		// dei pannelli di debug si paga solo quando cambiano.
+	#ifdef HZ_DEBUG
+		m_Cached = false;
+		m_ShowDemoWindow = true;
+	#else
+		m_Cached = true;
+		m_ShowDemoWindow = false;
+	#endif
 	}
 
 	ImGuiLayer::~ImGuiLayer()
@@ -43,7 +54,13 @@ namespace GameEngine {
         // io.ConfigFlags |= ImGuiConfigFlags_NavEnableGamepad;
 
         io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;
-        io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;
+
+        // Senza finestra nativa non c'è il backend GLFW: niente viewport multipli, il resto dell'UI viene
+        // comunque costruito e disegnato nel framebuffer offscreen, così i tempi misurati lo includono.
+        Application& app = Application::Get();
+        m_Headless = app.GetWindow().IsHeadless();
+        if (!m_Headless)
+            io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;
 
         //io.ConfigFlags |= ImGuiConfigFlags_ViewportsNoTaskBarIcons;
         //io.ConfigFlags |= ImGuiConfigFlags_ViewportsNoMerge;
@@ -58,55 +75,185 @@ namespace GameEngine {
             style.Colors[ImGuiCol_WindowBg].w = 1.0f;
         }
 
-        Application& app = Application::Get();
-        GLFWwindow* window = static_cast<GLFWwindow*>(app.GetWindow().GetNativeWindow());
-
         // Setup Platform/Renderer backends
-        ImGui_ImplGlfw_InitForOpenGL(window, true);
+        if (!m_Headless)
+        {
+            GLFWwindow* window = static_cast<GLFWwindow*>(app.GetWindow().GetNativeWindow());
+            ImGui_ImplGlfw_InitForOpenGL(window, true);
+        }
 
         // Inizializza l'implementazione di ImGui per OpenGL 3.0 (specificando la versione di GLSL #version 410).
         // Questo è un passaggio fondamentale per configurare l'uso di ImGui con OpenGL.
         ImGui_ImplOpenGL3_Init("#version 410");
+
+        // Triangolo che copre lo schermo generato da gl_VertexID: il VAO serve solo perché il core profile lo richiede.
+        std::string compositeVertexSrc = R"(
+            #version 450 core
+
+            void main()
+            {
+                vec2 position = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+                gl_Position = vec4(position * 2.0 - 1.0, 0.0, 1.0);
+            }
+        )";
+
+        // La cache ha la stessa dimensione del backbuffer: texelFetch copia i pixel 1:1.
+        std::string compositeFragmentSrc = R"(
+            #version 450 core
+
+            layout(location = 0) out vec4 color;
+
+            layout(binding = 0) uniform sampler2D u_Texture;
+
+            void main()
+            {
+                color = texelFetch(u_Texture, ivec2(gl_FragCoord.xy), 0);
+            }
+        )";
+
+        m_CompositeShader.reset(Shader::Create(compositeVertexSrc, compositeFragmentSrc));
+        m_CompositeVertexArray.reset(VertexArray::Create());
+        MarkDirty();
 	}
 
 	void ImGuiLayer::OnDetach()
 	{
         // Termina l'uso di OpenGL e GLFW con ImGui e libera le risorse relative.
         ImGui_ImplOpenGL3_Shutdown();
-        ImGui_ImplGlfw_Shutdown();
+        if (!m_Headless)
+            ImGui_ImplGlfw_Shutdown();
         // Distrugge il contesto di ImGui, liberando memoria e risorse legate a ImGui.
         ImGui::DestroyContext();
+
+        m_CacheFramebuffer.reset();
+        m_CompositeShader.reset();
+        m_CompositeVertexArray.reset();
 	}
 
-    void ImGuiLayer::Begin()
+    void ImGuiLayer::OnEvent(Event& event)
+    {
+        // L'evento non viene consumato: lo riceve anche il backend GLFW tramite le proprie callback.
+        if (event.IsInCategory(EventCategoryInput) || event.GetEventType() == EventType::WindowResize)
+            MarkDirty();
+    }
+
+    void ImGuiLayer::SetCachedRendering(bool cached)
+    {
+        m_Cached = cached;
+        MarkDirty();
+    }
+
+    void ImGuiLayer::MarkDirty()
+    {
+        m_DirtyFrames = s_SettleFrames;
+    }
+
+    bool ImGuiLayer::Begin()
     {
+        float time = Application::GetTime();
+        m_Rebuilding = !m_Cached || m_DirtyFrames > 0 || time - m_LastRebuildTime >= m_RefreshInterval;
+        if (!m_Rebuilding)
+            return false;
+
+        if (m_DirtyFrames > 0)
+            m_DirtyFrames--;
+        float deltaTime = time - m_LastRebuildTime;
+        m_LastRebuildTime = time;
+
         ImGui_ImplOpenGL3_NewFrame();
-        ImGui_ImplGlfw_NewFrame();
+        if (m_Headless)
+        {
+            // È il backend GLFW che normalmente imposta dimensioni e delta time.
+            ImGuiIO& io = ImGui::GetIO();
+            Application& app = Application::Get();
+            io.DisplaySize = ImVec2((float)app.GetWindow().GetWidth(), (float)app.GetWindow().GetHeight());
+            io.DeltaTime = deltaTime > 0.0f ? deltaTime : 1.0f / 60.0f;
+        }
+        else
+        {
+            ImGui_ImplGlfw_NewFrame();
+        }
         ImGui::NewFrame();
+        return true;
     }
 
     void ImGuiLayer::End()
     {
-        ImGuiIO& io = ImGui::GetIO();
-        Application& app = Application::Get();
-        io.DisplaySize = ImVec2((float)app.GetWindow().GetWidth(), (float)app.GetWindow().GetHeight());
+        if (m_Rebuilding)
+        {
+            ImGuiIO& io = ImGui::GetIO();
+            Application& app = Application::Get();
+            io.DisplaySize = ImVec2((float)app.GetWindow().GetWidth(), (float)app.GetWindow().GetHeight());
 
-        // Rendering
-        ImGui::Render();
-        ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+            // Rendering
+            ImGui::Render();
+            RenderDrawData();
 
-        if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
+            if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
+            {
+                GLFWwindow* backup_current_context = glfwGetCurrentContext();
+                ImGui::UpdatePlatformWindows();
+                ImGui::RenderPlatformWindowsDefault();
+                glfwMakeContextCurrent(backup_current_context);
+            }
+        }
+
+        if (m_Cached)
+            Composite();
+    }
+
+    void ImGuiLayer::RenderDrawData()
+    {
+        ImDrawData* drawData = ImGui::GetDrawData();
+        if (!m_Cached)
+        {
+            ImGui_ImplOpenGL3_RenderDrawData(drawData);
+            return;
+        }
+
+        uint32_t width = (uint32_t)(drawData->DisplaySize.x * drawData->FramebufferScale.x);
+        uint32_t height = (uint32_t)(drawData->DisplaySize.y * drawData->FramebufferScale.y);
+        if (width == 0 || height == 0)
+            return;
+
+        if (!m_CacheFramebuffer)
         {
-            GLFWwindow* backup_current_context = glfwGetCurrentContext();
-            ImGui::UpdatePlatformWindows();
-            ImGui::RenderPlatformWindowsDefault();
-            glfwMakeContextCurrent(backup_current_context);
+            FramebufferSpecification spec;
+            spec.Width = width;
+            spec.Height = height;
+            spec.Attachments = { FramebufferTextureFormat::RGBA8 };
+            m_CacheFramebuffer.reset(Framebuffer::Create(spec));
         }
+        m_CacheFramebuffer->Resize(width, height);
+
+        // Il backend usa glBlendFuncSeparate(SRC_ALPHA, ONE_MINUS_SRC_ALPHA, ONE, ONE_MINUS_SRC_ALPHA):
+        // partendo da uno sfondo trasparente la cache contiene colori premoltiplicati per l'alpha.
+        m_CacheFramebuffer->Bind();
+        m_CacheFramebuffer->ClearColorAttachment(0, { 0.0f, 0.0f, 0.0f, 0.0f });
+        ImGui_ImplOpenGL3_RenderDrawData(drawData);
+        m_CacheFramebuffer->Unbind();
+    }
+
+    void ImGuiLayer::Composite()
+    {
+        if (!m_CacheFramebuffer)
+            return;
+
+        const FramebufferSpecification& spec = m_CacheFramebuffer->GetSpecification();
+        glViewport(0, 0, spec.Width, spec.Height);
+        glBindTextureUnit(0, m_CacheFramebuffer->GetColorAttachmentRendererID());
+        m_CompositeShader->Bind();
+        m_CompositeVertexArray->Bind();
+
+        glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+        // Ripristina il blending impostato da OpenGLRendererAPI::Init.
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
     }
 
     void ImGuiLayer::OnImGuiRender()
     {
-        static bool show = true;
-        ImGui::ShowDemoWindow(&show);
+        if (m_ShowDemoWindow)
+            ImGui::ShowDemoWindow(&m_ShowDemoWindow);
     }
 }
\ No newline at end of file
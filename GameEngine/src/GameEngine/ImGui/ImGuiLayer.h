@@ -6,6 +6,10 @@
 #include "GameEngine/Events/KeyEvent.h"
 #include "GameEngine/Events/MouseEvent.h"
 
+#include "GameEngine/Renderer/Framebuffer.h"
+#include "GameEngine/Renderer/Shader.h"
+#include "GameEngine/Renderer/VertexArray.h"
+
 namespace GameEngine {
 
 	class ImGuiLayer : public Layer
@@ -16,14 +20,47 @@ namespace GameEngine {
 
 		virtual void OnAttach() override;
 		virtual void OnDetach() override;
+		virtual void OnEvent(Event& event) override;
 		virtual void OnImGuiRender() override;
 
-		void Begin();
+		// Restituisce true se in questo frame l'UI va ricostruita: solo allora i layer devono chiamare OnImGuiRender().
+		// Con la cache attiva e nulla di cambiato End() si limita a ricomporre l'ultimo frame dell'UI.
+		bool Begin();
 		void End();
 
+		// In modalità cache l'UI viene ricostruita e ridisegnata solo dopo input, resize o MarkDirty(),
+		// e comunque almeno ogni RefreshInterval secondi (per i valori che cambiano da soli, ad es. contatori).
+		// Il frame precedente resta in una texture che viene composta sopra la scena.
+		// I viewport secondari (finestre staccate) vengono aggiornati solo quando l'UI viene ricostruita.
+		void SetCachedRendering(bool cached);
+		inline bool IsCachedRendering() const { return m_Cached; }
+		inline void SetRefreshInterval(float seconds) { m_RefreshInterval = seconds; }
+
+		// Per i pannelli il cui contenuto cambia senza input (log, profiler, ...).
+		void MarkDirty();
+
+		inline void SetShowDemoWindow(bool show) { m_ShowDemoWindow = show; }
+
+	private:
+		void RenderDrawData();
+		void Composite();
+
 	private:
 		float m_Time = 0.0f;
+		bool m_Headless = false;
+
+		bool m_Cached;
+		bool m_ShowDemoWindow;
+		bool m_Rebuilding = false;
+		// Frame da ricostruire ancora: dopo un input ImGui ha bisogno di qualche frame per assestarsi
+		// (hover, finestre che calcolano la propria dimensione, ...).
+		uint32_t m_DirtyFrames = 0;
+		float m_RefreshInterval = 0.25f;
+		float m_LastRebuildTime = 0.0f;
+
+		Ref<Framebuffer> m_CacheFramebuffer;
+		Ref<Shader> m_CompositeShader;
+		Ref<VertexArray> m_CompositeVertexArray;
 	};
 
 }
-
@@ -0,0 +1,95 @@
+#include "hzpch.h"
+#include "StatisticsOverlay.h"
+
+#include "imgui.h"
+
+#include "GameEngine/Application.h"
+#include "GameEngine/Core/Coroutine.h"
+#include "GameEngine/KeyCodes.h"
+#include "GameEngine/Renderer/Renderer.h"
+#include "GameEngine/Renderer/Renderer2D.h"
+
+#include <cfloat>
+
+namespace GameEngine {
+
+	static const uint32_t s_HistogramBuckets = 40;
+
+	StatisticsOverlay::StatisticsOverlay()
+		: Layer("StatisticsOverlay")
+	{
+	#ifdef HZ_DEBUG
+		m_Visible = true;
+	#else
+		m_Visible = false;
+	#endif
+	}
+
+	void StatisticsOverlay::OnEvent(Event& event)
+	{
+		EventDispatcher dispatcher(event);
+		dispatcher.Dispatch<KeyPressedEvent>(HZ_BIND_EVENT_FN(StatisticsOverlay::OnKeyPressed));
+	}
+
+	bool StatisticsOverlay::OnKeyPressed(KeyPressedEvent& e)
+	{
+		if (e.GetKeyCode() != HZ_KEY_F3 || e.GetRepeatCount() > 0)
+			return false;
+
+		m_Visible = !m_Visible;
+		return true;
+	}
+
+	void StatisticsOverlay::OnImGuiRender()
+	{
+		if (!m_Visible)
+			return;
+
+		const FrameTimeTracker& frameTimes = Application::Get().GetFrameTimeTracker();
+		const Renderer::Statistics& stats = Renderer::GetStats();
+		const Renderer2D::Statistics stats2D = Renderer2D::GetStats();
+
+		ImGui::SetNextWindowPos(ImVec2(10.0f, 10.0f), ImGuiCond_FirstUseEver);
+		ImGui::SetNextWindowBgAlpha(0.75f);
+		ImGui::Begin("Statistics", &m_Visible, ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoFocusOnAppearing);
+
+		float average = frameTimes.GetAverage();
+		float worst = frameTimes.GetWorst();
+		ImGui::Text("Frame: %.2f ms (%.0f FPS), last %u frames", average, average > 0.0f ? 1000.0f / average : 0.0f, frameTimes.GetSampleCount());
+		ImGui::Text("p50 %.2f  p95 %.2f  p99 %.2f  worst %.2f ms",
+			frameTimes.GetPercentile(0.5f), frameTimes.GetPercentile(0.95f), frameTimes.GetPercentile(0.99f), worst);
+
+		// Andamento nel tempo: i picchi isolati saltano all'occhio.
+		ImGui::PlotLines("##FrameTimes", frameTimes.GetSamples(), (int)frameTimes.GetSampleCount(), (int)frameTimes.GetOffset(),
+			"frame time (ms)", 0.0f, std::max(worst, 1000.0f / 30.0f), ImVec2(320.0f, 60.0f));
+
+		// Distribuzione: una seconda gobba a destra indica frame lenti ricorrenti (ad es. uno ogni N).
+		float buckets[s_HistogramBuckets];
+		float histogramMax = std::max(worst * 1.05f, 1000.0f / 30.0f);
+		frameTimes.GetHistogram(buckets, s_HistogramBuckets, histogramMax);
+		char histogramLabel[64];
+		snprintf(histogramLabel, sizeof(histogramLabel), "0 - %.1f ms", histogramMax);
+		ImGui::PlotHistogram("##Distribution", buckets, (int)s_HistogramBuckets, 0, histogramLabel, 0.0f, FLT_MAX, ImVec2(320.0f, 60.0f));
+
+		ImGui::Separator();
+		ImGui::Text("Draw calls: %u", stats.DrawCalls);
+		ImGui::Text("Indices: %u  Vertices: %u", stats.Indices, stats.Vertices);
+		ImGui::Text("State changes: %u  Shader binds: %u", stats.StateChanges, stats.ShaderBinds);
+		ImGui::Text("Uploaded: %.1f KB", stats.BufferBytesUploaded / 1024.0);
+
+		ImGui::Separator();
+		ImGui::Text("Renderer2D: %u draw calls, %u quads, %u particles", stats2D.DrawCalls, stats2D.QuadCount, stats2D.ParticleCount);
+
+		Application::MainThreadQueueStatistics queue = Application::Get().GetMainThreadQueueStats();
+		ImGui::Separator();
+		ImGui::Text("Main thread queue: %u run, peak %u / %u", queue.Drained, queue.HighWatermark, queue.Capacity);
+		ImGui::Text("Posted: %llu  Rejected: %llu", (unsigned long long)queue.Posted, (unsigned long long)queue.Rejected);
+
+		CoroutineScheduler::Statistics coroutines = CoroutineScheduler::GetStats();
+		ImGui::Text("Coroutines: %u active, %u resumed", coroutines.ActiveCoroutines, coroutines.Resumed);
+		ImGui::Text("Frames: %llu allocated, %llu from pool", (unsigned long long)coroutines.FrameAllocations, (unsigned long long)coroutines.PooledFrameAllocations);
+
+		ImGui::End();
+	}
+
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "GameEngine/Layer.h"
+
+#include "GameEngine/Events/KeyEvent.h"
+
+namespace GameEngine {
+
+	// Finestra ImGui con tempi per frame (percentili, andamento, distribuzione) e contatori del renderer.
+	// F3 la mostra/nasconde.
+	class StatisticsOverlay : public Layer
+	{
+	public:
+		StatisticsOverlay();
+
+		virtual void OnEvent(Event& event) override;
+		virtual void OnImGuiRender() override;
+
+		inline void SetVisible(bool visible) { m_Visible = visible; }
+		inline bool IsVisible() const { return m_Visible; }
+
+	private:
+		bool OnKeyPressed(KeyPressedEvent& e);
+
+	private:
+		bool m_Visible;
+	};
+
+}
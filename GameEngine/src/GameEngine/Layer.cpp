@@ -1,6 +1,8 @@
 #include "hzpch.h"
 #include "Layer.h"
 
+#include "GameEngine/Core/Coroutine.h"
+
 namespace GameEngine {
 
 	Layer::Layer(const std::string& debugName)
@@ -10,8 +12,14 @@ namespace GameEngine {
 
 	Layer::~Layer()
 	{
+		CoroutineScheduler::CancelAll(this);
 		m_Deleted = true;
 		std::cout << "Destroying Layer: " << this << std::endl;
 	}
 
+	uint64_t Layer::StartCoroutine(Coroutine coroutine)
+	{
+		return CoroutineScheduler::Start(std::move(coroutine), this);
+	}
+
 }
\ No newline at end of file
@@ -6,11 +6,13 @@
 
 namespace GameEngine {
 
+	class Coroutine;
+
 	class Layer
 	{
 	public:
 		Layer(const std::string& name = "Layer");
-		~Layer();
+		virtual ~Layer();
 
 		virtual void OnAttach() {}
 		virtual void OnDetach() {}
@@ -20,6 +22,10 @@ namespace GameEngine {
 
 		inline const std::string& GetName() const { return m_DebugName; }
 	
+	protected:
+		// La coroutine appartiene al layer: quelle ancora sospese vengono cancellate quando il layer viene distrutto.
+		uint64_t StartCoroutine(Coroutine coroutine);
+
 	protected:
 		std::string m_DebugName;
 		bool m_Deleted = false;
@@ -0,0 +1,204 @@
+#include "hzpch.h"
+#include "MathKernelsImpl.h"
+
+namespace GameEngine {
+
+	Frustum Frustum::FromMatrix(const glm::mat4& m)
+	{
+		// Metodo di Gribb-Hartmann: ogni piano è la somma o differenza tra la quarta riga e una delle altre.
+		auto row = [&m](int r) { return glm::vec4(m[0][r], m[1][r], m[2][r], m[3][r]); };
+
+		Frustum frustum;
+		frustum.Planes[0] = row(3) + row(0);
+		frustum.Planes[1] = row(3) - row(0);
+		frustum.Planes[2] = row(3) + row(1);
+		frustum.Planes[3] = row(3) - row(1);
+		frustum.Planes[4] = row(3) + row(2);
+		frustum.Planes[5] = row(3) - row(2);
+		return frustum;
+	}
+
+	#pragma region Scalar
+	namespace MathKernelsScalar {
+
+		void TransformPoints(const glm::mat4& matrix, const glm::vec3* points, glm::vec3* out, uint32_t count)
+		{
+			for (uint32_t i = 0; i < count; i++)
+				out[i] = glm::vec3(matrix * glm::vec4(points[i], 1.0f));
+		}
+
+		void ComposeTRS(const glm::vec3* translations, const glm::quat* rotations, const glm::vec3* scales, glm::mat4* out, uint32_t count)
+		{
+			for (uint32_t i = 0; i < count; i++)
+			{
+				const glm::quat& q = rotations[i];
+				float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+				float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+				float wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+
+				const glm::vec3& s = scales[i];
+				glm::mat4& m = out[i];
+				m[0] = glm::vec4(1.0f - 2.0f * (yy + zz), 2.0f * (xy + wz), 2.0f * (xz - wy), 0.0f) * s.x;
+				m[1] = glm::vec4(2.0f * (xy - wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz + wx), 0.0f) * s.y;
+				m[2] = glm::vec4(2.0f * (xz + wy), 2.0f * (yz - wx), 1.0f - 2.0f * (xx + yy), 0.0f) * s.z;
+				m[3] = glm::vec4(translations[i], 1.0f);
+			}
+		}
+
+		void ComputeQuadCorners(const glm::mat4* transforms, glm::vec3* corners, uint32_t count)
+		{
+			for (uint32_t i = 0; i < count; i++)
+			{
+				const glm::mat4& m = transforms[i];
+				glm::vec3 h0 = glm::vec3(m[0]) * 0.5f;
+				glm::vec3 h1 = glm::vec3(m[1]) * 0.5f;
+				glm::vec3 center = glm::vec3(m[3]);
+
+				corners[i * 4 + 0] = center - h0 - h1;
+				corners[i * 4 + 1] = center + h0 - h1;
+				corners[i * 4 + 2] = center + h0 + h1;
+				corners[i * 4 + 3] = center - h0 + h1;
+			}
+		}
+
+		void CullBoxes(const Frustum& frustum, const BoundingBox* boxes, uint8_t* visible, uint32_t count)
+		{
+			for (uint32_t i = 0; i < count; i++)
+			{
+				glm::vec3 center = (boxes[i].Min + boxes[i].Max) * 0.5f;
+				glm::vec3 extents = (boxes[i].Max - boxes[i].Min) * 0.5f;
+
+				// Il box è fuori se il suo vertice più "interno" rispetto ad un piano sta dalla parte esterna.
+				bool inside = true;
+				for (const glm::vec4& plane : frustum.Planes)
+				{
+					glm::vec3 normal = glm::vec3(plane);
+					float distance = glm::dot(normal, center) + plane.w + glm::dot(glm::abs(normal), extents);
+					inside &= distance >= 0.0f;
+				}
+				visible[i] = inside ? 1 : 0;
+			}
+		}
+
+	}
+	#pragma endregion
+
+	#pragma region Dispatch
+	struct KernelTable
+	{
+		decltype(&MathKernelsScalar::TransformPoints) TransformPoints;
+		decltype(&MathKernelsScalar::ComposeTRS) ComposeTRS;
+		decltype(&MathKernelsScalar::ComputeQuadCorners) ComputeQuadCorners;
+		decltype(&MathKernelsScalar::CullBoxes) CullBoxes;
+	};
+
+	#define HZ_MATH_KERNEL_TABLE(ns) KernelTable{ ns::TransformPoints, ns::ComposeTRS, ns::ComputeQuadCorners, ns::CullBoxes }
+
+	static KernelTable GetKernelTable(SimdLevel level)
+	{
+		switch (level)
+		{
+#ifdef HZ_ARCH_X64
+			case SimdLevel::SSE2:	return HZ_MATH_KERNEL_TABLE(MathKernelsSSE2);
+			case SimdLevel::AVX2:	return HZ_MATH_KERNEL_TABLE(MathKernelsAVX2);
+			case SimdLevel::AVX512:	return HZ_MATH_KERNEL_TABLE(MathKernelsAVX512);
+#endif
+			default:				return HZ_MATH_KERNEL_TABLE(MathKernelsScalar);
+		}
+	}
+
+	static SimdLevel SelectBestLevel()
+	{
+		if (MathKernels::IsSupported(SimdLevel::AVX512))
+			return SimdLevel::AVX512;
+		if (MathKernels::IsSupported(SimdLevel::AVX2))
+			return SimdLevel::AVX2;
+		if (MathKernels::IsSupported(SimdLevel::SSE2))
+			return SimdLevel::SSE2;
+		return SimdLevel::Scalar;
+	}
+
+	struct MathKernelsData
+	{
+		SimdLevel Level;
+		KernelTable Kernels;
+
+		MathKernelsData()
+			: Level(SelectBestLevel()), Kernels(GetKernelTable(Level))
+		{
+			HZ_CORE_INFO("MathKernels: {0}", MathKernels::GetLevelName(Level));
+		}
+	};
+
+	static MathKernelsData& GetData()
+	{
+		static MathKernelsData s_Data;
+		return s_Data;
+	}
+
+	SimdLevel MathKernels::GetLevel()
+	{
+		return GetData().Level;
+	}
+
+	bool MathKernels::SetLevel(SimdLevel level)
+	{
+		if (!IsSupported(level))
+			return false;
+
+		GetData().Level = level;
+		GetData().Kernels = GetKernelTable(level);
+		return true;
+	}
+
+	bool MathKernels::IsSupported(SimdLevel level)
+	{
+#ifdef HZ_ARCH_X64
+		const CPUFeatures& features = CPUInfo::GetFeatures();
+		switch (level)
+		{
+			case SimdLevel::Scalar:	return true;
+			case SimdLevel::SSE2:	return true;
+			case SimdLevel::AVX2:	return features.AVX2 && features.FMA;
+			case SimdLevel::AVX512:	return features.AVX512F;
+		}
+		return false;
+#else
+		return level == SimdLevel::Scalar;
+#endif
+	}
+
+	const char* MathKernels::GetLevelName(SimdLevel level)
+	{
+		switch (level)
+		{
+			case SimdLevel::Scalar:	return "Scalar";
+			case SimdLevel::SSE2:	return "SSE2";
+			case SimdLevel::AVX2:	return "AVX2";
+			case SimdLevel::AVX512:	return "AVX-512";
+		}
+		return "Unknown";
+	}
+	#pragma endregion
+
+	void MathKernels::TransformPoints(const glm::mat4& matrix, const glm::vec3* points, glm::vec3* out, uint32_t count)
+	{
+		GetData().Kernels.TransformPoints(matrix, points, out, count);
+	}
+
+	void MathKernels::ComposeTRS(const glm::vec3* translations, const glm::quat* rotations, const glm::vec3* scales, glm::mat4* out, uint32_t count)
+	{
+		GetData().Kernels.ComposeTRS(translations, rotations, scales, out, count);
+	}
+
+	void MathKernels::ComputeQuadCorners(const glm::mat4* transforms, glm::vec3* corners, uint32_t count)
+	{
+		GetData().Kernels.ComputeQuadCorners(transforms, corners, count);
+	}
+
+	void MathKernels::CullBoxes(const Frustum& frustum, const BoundingBox* boxes, uint8_t* visible, uint32_t count)
+	{
+		GetData().Kernels.CullBoxes(frustum, boxes, visible, count);
+	}
+
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include "GameEngine/Core.h"
+
+namespace GameEngine {
+
+	// AABB 3D (il Physics 2D usa AABB).
+	struct BoundingBox
+	{
+		glm::vec3 Min;
+		glm::vec3 Max;
+	};
+
+	struct Frustum
+	{
+		// Piani nella forma (n, d): un punto p è dalla parte interna se dot(n, p) + d >= 0.
+		// Ordine: sinistra, destra, basso, alto, near, far.
+		std::array<glm::vec4, 6> Planes;
+
+		// Estrae i piani da una matrice projection * view (clip space OpenGL, z in [-w, w]).
+		static Frustum FromMatrix(const glm::mat4& projectionView);
+	};
+
+	enum class SimdLevel
+	{
+		Scalar = 0, SSE2 = 1, AVX2 = 2, AVX512 = 3
+	};
+
+	// Kernel matematici che elaborano array di elementi invece di un oggetto alla volta.
+	// Ogni kernel ha una variante scalare, SSE2, AVX2 e AVX-512: al primo utilizzo viene scelta
+	// la migliore supportata dalla CPU (CPUID). I risultati coincidono con glm a meno di arrotondamenti.
+	// Gli array di input e output non devono sovrapporsi.
+	class MathKernels
+	{
+	public:
+		static SimdLevel GetLevel();
+		// Forza una variante (ad es. per benchmark e confronti); ritorna false se la CPU non la supporta.
+		static bool SetLevel(SimdLevel level);
+		static bool IsSupported(SimdLevel level);
+		static const char* GetLevelName(SimdLevel level);
+
+		// out[i] = matrix * vec4(points[i], 1.0)
+		static void TransformPoints(const glm::mat4& matrix, const glm::vec3* points, glm::vec3* out, uint32_t count);
+		// out[i] = translate(translations[i]) * toMat4(rotations[i]) * scale(scales[i])
+		static void ComposeTRS(const glm::vec3* translations, const glm::quat* rotations, const glm::vec3* scales, glm::mat4* out, uint32_t count);
+		// I 4 vertici del quad unitario trasformato, nell'ordine usato da Renderer2D
+		// (basso-sinistra, basso-destra, alto-destra, alto-sinistra): corners[i * 4 + k] = transforms[i] * vec4(±0.5, ±0.5, 0, 1)
+		static void ComputeQuadCorners(const glm::mat4* transforms, glm::vec3* corners, uint32_t count);
+		// visible[i] = 1 se boxes[i] interseca il frustum (anche parzialmente), altrimenti 0.
+		static void CullBoxes(const Frustum& frustum, const BoundingBox* boxes, uint8_t* visible, uint32_t count);
+	};
+
+}
@@ -0,0 +1,215 @@
+#include "hzpch.h"
+#include "MathKernelsImpl.h"
+
+#ifdef HZ_ARCH_X64
+
+#include <immintrin.h>
+
+namespace GameEngine {
+
+	namespace MathKernelsAVX2 {
+
+		// Trasposizione 4x4 indipendente in ciascuna delle due metà (lane) da 128 bit.
+		HZ_TARGET_AVX2 static inline void TransposeLanes4x4(__m256& r0, __m256& r1, __m256& r2, __m256& r3)
+		{
+			__m256 t0 = _mm256_unpacklo_ps(r0, r1);
+			__m256 t1 = _mm256_unpackhi_ps(r0, r1);
+			__m256 t2 = _mm256_unpacklo_ps(r2, r3);
+			__m256 t3 = _mm256_unpackhi_ps(r2, r3);
+			r0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+			r1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+			r2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+			r3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+		}
+
+		HZ_TARGET_AVX2 static inline __m256 LoadPair(const float* low, const float* high)
+		{
+			return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(low)), _mm_loadu_ps(high), 1);
+		}
+
+		HZ_TARGET_AVX2 static inline void StoreVec3(float* destination, __m128 v)
+		{
+			_mm_storel_pi((__m64*)destination, v);
+			_mm_store_ss(destination + 2, _mm_movehl_ps(v, v));
+		}
+
+		HZ_TARGET_AVX2 void TransformPoints(const glm::mat4& matrix, const glm::vec3* points, glm::vec3* out, uint32_t count)
+		{
+			// Due punti per registro: la metà bassa elabora il punto i, quella alta il punto i + 1.
+			const __m256 c0 = _mm256_broadcast_ps((const __m128*)&matrix[0][0]);
+			const __m256 c1 = _mm256_broadcast_ps((const __m128*)&matrix[1][0]);
+			const __m256 c2 = _mm256_broadcast_ps((const __m128*)&matrix[2][0]);
+			const __m256 c3 = _mm256_broadcast_ps((const __m128*)&matrix[3][0]);
+			const __m256i xIndex = _mm256_setr_epi32(0, 0, 0, 0, 3, 3, 3, 3);
+			const __m256i yIndex = _mm256_setr_epi32(1, 1, 1, 1, 4, 4, 4, 4);
+			const __m256i zIndex = _mm256_setr_epi32(2, 2, 2, 2, 5, 5, 5, 5);
+			const float* src = &points[0].x;
+			float* dst = &out[0].x;
+
+			// La load da 8 float legge 2 float oltre il secondo punto: ci fermiamo quando ne resta almeno un terzo.
+			uint32_t i = 0;
+			for (; i + 3 <= count; i += 2)
+			{
+				__m256 p = _mm256_loadu_ps(src + i * 3);
+				__m256 result = _mm256_fmadd_ps(c0, _mm256_permutevar8x32_ps(p, xIndex), c3);
+				result = _mm256_fmadd_ps(c1, _mm256_permutevar8x32_ps(p, yIndex), result);
+				result = _mm256_fmadd_ps(c2, _mm256_permutevar8x32_ps(p, zIndex), result);
+
+				// Entrambi gli store invadono il float successivo, che appartiene a un punto ancora da scrivere.
+				_mm_storeu_ps(dst + i * 3, _mm256_castps256_ps128(result));
+				_mm_storeu_ps(dst + i * 3 + 3, _mm256_extractf128_ps(result, 1));
+			}
+
+			MathKernelsSSE2::TransformPoints(matrix, points + i, out + i, count - i);
+		}
+
+		HZ_TARGET_AVX2 void ComposeTRS(const glm::vec3* translations, const glm::quat* rotations, const glm::vec3* scales, glm::mat4* out, uint32_t count)
+		{
+			const __m256 one = _mm256_set1_ps(1.0f);
+			const __m256 two = _mm256_set1_ps(2.0f);
+			const __m256 zero = _mm256_setzero_ps();
+			const __m256i vec3Index = _mm256_setr_epi32(0, 3, 6, 9, 12, 15, 18, 21);
+
+			uint32_t i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				// Quaternioni 0-3 nella metà bassa, 4-7 in quella alta.
+				const glm::quat* q = rotations + i;
+				__m256 qx = LoadPair(&q[0].x, &q[4].x);
+				__m256 qy = LoadPair(&q[1].x, &q[5].x);
+				__m256 qz = LoadPair(&q[2].x, &q[6].x);
+				__m256 qw = LoadPair(&q[3].x, &q[7].x);
+				TransposeLanes4x4(qx, qy, qz, qw);
+
+				const float* t = &translations[i].x;
+				const float* s = &scales[i].x;
+				__m256 tx = _mm256_i32gather_ps(t + 0, vec3Index, 4);
+				__m256 ty = _mm256_i32gather_ps(t + 1, vec3Index, 4);
+				__m256 tz = _mm256_i32gather_ps(t + 2, vec3Index, 4);
+				__m256 sx = _mm256_i32gather_ps(s + 0, vec3Index, 4);
+				__m256 sy = _mm256_i32gather_ps(s + 1, vec3Index, 4);
+				__m256 sz = _mm256_i32gather_ps(s + 2, vec3Index, 4);
+
+				__m256 xx = _mm256_mul_ps(qx, qx), yy = _mm256_mul_ps(qy, qy), zz = _mm256_mul_ps(qz, qz);
+				__m256 xy = _mm256_mul_ps(qx, qy), xz = _mm256_mul_ps(qx, qz), yz = _mm256_mul_ps(qy, qz);
+				__m256 wx = _mm256_mul_ps(qw, qx), wy = _mm256_mul_ps(qw, qy), wz = _mm256_mul_ps(qw, qz);
+
+				__m256 m00 = _mm256_mul_ps(_mm256_fnmadd_ps(two, _mm256_add_ps(yy, zz), one), sx);
+				__m256 m01 = _mm256_mul_ps(_mm256_mul_ps(two, _mm256_add_ps(xy, wz)), sx);
+				__m256 m02 = _mm256_mul_ps(_mm256_mul_ps(two, _mm256_sub_ps(xz, wy)), sx);
+				__m256 m03 = zero;
+
+				__m256 m10 = _mm256_mul_ps(_mm256_mul_ps(two, _mm256_sub_ps(xy, wz)), sy);
+				__m256 m11 = _mm256_mul_ps(_mm256_fnmadd_ps(two, _mm256_add_ps(xx, zz), one), sy);
+				__m256 m12 = _mm256_mul_ps(_mm256_mul_ps(two, _mm256_add_ps(yz, wx)), sy);
+				__m256 m13 = zero;
+
+				__m256 m20 = _mm256_mul_ps(_mm256_mul_ps(two, _mm256_add_ps(xz, wy)), sz);
+				__m256 m21 = _mm256_mul_ps(_mm256_mul_ps(two, _mm256_sub_ps(yz, wx)), sz);
+				__m256 m22 = _mm256_mul_ps(_mm256_fnmadd_ps(two, _mm256_add_ps(xx, yy), one), sz);
+				__m256 m23 = zero;
+
+				__m256 m30 = tx, m31 = ty, m32 = tz, m33 = one;
+
+				TransposeLanes4x4(m00, m01, m02, m03);
+				TransposeLanes4x4(m10, m11, m12, m13);
+				TransposeLanes4x4(m20, m21, m22, m23);
+				TransposeLanes4x4(m30, m31, m32, m33);
+
+				// Dopo la trasposizione mXk contiene la colonna X della matrice k (metà bassa) e k + 4 (metà alta).
+				const __m256 columns[4][4] = {
+					{ m00, m10, m20, m30 }, { m01, m11, m21, m31 }, { m02, m12, m22, m32 }, { m03, m13, m23, m33 }
+				};
+				for (uint32_t k = 0; k < 4; k++)
+				{
+					float* low = &out[i + k][0][0];
+					float* high = &out[i + k + 4][0][0];
+					for (uint32_t c = 0; c < 4; c++)
+					{
+						_mm_storeu_ps(low + c * 4, _mm256_castps256_ps128(columns[k][c]));
+						_mm_storeu_ps(high + c * 4, _mm256_extractf128_ps(columns[k][c], 1));
+					}
+				}
+			}
+
+			MathKernelsSSE2::ComposeTRS(translations + i, rotations + i, scales + i, out + i, count - i);
+		}
+
+		HZ_TARGET_AVX2 void ComputeQuadCorners(const glm::mat4* transforms, glm::vec3* corners, uint32_t count)
+		{
+			const __m256 half = _mm256_set1_ps(0.5f);
+			// Metà bassa: vertice a sinistra (-h0), metà alta: vertice a destra (+h0).
+			const __m256 leftRight = _mm256_setr_ps(-1.0f, -1.0f, -1.0f, -1.0f, 1.0f, 1.0f, 1.0f, 1.0f);
+			float* dst = &corners[0].x;
+
+			for (uint32_t i = 0; i < count; i++, dst += 12)
+			{
+				const float* m = &transforms[i][0][0];
+				__m256 h0 = _mm256_mul_ps(_mm256_broadcast_ps((const __m128*)(m + 0)), half);
+				__m256 h1 = _mm256_mul_ps(_mm256_broadcast_ps((const __m128*)(m + 4)), half);
+				__m256 center = _mm256_broadcast_ps((const __m128*)(m + 12));
+
+				// (basso-sinistra | basso-destra) e (alto-destra | alto-sinistra)
+				__m256 bottom = _mm256_sub_ps(_mm256_fmadd_ps(h0, leftRight, center), h1);
+				__m256 top = _mm256_add_ps(_mm256_fnmadd_ps(h0, leftRight, center), h1);
+
+				_mm_storeu_ps(dst + 0, _mm256_castps256_ps128(bottom));
+				_mm_storeu_ps(dst + 3, _mm256_extractf128_ps(bottom, 1));
+				_mm_storeu_ps(dst + 6, _mm256_castps256_ps128(top));
+				if (i + 1 < count)
+					_mm_storeu_ps(dst + 9, _mm256_extractf128_ps(top, 1));
+				else
+					StoreVec3(dst + 9, _mm256_extractf128_ps(top, 1));
+			}
+		}
+
+		HZ_TARGET_AVX2 void CullBoxes(const Frustum& frustum, const BoundingBox* boxes, uint8_t* visible, uint32_t count)
+		{
+			const __m256 half = _mm256_set1_ps(0.5f);
+			const __m256 absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+			const __m256i boxIndex = _mm256_setr_epi32(0, 6, 12, 18, 24, 30, 36, 42);
+
+			uint32_t i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				const float* b = &boxes[i].Min.x;
+				__m256 minX = _mm256_i32gather_ps(b + 0, boxIndex, 4);
+				__m256 minY = _mm256_i32gather_ps(b + 1, boxIndex, 4);
+				__m256 minZ = _mm256_i32gather_ps(b + 2, boxIndex, 4);
+				__m256 maxX = _mm256_i32gather_ps(b + 3, boxIndex, 4);
+				__m256 maxY = _mm256_i32gather_ps(b + 4, boxIndex, 4);
+				__m256 maxZ = _mm256_i32gather_ps(b + 5, boxIndex, 4);
+
+				__m256 cx = _mm256_mul_ps(_mm256_add_ps(minX, maxX), half);
+				__m256 cy = _mm256_mul_ps(_mm256_add_ps(minY, maxY), half);
+				__m256 cz = _mm256_mul_ps(_mm256_add_ps(minZ, maxZ), half);
+				__m256 ex = _mm256_mul_ps(_mm256_sub_ps(maxX, minX), half);
+				__m256 ey = _mm256_mul_ps(_mm256_sub_ps(maxY, minY), half);
+				__m256 ez = _mm256_mul_ps(_mm256_sub_ps(maxZ, minZ), half);
+
+				__m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+				for (const glm::vec4& plane : frustum.Planes)
+				{
+					__m256 nx = _mm256_set1_ps(plane.x), ny = _mm256_set1_ps(plane.y), nz = _mm256_set1_ps(plane.z);
+					__m256 distance = _mm256_fmadd_ps(nx, cx, _mm256_set1_ps(plane.w));
+					distance = _mm256_fmadd_ps(ny, cy, distance);
+					distance = _mm256_fmadd_ps(nz, cz, distance);
+					distance = _mm256_fmadd_ps(_mm256_and_ps(nx, absMask), ex, distance);
+					distance = _mm256_fmadd_ps(_mm256_and_ps(ny, absMask), ey, distance);
+					distance = _mm256_fmadd_ps(_mm256_and_ps(nz, absMask), ez, distance);
+					inside = _mm256_and_ps(inside, _mm256_cmp_ps(distance, _mm256_setzero_ps(), _CMP_GE_OQ));
+				}
+
+				int mask = _mm256_movemask_ps(inside);
+				for (uint32_t k = 0; k < 8; k++)
+					visible[i + k] = (mask >> k) & 1;
+			}
+
+			MathKernelsSSE2::CullBoxes(frustum, boxes + i, visible + i, count - i);
+		}
+
+	}
+
+}
+
+#endif
@@ -0,0 +1,188 @@
+#include "hzpch.h"
+#include "MathKernelsImpl.h"
+
+#ifdef HZ_ARCH_X64
+
+#include <immintrin.h>
+
+namespace GameEngine {
+
+	namespace MathKernelsAVX512 {
+
+		// Ogni lane da 128 bit contiene un vec4: la compress store scarta la w e scrive i vec3 contigui.
+		static constexpr __mmask16 s_Vec3LanesMask = 0x7777;
+
+		// Trasposizione 4x4 indipendente in ciascuna delle quattro lane da 128 bit.
+		HZ_TARGET_AVX512 static inline void TransposeLanes4x4(__m512& r0, __m512& r1, __m512& r2, __m512& r3)
+		{
+			__m512 t0 = _mm512_unpacklo_ps(r0, r1);
+			__m512 t1 = _mm512_unpackhi_ps(r0, r1);
+			__m512 t2 = _mm512_unpacklo_ps(r2, r3);
+			__m512 t3 = _mm512_unpackhi_ps(r2, r3);
+			r0 = _mm512_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+			r1 = _mm512_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+			r2 = _mm512_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+			r3 = _mm512_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+		}
+
+		HZ_TARGET_AVX512 void TransformPoints(const glm::mat4& matrix, const glm::vec3* points, glm::vec3* out, uint32_t count)
+		{
+			// Quattro punti per registro, uno per lane; load e store mascherate non leggono né scrivono oltre l'array.
+			const __m512 c0 = _mm512_broadcast_f32x4(_mm_loadu_ps(&matrix[0][0]));
+			const __m512 c1 = _mm512_broadcast_f32x4(_mm_loadu_ps(&matrix[1][0]));
+			const __m512 c2 = _mm512_broadcast_f32x4(_mm_loadu_ps(&matrix[2][0]));
+			const __m512 c3 = _mm512_broadcast_f32x4(_mm_loadu_ps(&matrix[3][0]));
+			const __m512i xIndex = _mm512_setr_epi32(0, 0, 0, 0, 3, 3, 3, 3, 6, 6, 6, 6, 9, 9, 9, 9);
+			const __m512i yIndex = _mm512_add_epi32(xIndex, _mm512_set1_epi32(1));
+			const __m512i zIndex = _mm512_add_epi32(xIndex, _mm512_set1_epi32(2));
+			const float* src = &points[0].x;
+			float* dst = &out[0].x;
+
+			for (uint32_t i = 0; i < count; i += 4)
+			{
+				uint32_t n = std::min(count - i, 4u);
+				__mmask16 loadMask = (__mmask16)((1u << (n * 3)) - 1);
+				__mmask16 storeMask = (__mmask16)(s_Vec3LanesMask & ((1u << (n * 4)) - 1));
+
+				__m512 p = _mm512_maskz_loadu_ps(loadMask, src + i * 3);
+				__m512 result = _mm512_fmadd_ps(c0, _mm512_permutexvar_ps(xIndex, p), c3);
+				result = _mm512_fmadd_ps(c1, _mm512_permutexvar_ps(yIndex, p), result);
+				result = _mm512_fmadd_ps(c2, _mm512_permutexvar_ps(zIndex, p), result);
+				_mm512_mask_compressstoreu_ps(dst + i * 3, storeMask, result);
+			}
+		}
+
+		HZ_TARGET_AVX512 void ComposeTRS(const glm::vec3* translations, const glm::quat* rotations, const glm::vec3* scales, glm::mat4* out, uint32_t count)
+		{
+			const __m512 one = _mm512_set1_ps(1.0f);
+			const __m512 two = _mm512_set1_ps(2.0f);
+			const __m512 zero = _mm512_setzero_ps();
+			const __m512i vec3Index = _mm512_setr_epi32(0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 33, 36, 39, 42, 45);
+			const __m512i quatIndex = _mm512_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60);
+
+			uint32_t i = 0;
+			for (; i + 16 <= count; i += 16)
+			{
+				const float* q = &rotations[i].x;
+				const float* t = &translations[i].x;
+				const float* s = &scales[i].x;
+				__m512 qx = _mm512_i32gather_ps(quatIndex, q + 0, 4);
+				__m512 qy = _mm512_i32gather_ps(quatIndex, q + 1, 4);
+				__m512 qz = _mm512_i32gather_ps(quatIndex, q + 2, 4);
+				__m512 qw = _mm512_i32gather_ps(quatIndex, q + 3, 4);
+				__m512 sx = _mm512_i32gather_ps(vec3Index, s + 0, 4);
+				__m512 sy = _mm512_i32gather_ps(vec3Index, s + 1, 4);
+				__m512 sz = _mm512_i32gather_ps(vec3Index, s + 2, 4);
+
+				__m512 xx = _mm512_mul_ps(qx, qx), yy = _mm512_mul_ps(qy, qy), zz = _mm512_mul_ps(qz, qz);
+				__m512 xy = _mm512_mul_ps(qx, qy), xz = _mm512_mul_ps(qx, qz), yz = _mm512_mul_ps(qy, qz);
+				__m512 wx = _mm512_mul_ps(qw, qx), wy = _mm512_mul_ps(qw, qy), wz = _mm512_mul_ps(qw, qz);
+
+				__m512 columns[4][4] = {
+					{
+						_mm512_mul_ps(_mm512_fnmadd_ps(two, _mm512_add_ps(yy, zz), one), sx),
+						_mm512_mul_ps(_mm512_mul_ps(two, _mm512_add_ps(xy, wz)), sx),
+						_mm512_mul_ps(_mm512_mul_ps(two, _mm512_sub_ps(xz, wy)), sx),
+						zero
+					},
+					{
+						_mm512_mul_ps(_mm512_mul_ps(two, _mm512_sub_ps(xy, wz)), sy),
+						_mm512_mul_ps(_mm512_fnmadd_ps(two, _mm512_add_ps(xx, zz), one), sy),
+						_mm512_mul_ps(_mm512_mul_ps(two, _mm512_add_ps(yz, wx)), sy),
+						zero
+					},
+					{
+						_mm512_mul_ps(_mm512_mul_ps(two, _mm512_add_ps(xz, wy)), sz),
+						_mm512_mul_ps(_mm512_mul_ps(two, _mm512_sub_ps(yz, wx)), sz),
+						_mm512_mul_ps(_mm512_fnmadd_ps(two, _mm512_add_ps(xx, yy), one), sz),
+						zero
+					},
+					{
+						_mm512_i32gather_ps(vec3Index, t + 0, 4),
+						_mm512_i32gather_ps(vec3Index, t + 1, 4),
+						_mm512_i32gather_ps(vec3Index, t + 2, 4),
+						one
+					}
+				};
+
+				// Dopo la trasposizione la lane L di columns[c][k] è la colonna c della matrice 4 * L + k.
+				for (uint32_t c = 0; c < 4; c++)
+				{
+					TransposeLanes4x4(columns[c][0], columns[c][1], columns[c][2], columns[c][3]);
+					for (uint32_t k = 0; k < 4; k++)
+					{
+						_mm_storeu_ps(&out[i + k + 0][c][0], _mm512_extractf32x4_ps(columns[c][k], 0));
+						_mm_storeu_ps(&out[i + k + 4][c][0], _mm512_extractf32x4_ps(columns[c][k], 1));
+						_mm_storeu_ps(&out[i + k + 8][c][0], _mm512_extractf32x4_ps(columns[c][k], 2));
+						_mm_storeu_ps(&out[i + k + 12][c][0], _mm512_extractf32x4_ps(columns[c][k], 3));
+					}
+				}
+			}
+
+			MathKernelsSSE2::ComposeTRS(translations + i, rotations + i, scales + i, out + i, count - i);
+		}
+
+		HZ_TARGET_AVX512 void ComputeQuadCorners(const glm::mat4* transforms, glm::vec3* corners, uint32_t count)
+		{
+			// Un quad per registro, un vertice per lane: basso-sinistra, basso-destra, alto-destra, alto-sinistra.
+			const __m512 h0Sign = _mm512_setr_ps(-0.5f, -0.5f, -0.5f, -0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, -0.5f, -0.5f, -0.5f, -0.5f);
+			const __m512 h1Sign = _mm512_setr_ps(-0.5f, -0.5f, -0.5f, -0.5f, -0.5f, -0.5f, -0.5f, -0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f);
+			float* dst = &corners[0].x;
+
+			for (uint32_t i = 0; i < count; i++, dst += 12)
+			{
+				const float* m = &transforms[i][0][0];
+				__m512 result = _mm512_broadcast_f32x4(_mm_loadu_ps(m + 12));
+				result = _mm512_fmadd_ps(_mm512_broadcast_f32x4(_mm_loadu_ps(m + 0)), h0Sign, result);
+				result = _mm512_fmadd_ps(_mm512_broadcast_f32x4(_mm_loadu_ps(m + 4)), h1Sign, result);
+				_mm512_mask_compressstoreu_ps(dst, s_Vec3LanesMask, result);
+			}
+		}
+
+		HZ_TARGET_AVX512 void CullBoxes(const Frustum& frustum, const BoundingBox* boxes, uint8_t* visible, uint32_t count)
+		{
+			const __m512 half = _mm512_set1_ps(0.5f);
+			const __m512i boxIndex = _mm512_setr_epi32(0, 6, 12, 18, 24, 30, 36, 42, 48, 54, 60, 66, 72, 78, 84, 90);
+
+			uint32_t i = 0;
+			for (; i + 16 <= count; i += 16)
+			{
+				const float* b = &boxes[i].Min.x;
+				__m512 minX = _mm512_i32gather_ps(boxIndex, b + 0, 4);
+				__m512 minY = _mm512_i32gather_ps(boxIndex, b + 1, 4);
+				__m512 minZ = _mm512_i32gather_ps(boxIndex, b + 2, 4);
+				__m512 maxX = _mm512_i32gather_ps(boxIndex, b + 3, 4);
+				__m512 maxY = _mm512_i32gather_ps(boxIndex, b + 4, 4);
+				__m512 maxZ = _mm512_i32gather_ps(boxIndex, b + 5, 4);
+
+				__m512 cx = _mm512_mul_ps(_mm512_add_ps(minX, maxX), half);
+				__m512 cy = _mm512_mul_ps(_mm512_add_ps(minY, maxY), half);
+				__m512 cz = _mm512_mul_ps(_mm512_add_ps(minZ, maxZ), half);
+				__m512 ex = _mm512_mul_ps(_mm512_sub_ps(maxX, minX), half);
+				__m512 ey = _mm512_mul_ps(_mm512_sub_ps(maxY, minY), half);
+				__m512 ez = _mm512_mul_ps(_mm512_sub_ps(maxZ, minZ), half);
+
+				__mmask16 inside = 0xffff;
+				for (const glm::vec4& plane : frustum.Planes)
+				{
+					__m512 distance = _mm512_fmadd_ps(_mm512_set1_ps(plane.x), cx, _mm512_set1_ps(plane.w));
+					distance = _mm512_fmadd_ps(_mm512_set1_ps(plane.y), cy, distance);
+					distance = _mm512_fmadd_ps(_mm512_set1_ps(plane.z), cz, distance);
+					distance = _mm512_fmadd_ps(_mm512_set1_ps(std::abs(plane.x)), ex, distance);
+					distance = _mm512_fmadd_ps(_mm512_set1_ps(std::abs(plane.y)), ey, distance);
+					distance = _mm512_fmadd_ps(_mm512_set1_ps(std::abs(plane.z)), ez, distance);
+					inside = _mm512_mask_cmp_ps_mask(inside, distance, _mm512_setzero_ps(), _CMP_GE_OQ);
+				}
+
+				for (uint32_t k = 0; k < 16; k++)
+					visible[i + k] = (inside >> k) & 1;
+			}
+
+			MathKernelsSSE2::CullBoxes(frustum, boxes + i, visible + i, count - i);
+		}
+
+	}
+
+}
+
+#endif
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "MathKernels.h"
+#include "GameEngine/Core/CPUInfo.h"
+
+// Dichiarazioni interne: ogni set di istruzioni ha la propria translation unit, così il codice
+// AVX2/AVX-512 viene compilato solo nelle funzioni marcate con HZ_TARGET_* e non contamina il resto.
+#define HZ_DECLARE_MATH_KERNELS(ns) \
+	namespace ns { \
+		void TransformPoints(const glm::mat4& matrix, const glm::vec3* points, glm::vec3* out, uint32_t count); \
+		void ComposeTRS(const glm::vec3* translations, const glm::quat* rotations, const glm::vec3* scales, glm::mat4* out, uint32_t count); \
+		void ComputeQuadCorners(const glm::mat4* transforms, glm::vec3* corners, uint32_t count); \
+		void CullBoxes(const Frustum& frustum, const BoundingBox* boxes, uint8_t* visible, uint32_t count); \
+	}
+
+namespace GameEngine {
+
+	HZ_DECLARE_MATH_KERNELS(MathKernelsScalar)
+#ifdef HZ_ARCH_X64
+	HZ_DECLARE_MATH_KERNELS(MathKernelsSSE2)
+	HZ_DECLARE_MATH_KERNELS(MathKernelsAVX2)
+	HZ_DECLARE_MATH_KERNELS(MathKernelsAVX512)
+#endif
+
+}
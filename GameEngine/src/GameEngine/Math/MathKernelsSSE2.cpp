@@ -0,0 +1,190 @@
+#include "hzpch.h"
+#include "MathKernelsImpl.h"
+
+#ifdef HZ_ARCH_X64
+
+#include <immintrin.h>
+
+namespace GameEngine {
+
+	namespace MathKernelsSSE2 {
+
+		// I kernel leggono glm::vec3/quat/mat4 come array di float contigui.
+		static_assert(sizeof(glm::vec3) == 3 * sizeof(float), "glm::vec3 must be tightly packed");
+		static_assert(sizeof(glm::quat) == 4 * sizeof(float), "glm::quat must be tightly packed");
+		static_assert(sizeof(glm::mat4) == 16 * sizeof(float), "glm::mat4 must be tightly packed");
+
+		// Scrive solo x, y, z: non tocca il float successivo, sicuro anche a fine array.
+		static inline void StoreVec3(float* destination, __m128 v)
+		{
+			_mm_storel_pi((__m64*)destination, v);
+			_mm_store_ss(destination + 2, _mm_movehl_ps(v, v));
+		}
+
+		void TransformPoints(const glm::mat4& matrix, const glm::vec3* points, glm::vec3* out, uint32_t count)
+		{
+			if (count == 0)
+				return;
+
+			const __m128 c0 = _mm_loadu_ps(&matrix[0][0]);
+			const __m128 c1 = _mm_loadu_ps(&matrix[1][0]);
+			const __m128 c2 = _mm_loadu_ps(&matrix[2][0]);
+			const __m128 c3 = _mm_loadu_ps(&matrix[3][0]);
+			const float* src = &points[0].x;
+			float* dst = &out[0].x;
+
+			__m128 result;
+			for (uint32_t i = 0; i < count; i++, src += 3)
+			{
+				result = _mm_add_ps(
+					_mm_add_ps(_mm_mul_ps(c0, _mm_set1_ps(src[0])), _mm_mul_ps(c1, _mm_set1_ps(src[1]))),
+					_mm_add_ps(_mm_mul_ps(c2, _mm_set1_ps(src[2])), c3));
+
+				// Lo store a 4 float invade la x del punto successivo, che verrà sovrascritta al giro dopo.
+				if (i + 1 < count)
+					_mm_storeu_ps(dst + i * 3, result);
+				else
+					StoreVec3(dst + i * 3, result);
+			}
+		}
+
+		void ComposeTRS(const glm::vec3* translations, const glm::quat* rotations, const glm::vec3* scales, glm::mat4* out, uint32_t count)
+		{
+			const __m128 one = _mm_set1_ps(1.0f);
+			const __m128 two = _mm_set1_ps(2.0f);
+			const __m128 zero = _mm_setzero_ps();
+
+			// 4 matrici per iterazione: ogni registro contiene lo stesso elemento di 4 matrici diverse.
+			uint32_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128 qx = _mm_loadu_ps(&rotations[i + 0].x);
+				__m128 qy = _mm_loadu_ps(&rotations[i + 1].x);
+				__m128 qz = _mm_loadu_ps(&rotations[i + 2].x);
+				__m128 qw = _mm_loadu_ps(&rotations[i + 3].x);
+				_MM_TRANSPOSE4_PS(qx, qy, qz, qw);
+
+				const glm::vec3* t = translations + i;
+				const glm::vec3* s = scales + i;
+				__m128 tx = _mm_setr_ps(t[0].x, t[1].x, t[2].x, t[3].x);
+				__m128 ty = _mm_setr_ps(t[0].y, t[1].y, t[2].y, t[3].y);
+				__m128 tz = _mm_setr_ps(t[0].z, t[1].z, t[2].z, t[3].z);
+				__m128 sx = _mm_setr_ps(s[0].x, s[1].x, s[2].x, s[3].x);
+				__m128 sy = _mm_setr_ps(s[0].y, s[1].y, s[2].y, s[3].y);
+				__m128 sz = _mm_setr_ps(s[0].z, s[1].z, s[2].z, s[3].z);
+
+				__m128 xx = _mm_mul_ps(qx, qx), yy = _mm_mul_ps(qy, qy), zz = _mm_mul_ps(qz, qz);
+				__m128 xy = _mm_mul_ps(qx, qy), xz = _mm_mul_ps(qx, qz), yz = _mm_mul_ps(qy, qz);
+				__m128 wx = _mm_mul_ps(qw, qx), wy = _mm_mul_ps(qw, qy), wz = _mm_mul_ps(qw, qz);
+
+				__m128 m00 = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(yy, zz))), sx);
+				__m128 m01 = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xy, wz)), sx);
+				__m128 m02 = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xz, wy)), sx);
+				__m128 m03 = zero;
+
+				__m128 m10 = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xy, wz)), sy);
+				__m128 m11 = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, zz))), sy);
+				__m128 m12 = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(yz, wx)), sy);
+				__m128 m13 = zero;
+
+				__m128 m20 = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xz, wy)), sz);
+				__m128 m21 = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(yz, wx)), sz);
+				__m128 m22 = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, yy))), sz);
+				__m128 m23 = zero;
+
+				__m128 m30 = tx, m31 = ty, m32 = tz, m33 = one;
+
+				// Trasponendo ogni colonna si passa da "un elemento di 4 matrici" a "una colonna di una matrice".
+				_MM_TRANSPOSE4_PS(m00, m01, m02, m03);
+				_MM_TRANSPOSE4_PS(m10, m11, m12, m13);
+				_MM_TRANSPOSE4_PS(m20, m21, m22, m23);
+				_MM_TRANSPOSE4_PS(m30, m31, m32, m33);
+
+				const __m128 columns[4][4] = {
+					{ m00, m10, m20, m30 }, { m01, m11, m21, m31 }, { m02, m12, m22, m32 }, { m03, m13, m23, m33 }
+				};
+				for (uint32_t k = 0; k < 4; k++)
+				{
+					float* m = &out[i + k][0][0];
+					_mm_storeu_ps(m + 0, columns[k][0]);
+					_mm_storeu_ps(m + 4, columns[k][1]);
+					_mm_storeu_ps(m + 8, columns[k][2]);
+					_mm_storeu_ps(m + 12, columns[k][3]);
+				}
+			}
+
+			MathKernelsScalar::ComposeTRS(translations + i, rotations + i, scales + i, out + i, count - i);
+		}
+
+		void ComputeQuadCorners(const glm::mat4* transforms, glm::vec3* corners, uint32_t count)
+		{
+			const __m128 half = _mm_set1_ps(0.5f);
+			float* dst = &corners[0].x;
+
+			for (uint32_t i = 0; i < count; i++, dst += 12)
+			{
+				const float* m = &transforms[i][0][0];
+				__m128 h0 = _mm_mul_ps(_mm_loadu_ps(m + 0), half);
+				__m128 h1 = _mm_mul_ps(_mm_loadu_ps(m + 4), half);
+				__m128 center = _mm_loadu_ps(m + 12);
+
+				__m128 left = _mm_sub_ps(center, h0);
+				__m128 right = _mm_add_ps(center, h0);
+
+				_mm_storeu_ps(dst + 0, _mm_sub_ps(left, h1));
+				_mm_storeu_ps(dst + 3, _mm_sub_ps(right, h1));
+				_mm_storeu_ps(dst + 6, _mm_add_ps(right, h1));
+				if (i + 1 < count)
+					_mm_storeu_ps(dst + 9, _mm_add_ps(left, h1));
+				else
+					StoreVec3(dst + 9, _mm_add_ps(left, h1));
+			}
+		}
+
+		void CullBoxes(const Frustum& frustum, const BoundingBox* boxes, uint8_t* visible, uint32_t count)
+		{
+			const __m128 half = _mm_set1_ps(0.5f);
+			const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+
+			uint32_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				const BoundingBox* b = boxes + i;
+				__m128 minX = _mm_setr_ps(b[0].Min.x, b[1].Min.x, b[2].Min.x, b[3].Min.x);
+				__m128 minY = _mm_setr_ps(b[0].Min.y, b[1].Min.y, b[2].Min.y, b[3].Min.y);
+				__m128 minZ = _mm_setr_ps(b[0].Min.z, b[1].Min.z, b[2].Min.z, b[3].Min.z);
+				__m128 maxX = _mm_setr_ps(b[0].Max.x, b[1].Max.x, b[2].Max.x, b[3].Max.x);
+				__m128 maxY = _mm_setr_ps(b[0].Max.y, b[1].Max.y, b[2].Max.y, b[3].Max.y);
+				__m128 maxZ = _mm_setr_ps(b[0].Max.z, b[1].Max.z, b[2].Max.z, b[3].Max.z);
+
+				__m128 cx = _mm_mul_ps(_mm_add_ps(minX, maxX), half);
+				__m128 cy = _mm_mul_ps(_mm_add_ps(minY, maxY), half);
+				__m128 cz = _mm_mul_ps(_mm_add_ps(minZ, maxZ), half);
+				__m128 ex = _mm_mul_ps(_mm_sub_ps(maxX, minX), half);
+				__m128 ey = _mm_mul_ps(_mm_sub_ps(maxY, minY), half);
+				__m128 ez = _mm_mul_ps(_mm_sub_ps(maxZ, minZ), half);
+
+				__m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+				for (const glm::vec4& plane : frustum.Planes)
+				{
+					__m128 nx = _mm_set1_ps(plane.x), ny = _mm_set1_ps(plane.y), nz = _mm_set1_ps(plane.z);
+					__m128 distance = _mm_add_ps(
+						_mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, cx), _mm_mul_ps(ny, cy)), _mm_add_ps(_mm_mul_ps(nz, cz), _mm_set1_ps(plane.w))),
+						_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_and_ps(nx, absMask), ex), _mm_mul_ps(_mm_and_ps(ny, absMask), ey)),
+							_mm_mul_ps(_mm_and_ps(nz, absMask), ez)));
+					inside = _mm_and_ps(inside, _mm_cmpge_ps(distance, _mm_setzero_ps()));
+				}
+
+				int mask = _mm_movemask_ps(inside);
+				for (uint32_t k = 0; k < 4; k++)
+					visible[i + k] = (mask >> k) & 1;
+			}
+
+			MathKernelsScalar::CullBoxes(frustum, boxes + i, visible + i, count - i);
+		}
+
+	}
+
+}
+
+#endif
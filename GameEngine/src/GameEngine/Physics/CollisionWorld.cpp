@@ -0,0 +1,331 @@
+#include "hzpch.h"
+#include "CollisionWorld.h"
+
+#include "GameEngine/Core/JobSystem.h"
+
+namespace GameEngine {
+
+	// Numero di body (broadphase) o di coppie (narrowphase) elaborati da un singolo job.
+	static const uint32_t s_BroadphaseBatchSize = 1024;
+	static const uint32_t s_NarrowphaseBatchSize = 2048;
+
+	CollisionWorld::CollisionWorld(float margin)
+		: m_Tree(margin)
+	{
+	}
+
+	BodyID CollisionWorld::CreateBody(const ColliderDesc& desc)
+	{
+		BodyID id;
+		if (m_FreeBodies.empty())
+		{
+			id = (BodyID)m_Bodies.size();
+			m_Bodies.emplace_back();
+		}
+		else
+		{
+			id = m_FreeBodies.back();
+			m_FreeBodies.pop_back();
+			m_Bodies[id] = Body();
+		}
+
+		Body& body = m_Bodies[id];
+		body.Type = desc.Type;
+		body.Position = desc.Position;
+		body.HalfExtents = desc.HalfExtents;
+		body.Radius = desc.Radius;
+		body.UserData = desc.UserData;
+		body.ProxyID = m_Tree.CreateProxy(ComputeAABB(body), id);
+		m_CreatedSinceRebuild++;
+		return id;
+	}
+
+	void CollisionWorld::DestroyBody(BodyID id)
+	{
+		Body& body = m_Bodies[id];
+		HZ_CORE_ASSERT(body.ProxyID != DynamicAABBTree::NullNode, "Body already destroyed!");
+
+		m_Tree.DestroyProxy(body.ProxyID);
+		body.ProxyID = DynamicAABBTree::NullNode;
+		m_FreeBodies.push_back(id);
+	}
+
+	void CollisionWorld::SetPosition(BodyID id, const glm::vec2& position)
+	{
+		Body& body = m_Bodies[id];
+		body.Displacement += position - body.Position;
+		body.Position = position;
+
+		if (!body.Moved)
+		{
+			body.Moved = true;
+			m_MovedBodies.push_back(id);
+		}
+	}
+
+	void CollisionWorld::Step()
+	{
+		// L'albero non è thread-safe in scrittura: l'aggiornamento resta sul thread chiamante,
+		// ma tocca solo i body usciti dal proprio AABB grasso.
+		for (BodyID id : m_MovedBodies)
+		{
+			Body& body = m_Bodies[id];
+			if (body.ProxyID != DynamicAABBTree::NullNode)
+				m_Tree.MoveProxy(body.ProxyID, ComputeAABB(body), body.Displacement);
+			body.Displacement = { 0.0f, 0.0f };
+			body.Moved = false;
+		}
+		m_MovedBodies.clear();
+
+		// Dopo una raffica di creazioni (ad es. il caricamento di un livello) l'albero costruito per
+		// inserimenti successivi è di qualità mediocre: lo ricostruiamo una volta sola.
+		if (m_CreatedSinceRebuild > GetBodyCount() / 4)
+		{
+			m_Tree.Rebuild();
+			m_CreatedSinceRebuild = 0;
+		}
+
+		FindPairs();
+		ComputeContacts();
+	}
+
+	void CollisionWorld::FindPairs()
+	{
+		const uint32_t bodyCount = (uint32_t)m_Bodies.size();
+		const uint32_t batchCount = (bodyCount + s_BroadphaseBatchSize - 1) / s_BroadphaseBatchSize;
+		if (m_BatchPairs.size() < batchCount)
+			m_BatchPairs.resize(batchCount);
+
+		JobSystem::ParallelFor(bodyCount, s_BroadphaseBatchSize, [this](uint32_t begin, uint32_t end)
+		{
+			std::vector<uint64_t>& pairs = m_BatchPairs[begin / s_BroadphaseBatchSize];
+			pairs.clear();
+
+			for (BodyID a = begin; a < end; a++)
+			{
+				const Body& body = m_Bodies[a];
+				if (body.ProxyID == DynamicAABBTree::NullNode)
+					continue;
+
+				// Ogni coppia viene riportata solo dal body con indice minore. Interrogando l'albero con
+				// l'AABB esatto non perdiamo contatti: se i collider si toccano, anche gli AABB esatti si intersecano.
+				size_t first = pairs.size();
+				m_Tree.Query(ComputeAABB(body), [&](int32_t proxyID)
+				{
+					BodyID b = m_Tree.GetUserData(proxyID);
+					if (b > a)
+						pairs.push_back(((uint64_t)a << 32) | b);
+					return true;
+				});
+
+				// L'ordine di visita dipende dalla forma dell'albero: ordinando le coppie di ogni body
+				// e concatenando i blocchi in ordine l'output è deterministico.
+				std::sort(pairs.begin() + first, pairs.end());
+			}
+		});
+
+		m_Pairs.clear();
+		for (uint32_t i = 0; i < batchCount; i++)
+			m_Pairs.insert(m_Pairs.end(), m_BatchPairs[i].begin(), m_BatchPairs[i].end());
+	}
+
+	void CollisionWorld::ComputeContacts()
+	{
+		const uint32_t pairCount = (uint32_t)m_Pairs.size();
+		m_PairContacts.resize(pairCount);
+		m_PairTouching.resize(pairCount);
+
+		// Ogni coppia scrive nel proprio slot: nessuna sincronizzazione e nessuna dipendenza dall'ordine dei thread.
+		JobSystem::ParallelFor(pairCount, s_NarrowphaseBatchSize, [this](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t i = begin; i < end; i++)
+			{
+				BodyID a = (BodyID)(m_Pairs[i] >> 32);
+				BodyID b = (BodyID)(m_Pairs[i] & 0xffffffff);
+
+				Contact& contact = m_PairContacts[i];
+				contact.A = a;
+				contact.B = b;
+				m_PairTouching[i] = Collide(m_Bodies[a], m_Bodies[b], contact) ? 1 : 0;
+			}
+		});
+
+		m_Contacts.clear();
+		for (uint32_t i = 0; i < pairCount; i++)
+		{
+			if (m_PairTouching[i])
+				m_Contacts.push_back(m_PairContacts[i]);
+		}
+	}
+
+	bool CollisionWorld::Raycast(const glm::vec2& origin, const glm::vec2& direction, float maxDistance, RaycastHit& hit) const
+	{
+		bool found = false;
+		const glm::vec2 translation = direction * maxDistance;
+
+		m_Tree.Raycast(origin, translation, [&](int32_t proxyID, float maxFraction)
+		{
+			BodyID id = m_Tree.GetUserData(proxyID);
+
+			float distance;
+			glm::vec2 normal;
+			if (!RaycastBody(m_Bodies[id], origin, direction, maxFraction * maxDistance, distance, normal))
+				return maxFraction;
+
+			found = true;
+			hit.Body = id;
+			hit.Distance = distance;
+			hit.Point = origin + direction * distance;
+			hit.Normal = normal;
+			// Accorciamo il raggio: da qui in poi interessano solo i body più vicini.
+			return distance / maxDistance;
+		});
+
+		return found;
+	}
+
+	void CollisionWorld::QueryAABB(const AABB& box, std::vector<BodyID>& result) const
+	{
+		m_Tree.Query(box, [&](int32_t proxyID)
+		{
+			BodyID id = m_Tree.GetUserData(proxyID);
+			// L'albero restituisce gli AABB grassi: ricontrolliamo con quello esatto.
+			if (ComputeAABB(m_Bodies[id]).Overlaps(box))
+				result.push_back(id);
+			return true;
+		});
+	}
+
+	AABB CollisionWorld::ComputeAABB(const Body& body)
+	{
+		const glm::vec2 extents = body.Type == ColliderType::Circle ? glm::vec2(body.Radius) : body.HalfExtents;
+		return { body.Position - extents, body.Position + extents };
+	}
+
+	#pragma region Narrowphase
+	static bool CollideBoxBox(const glm::vec2& posA, const glm::vec2& halfA, const glm::vec2& posB, const glm::vec2& halfB, Contact& contact)
+	{
+		glm::vec2 d = posB - posA;
+		glm::vec2 overlap = (halfA + halfB) - glm::abs(d);
+		if (overlap.x <= 0.0f || overlap.y <= 0.0f)
+			return false;
+
+		// Separiamo lungo l'asse di minima penetrazione.
+		if (overlap.x < overlap.y)
+		{
+			contact.Normal = { d.x < 0.0f ? -1.0f : 1.0f, 0.0f };
+			contact.Depth = overlap.x;
+		}
+		else
+		{
+			contact.Normal = { 0.0f, d.y < 0.0f ? -1.0f : 1.0f };
+			contact.Depth = overlap.y;
+		}
+		return true;
+	}
+
+	static bool CollideCircleCircle(const glm::vec2& posA, float radiusA, const glm::vec2& posB, float radiusB, Contact& contact)
+	{
+		glm::vec2 d = posB - posA;
+		float distanceSq = glm::dot(d, d);
+		float radius = radiusA + radiusB;
+		if (distanceSq >= radius * radius)
+			return false;
+
+		float distance = std::sqrt(distanceSq);
+		contact.Normal = distance > 0.0f ? d / distance : glm::vec2(1.0f, 0.0f);
+		contact.Depth = radius - distance;
+		return true;
+	}
+
+	// Normale dal box verso il cerchio.
+	static bool CollideBoxCircle(const glm::vec2& boxPos, const glm::vec2& half, const glm::vec2& circlePos, float radius, Contact& contact)
+	{
+		glm::vec2 d = circlePos - boxPos;
+		glm::vec2 closest = glm::clamp(d, -half, half);
+
+		if (closest != d)
+		{
+			glm::vec2 delta = d - closest;
+			float distanceSq = glm::dot(delta, delta);
+			if (distanceSq >= radius * radius)
+				return false;
+
+			float distance = std::sqrt(distanceSq);
+			contact.Normal = delta / distance;
+			contact.Depth = radius - distance;
+			return true;
+		}
+
+		// Centro del cerchio dentro il box: usciamo dalla faccia più vicina.
+		glm::vec2 faceDistance = half - glm::abs(d);
+		if (faceDistance.x < faceDistance.y)
+		{
+			contact.Normal = { d.x < 0.0f ? -1.0f : 1.0f, 0.0f };
+			contact.Depth = faceDistance.x + radius;
+		}
+		else
+		{
+			contact.Normal = { 0.0f, d.y < 0.0f ? -1.0f : 1.0f };
+			contact.Depth = faceDistance.y + radius;
+		}
+		return true;
+	}
+
+	bool CollisionWorld::Collide(const Body& a, const Body& b, Contact& contact)
+	{
+		if (a.Type == ColliderType::Box && b.Type == ColliderType::Box)
+			return CollideBoxBox(a.Position, a.HalfExtents, b.Position, b.HalfExtents, contact);
+
+		if (a.Type == ColliderType::Circle && b.Type == ColliderType::Circle)
+			return CollideCircleCircle(a.Position, a.Radius, b.Position, b.Radius, contact);
+
+		if (a.Type == ColliderType::Box)
+			return CollideBoxCircle(a.Position, a.HalfExtents, b.Position, b.Radius, contact);
+
+		// Cerchio contro box: calcoliamo dal punto di vista del box e invertiamo la normale.
+		if (!CollideBoxCircle(b.Position, b.HalfExtents, a.Position, a.Radius, contact))
+			return false;
+		contact.Normal = -contact.Normal;
+		return true;
+	}
+
+	bool CollisionWorld::RaycastBody(const Body& body, const glm::vec2& origin, const glm::vec2& direction, float maxDistance, float& distance, glm::vec2& normal)
+	{
+		if (body.Type == ColliderType::Box)
+		{
+			AABB box = ComputeAABB(body);
+			if (!box.Raycast(origin, direction, maxDistance, distance))
+				return false;
+
+			// La faccia colpita è quella più vicina al punto d'impatto.
+			glm::vec2 local = (origin + direction * distance - body.Position) / body.HalfExtents;
+			if (std::abs(local.x) > std::abs(local.y))
+				normal = { local.x < 0.0f ? -1.0f : 1.0f, 0.0f };
+			else
+				normal = { 0.0f, local.y < 0.0f ? -1.0f : 1.0f };
+			return true;
+		}
+
+		// |origin + t * direction - center|^2 = r^2, con direction normalizzata.
+		glm::vec2 m = origin - body.Position;
+		float b = glm::dot(m, direction);
+		float c = glm::dot(m, m) - body.Radius * body.Radius;
+		if (c > 0.0f && b > 0.0f)
+			return false;
+
+		float discriminant = b * b - c;
+		if (discriminant < 0.0f)
+			return false;
+
+		distance = std::max(-b - std::sqrt(discriminant), 0.0f);
+		if (distance > maxDistance)
+			return false;
+
+		glm::vec2 point = origin + direction * distance;
+		normal = c > 0.0f ? (point - body.Position) / body.Radius : -direction;
+		return true;
+	}
+	#pragma endregion
+
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "DynamicAABBTree.h"
+
+namespace GameEngine {
+
+	using BodyID = uint32_t;
+
+	// Collider allineati agli assi: box (HalfExtents) o cerchi (Radius).
+	enum class ColliderType
+	{
+		Box = 0, Circle = 1
+	};
+
+	struct ColliderDesc
+	{
+		ColliderType Type = ColliderType::Box;
+		glm::vec2 Position = { 0.0f, 0.0f };
+		glm::vec2 HalfExtents = { 0.5f, 0.5f };
+		float Radius = 0.5f;
+		uint32_t UserData = 0;
+	};
+
+	struct Contact
+	{
+		// A < B sempre. La normale va da A verso B: spostando B di Normal * Depth i collider si separano.
+		BodyID A;
+		BodyID B;
+		glm::vec2 Normal;
+		float Depth;
+	};
+
+	struct RaycastHit
+	{
+		BodyID Body;
+		glm::vec2 Point;
+		glm::vec2 Normal;
+		float Distance;
+	};
+
+	// Modulo di collisione 2D: broadphase su DynamicAABBTree, narrowphase parallela sul JobSystem.
+	// Il gioco sposta i body con SetPosition e chiama Step() una volta per frame; i contatti
+	// sono sempre ordinati per (A, B), indipendentemente dal numero di thread.
+	class CollisionWorld
+	{
+	public:
+		CollisionWorld(float margin = 0.1f);
+
+		BodyID CreateBody(const ColliderDesc& desc);
+		void DestroyBody(BodyID body);
+
+		void SetPosition(BodyID body, const glm::vec2& position);
+		inline const glm::vec2& GetPosition(BodyID body) const { return m_Bodies[body].Position; }
+		inline uint32_t GetUserData(BodyID body) const { return m_Bodies[body].UserData; }
+		inline uint32_t GetBodyCount() const { return (uint32_t)(m_Bodies.size() - m_FreeBodies.size()); }
+
+		// Aggiorna il broadphase con i body spostati e ricalcola la lista dei contatti.
+		void Step();
+		inline const std::vector<Contact>& GetContacts() const { return m_Contacts; }
+
+		// Primo body colpito dal raggio (direction deve essere normalizzata).
+		bool Raycast(const glm::vec2& origin, const glm::vec2& direction, float maxDistance, RaycastHit& hit) const;
+		// Aggiunge a result i body il cui collider interseca box.
+		void QueryAABB(const AABB& box, std::vector<BodyID>& result) const;
+
+	private:
+		struct Body
+		{
+			ColliderType Type;
+			glm::vec2 Position;
+			glm::vec2 HalfExtents;
+			float Radius;
+			uint32_t UserData;
+			int32_t ProxyID = DynamicAABBTree::NullNode;
+			// Spostamento accumulato dall'ultimo Step, usato per allargare l'AABB grasso.
+			glm::vec2 Displacement = { 0.0f, 0.0f };
+			bool Moved = false;
+		};
+
+		static AABB ComputeAABB(const Body& body);
+		static bool Collide(const Body& a, const Body& b, Contact& contact);
+		static bool RaycastBody(const Body& body, const glm::vec2& origin, const glm::vec2& direction, float maxDistance, float& distance, glm::vec2& normal);
+
+		void FindPairs();
+		void ComputeContacts();
+
+	private:
+		DynamicAABBTree m_Tree;
+
+		std::vector<Body> m_Bodies;
+		std::vector<BodyID> m_FreeBodies;
+		std::vector<BodyID> m_MovedBodies;
+		// Body creati dall'ultima ricostruzione dell'albero.
+		uint32_t m_CreatedSinceRebuild = 0;
+
+		// Coppie candidate (A << 32 | B) prodotte dal broadphase; un vettore per blocco di body.
+		std::vector<std::vector<uint64_t>> m_BatchPairs;
+		std::vector<uint64_t> m_Pairs;
+		std::vector<Contact> m_PairContacts;
+		std::vector<uint8_t> m_PairTouching;
+		std::vector<Contact> m_Contacts;
+	};
+
+}
@@ -0,0 +1,400 @@
+#include "hzpch.h"
+#include "DynamicAABBTree.h"
+
+namespace GameEngine {
+
+	DynamicAABBTree::DynamicAABBTree(float margin)
+		: m_Margin(margin)
+	{
+	}
+
+	#pragma region Gestione nodi
+	int32_t DynamicAABBTree::AllocateNode()
+	{
+		if (m_FreeList == NullNode)
+		{
+			m_Nodes.emplace_back();
+			Node& node = m_Nodes.back();
+			node.Parent = NullNode;
+			node.Height = 0;
+			return (int32_t)m_Nodes.size() - 1;
+		}
+
+		int32_t nodeID = m_FreeList;
+		Node& node = m_Nodes[nodeID];
+		m_FreeList = node.Next;
+		node.Parent = NullNode;
+		node.Child1 = NullNode;
+		node.Child2 = NullNode;
+		node.Height = 0;
+		node.UserData = 0;
+		return nodeID;
+	}
+
+	void DynamicAABBTree::FreeNode(int32_t nodeID)
+	{
+		Node& node = m_Nodes[nodeID];
+		node.Next = m_FreeList;
+		node.Height = -1;
+		m_FreeList = nodeID;
+	}
+	#pragma endregion
+
+	int32_t DynamicAABBTree::CreateProxy(const AABB& box, uint32_t userData)
+	{
+		int32_t proxyID = AllocateNode();
+
+		Node& node = m_Nodes[proxyID];
+		node.Box.Min = box.Min - glm::vec2(m_Margin);
+		node.Box.Max = box.Max + glm::vec2(m_Margin);
+		node.UserData = userData;
+
+		InsertLeaf(proxyID);
+		return proxyID;
+	}
+
+	void DynamicAABBTree::DestroyProxy(int32_t proxyID)
+	{
+		HZ_CORE_ASSERT(m_Nodes[proxyID].IsLeaf(), "Proxy is not a leaf!");
+
+		RemoveLeaf(proxyID);
+		FreeNode(proxyID);
+	}
+
+	bool DynamicAABBTree::MoveProxy(int32_t proxyID, const AABB& box, const glm::vec2& displacement)
+	{
+		HZ_CORE_ASSERT(m_Nodes[proxyID].IsLeaf(), "Proxy is not a leaf!");
+
+		AABB fatBox = { box.Min - glm::vec2(m_Margin), box.Max + glm::vec2(m_Margin) };
+
+		if (m_Nodes[proxyID].Box.Contains(box))
+		{
+			// Il box grasso è ancora valido, a meno che non sia diventato molto più grande del necessario
+			// (ad es. dopo un movimento veloce seguito da uno stop): in quel caso lo ristringiamo.
+			AABB hugeBox = { fatBox.Min - glm::vec2(4.0f * m_Margin), fatBox.Max + glm::vec2(4.0f * m_Margin) };
+			if (hugeBox.Contains(m_Nodes[proxyID].Box))
+				return false;
+		}
+
+		RemoveLeaf(proxyID);
+
+		// Allarghiamo il box nella direzione del movimento: se l'oggetto continua a muoversi
+		// così resterà nel box più a lungo.
+		const glm::vec2 predicted = 2.0f * displacement;
+		fatBox.Min = glm::min(fatBox.Min, fatBox.Min + predicted);
+		fatBox.Max = glm::max(fatBox.Max, fatBox.Max + predicted);
+		m_Nodes[proxyID].Box = fatBox;
+
+		InsertLeaf(proxyID);
+		return true;
+	}
+
+	void DynamicAABBTree::InsertLeaf(int32_t leaf)
+	{
+		if (m_Root == NullNode)
+		{
+			m_Root = leaf;
+			m_Nodes[m_Root].Parent = NullNode;
+			return;
+		}
+
+		// Discesa verso il fratello migliore: ad ogni livello scegliamo il figlio il cui
+		// perimetro cresce meno includendo la nuova foglia.
+		const AABB leafBox = m_Nodes[leaf].Box;
+		int32_t index = m_Root;
+		while (!m_Nodes[index].IsLeaf())
+		{
+			const Node& node = m_Nodes[index];
+			int32_t child1 = node.Child1;
+			int32_t child2 = node.Child2;
+
+			float perimeter = node.Box.GetPerimeter();
+			float combinedPerimeter = AABB::Union(node.Box, leafBox).GetPerimeter();
+
+			// Costo di creare un nuovo genitore per questo nodo e la foglia.
+			float cost = 2.0f * combinedPerimeter;
+			// Costo minimo di spingere la foglia più in basso.
+			float inheritanceCost = 2.0f * (combinedPerimeter - perimeter);
+
+			auto descendCost = [&](int32_t child)
+			{
+				const AABB& childBox = m_Nodes[child].Box;
+				float newPerimeter = AABB::Union(leafBox, childBox).GetPerimeter();
+				if (m_Nodes[child].IsLeaf())
+					return newPerimeter + inheritanceCost;
+				return (newPerimeter - childBox.GetPerimeter()) + inheritanceCost;
+			};
+
+			float cost1 = descendCost(child1);
+			float cost2 = descendCost(child2);
+
+			if (cost < cost1 && cost < cost2)
+				break;
+
+			index = cost1 < cost2 ? child1 : child2;
+		}
+
+		int32_t sibling = index;
+
+		int32_t oldParent = m_Nodes[sibling].Parent;
+		int32_t newParent = AllocateNode();
+		m_Nodes[newParent].Parent = oldParent;
+		m_Nodes[newParent].Box = AABB::Union(leafBox, m_Nodes[sibling].Box);
+		m_Nodes[newParent].Height = m_Nodes[sibling].Height + 1;
+		m_Nodes[newParent].Child1 = sibling;
+		m_Nodes[newParent].Child2 = leaf;
+		m_Nodes[sibling].Parent = newParent;
+		m_Nodes[leaf].Parent = newParent;
+
+		if (oldParent != NullNode)
+		{
+			if (m_Nodes[oldParent].Child1 == sibling)
+				m_Nodes[oldParent].Child1 = newParent;
+			else
+				m_Nodes[oldParent].Child2 = newParent;
+		}
+		else
+		{
+			m_Root = newParent;
+		}
+
+		// Risaliamo fino alla radice aggiornando altezze e box e ribilanciando.
+		index = m_Nodes[leaf].Parent;
+		while (index != NullNode)
+		{
+			index = Balance(index);
+
+			int32_t child1 = m_Nodes[index].Child1;
+			int32_t child2 = m_Nodes[index].Child2;
+			m_Nodes[index].Height = 1 + std::max(m_Nodes[child1].Height, m_Nodes[child2].Height);
+			m_Nodes[index].Box = AABB::Union(m_Nodes[child1].Box, m_Nodes[child2].Box);
+
+			index = m_Nodes[index].Parent;
+		}
+	}
+
+	void DynamicAABBTree::RemoveLeaf(int32_t leaf)
+	{
+		if (leaf == m_Root)
+		{
+			m_Root = NullNode;
+			return;
+		}
+
+		int32_t parent = m_Nodes[leaf].Parent;
+		int32_t grandParent = m_Nodes[parent].Parent;
+		int32_t sibling = m_Nodes[parent].Child1 == leaf ? m_Nodes[parent].Child2 : m_Nodes[parent].Child1;
+
+		if (grandParent == NullNode)
+		{
+			m_Root = sibling;
+			m_Nodes[sibling].Parent = NullNode;
+			FreeNode(parent);
+			return;
+		}
+
+		// Il fratello prende il posto del genitore, che viene liberato.
+		if (m_Nodes[grandParent].Child1 == parent)
+			m_Nodes[grandParent].Child1 = sibling;
+		else
+			m_Nodes[grandParent].Child2 = sibling;
+		m_Nodes[sibling].Parent = grandParent;
+		FreeNode(parent);
+
+		int32_t index = grandParent;
+		while (index != NullNode)
+		{
+			index = Balance(index);
+
+			int32_t child1 = m_Nodes[index].Child1;
+			int32_t child2 = m_Nodes[index].Child2;
+			m_Nodes[index].Box = AABB::Union(m_Nodes[child1].Box, m_Nodes[child2].Box);
+			m_Nodes[index].Height = 1 + std::max(m_Nodes[child1].Height, m_Nodes[child2].Height);
+
+			index = m_Nodes[index].Parent;
+		}
+	}
+
+	// Se i sottoalberi di A differiscono in altezza di più di 1, il figlio più alto viene
+	// promosso al posto di A (rotazione). Ritorna la nuova radice del sottoalbero.
+	int32_t DynamicAABBTree::Balance(int32_t iA)
+	{
+		Node& A = m_Nodes[iA];
+		if (A.IsLeaf() || A.Height < 2)
+			return iA;
+
+		int32_t iB = A.Child1;
+		int32_t iC = A.Child2;
+		Node& B = m_Nodes[iB];
+		Node& C = m_Nodes[iC];
+
+		int32_t balance = C.Height - B.Height;
+
+		// Ruota C verso l'alto
+		if (balance > 1)
+		{
+			int32_t iF = C.Child1;
+			int32_t iG = C.Child2;
+			Node& F = m_Nodes[iF];
+			Node& G = m_Nodes[iG];
+
+			C.Child1 = iA;
+			C.Parent = A.Parent;
+			A.Parent = iC;
+
+			if (C.Parent != NullNode)
+			{
+				if (m_Nodes[C.Parent].Child1 == iA)
+					m_Nodes[C.Parent].Child1 = iC;
+				else
+					m_Nodes[C.Parent].Child2 = iC;
+			}
+			else
+			{
+				m_Root = iC;
+			}
+
+			if (F.Height > G.Height)
+			{
+				C.Child2 = iF;
+				A.Child2 = iG;
+				G.Parent = iA;
+				A.Box = AABB::Union(B.Box, G.Box);
+				C.Box = AABB::Union(A.Box, F.Box);
+				A.Height = 1 + std::max(B.Height, G.Height);
+				C.Height = 1 + std::max(A.Height, F.Height);
+			}
+			else
+			{
+				C.Child2 = iG;
+				A.Child2 = iF;
+				F.Parent = iA;
+				A.Box = AABB::Union(B.Box, F.Box);
+				C.Box = AABB::Union(A.Box, G.Box);
+				A.Height = 1 + std::max(B.Height, F.Height);
+				C.Height = 1 + std::max(A.Height, G.Height);
+			}
+
+			return iC;
+		}
+
+		// Ruota B verso l'alto
+		if (balance < -1)
+		{
+			int32_t iD = B.Child1;
+			int32_t iE = B.Child2;
+			Node& D = m_Nodes[iD];
+			Node& E = m_Nodes[iE];
+
+			B.Child1 = iA;
+			B.Parent = A.Parent;
+			A.Parent = iB;
+
+			if (B.Parent != NullNode)
+			{
+				if (m_Nodes[B.Parent].Child1 == iA)
+					m_Nodes[B.Parent].Child1 = iB;
+				else
+					m_Nodes[B.Parent].Child2 = iB;
+			}
+			else
+			{
+				m_Root = iB;
+			}
+
+			if (D.Height > E.Height)
+			{
+				B.Child2 = iD;
+				A.Child1 = iE;
+				E.Parent = iA;
+				A.Box = AABB::Union(C.Box, E.Box);
+				B.Box = AABB::Union(A.Box, D.Box);
+				A.Height = 1 + std::max(C.Height, E.Height);
+				B.Height = 1 + std::max(A.Height, D.Height);
+			}
+			else
+			{
+				B.Child2 = iE;
+				A.Child1 = iD;
+				D.Parent = iA;
+				A.Box = AABB::Union(C.Box, D.Box);
+				B.Box = AABB::Union(A.Box, E.Box);
+				A.Height = 1 + std::max(C.Height, D.Height);
+				B.Height = 1 + std::max(A.Height, E.Height);
+			}
+
+			return iB;
+		}
+
+		return iA;
+	}
+
+	void DynamicAABBTree::Rebuild()
+	{
+		if (m_Root == NullNode)
+			return;
+
+		// Le foglie mantengono il proprio indice (è l'ID del proxy), i nodi interni vengono liberati e ricreati.
+		std::vector<int32_t> leaves;
+		std::vector<int32_t> internalNodes;
+		leaves.reserve(m_Nodes.size() / 2 + 1);
+		internalNodes.reserve(m_Nodes.size() / 2);
+		for (int32_t i = 0; i < (int32_t)m_Nodes.size(); i++)
+		{
+			if (m_Nodes[i].Height < 0)
+				continue;
+
+			if (m_Nodes[i].IsLeaf())
+				leaves.push_back(i);
+			else
+				internalNodes.push_back(i);
+		}
+
+		// La free list è LIFO: liberando gli indici dal più alto, AllocateNode li restituisce in ordine crescente.
+		// Sono esattamente quelli che servono (n foglie, n - 1 nodi interni).
+		for (auto it = internalNodes.rbegin(); it != internalNodes.rend(); ++it)
+			FreeNode(*it);
+
+		m_Root = BuildTopDown(leaves.data(), (int32_t)leaves.size());
+		m_Nodes[m_Root].Parent = NullNode;
+	}
+
+	int32_t DynamicAABBTree::BuildTopDown(int32_t* leaves, int32_t count)
+	{
+		if (count == 1)
+			return leaves[0];
+
+		glm::vec2 centroidMin = glm::vec2(std::numeric_limits<float>::max());
+		glm::vec2 centroidMax = glm::vec2(std::numeric_limits<float>::lowest());
+		for (int32_t i = 0; i < count; i++)
+		{
+			const AABB& box = m_Nodes[leaves[i]].Box;
+			glm::vec2 centroid = (box.Min + box.Max) * 0.5f;
+			centroidMin = glm::min(centroidMin, centroid);
+			centroidMax = glm::max(centroidMax, centroid);
+		}
+
+		const int axis = (centroidMax.x - centroidMin.x) > (centroidMax.y - centroidMin.y) ? 0 : 1;
+		const int32_t half = count / 2;
+		std::nth_element(leaves, leaves + half, leaves + count, [this, axis](int32_t a, int32_t b)
+		{
+			return m_Nodes[a].Box.Min[axis] + m_Nodes[a].Box.Max[axis] < m_Nodes[b].Box.Min[axis] + m_Nodes[b].Box.Max[axis];
+		});
+
+		// Il genitore viene allocato prima dei figli: gli indici dei nodi interni crescono in ordine depth-first,
+		// lo stesso in cui le query li visitano. Non sono contigui, perché tra di loro restano le foglie.
+		int32_t parent = AllocateNode();
+		int32_t child1 = BuildTopDown(leaves, half);
+		int32_t child2 = BuildTopDown(leaves + half, count - half);
+
+		Node& node = m_Nodes[parent];
+		node.Child1 = child1;
+		node.Child2 = child2;
+		node.Box = AABB::Union(m_Nodes[child1].Box, m_Nodes[child2].Box);
+		node.Height = 1 + std::max(m_Nodes[child1].Height, m_Nodes[child2].Height);
+		m_Nodes[child1].Parent = parent;
+		m_Nodes[child2].Parent = parent;
+		return parent;
+	}
+
+}
@@ -0,0 +1,202 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include "GameEngine/Core.h"
+
+namespace GameEngine {
+
+	struct AABB
+	{
+		glm::vec2 Min = { 0.0f, 0.0f };
+		glm::vec2 Max = { 0.0f, 0.0f };
+
+		inline bool Overlaps(const AABB& other) const
+		{
+			return Min.x <= other.Max.x && Max.x >= other.Min.x
+				&& Min.y <= other.Max.y && Max.y >= other.Min.y;
+		}
+
+		inline bool Contains(const AABB& other) const
+		{
+			return Min.x <= other.Min.x && Min.y <= other.Min.y
+				&& Max.x >= other.Max.x && Max.y >= other.Max.y;
+		}
+
+		// Perimetro: metrica usata dall'euristica di inserimento (in 2D sostituisce l'area delle SAH 3D).
+		inline float GetPerimeter() const { return 2.0f * ((Max.x - Min.x) + (Max.y - Min.y)); }
+
+		// Slab test: ritorna true se il segmento origin + t * translation, t in [0, maxFraction],
+		// interseca il box; fraction è il t di ingresso (0 se origin è già all'interno).
+		bool Raycast(const glm::vec2& origin, const glm::vec2& translation, float maxFraction, float& fraction) const
+		{
+			float tMin = 0.0f;
+			float tMax = maxFraction;
+			for (int axis = 0; axis < 2; axis++)
+			{
+				if (translation[axis] == 0.0f)
+				{
+					if (origin[axis] < Min[axis] || origin[axis] > Max[axis])
+						return false;
+					continue;
+				}
+
+				float inv = 1.0f / translation[axis];
+				float t1 = (Min[axis] - origin[axis]) * inv;
+				float t2 = (Max[axis] - origin[axis]) * inv;
+				tMin = std::max(tMin, std::min(t1, t2));
+				tMax = std::min(tMax, std::max(t1, t2));
+				if (tMin > tMax)
+					return false;
+			}
+
+			fraction = tMin;
+			return true;
+		}
+
+		static AABB Union(const AABB& a, const AABB& b)
+		{
+			return { glm::min(a.Min, b.Min), glm::max(a.Max, b.Max) };
+		}
+	};
+
+	// Bounding volume hierarchy dinamica (stessa struttura del broadphase di Box2D).
+	// Ogni proxy è memorizzato con un AABB "grasso", allargato di un margine e nella direzione
+	// dello spostamento: finché l'oggetto resta al suo interno MoveProxy non modifica l'albero,
+	// quindi il costo di aggiornamento è proporzionale ai soli oggetti che escono dal proprio margine.
+	// L'albero viene mantenuto bilanciato con rotazioni AVL.
+	class DynamicAABBTree
+	{
+	public:
+		static const int32_t NullNode = -1;
+
+		DynamicAABBTree(float margin = 0.1f);
+
+		int32_t CreateProxy(const AABB& box, uint32_t userData);
+		void DestroyProxy(int32_t proxyID);
+		// Ritorna true se il proxy è stato reinserito nell'albero.
+		bool MoveProxy(int32_t proxyID, const AABB& box, const glm::vec2& displacement);
+
+		inline uint32_t GetUserData(int32_t proxyID) const { return m_Nodes[proxyID].UserData; }
+		inline const AABB& GetFatAABB(int32_t proxyID) const { return m_Nodes[proxyID].Box; }
+
+		// callback(proxyID) per ogni proxy il cui AABB grasso interseca box; se ritorna false la ricerca si interrompe.
+		// Le query sono di sola lettura e possono essere eseguite in parallelo da più thread.
+		template<typename Callback>
+		void Query(const AABB& box, Callback&& callback) const;
+
+		// callback(proxyID, maxFraction) ritorna la nuova frazione massima del raggio:
+		// 0 interrompe la ricerca, un valore minore accorcia il raggio, maxFraction lo lascia invariato.
+		template<typename Callback>
+		void Raycast(const glm::vec2& origin, const glm::vec2& translation, Callback&& callback) const;
+
+		// Ricostruisce l'albero dall'alto (split a metà lungo l'asse più lungo) mantenendo gli stessi proxy.
+		// L'inserimento incrementale è ottimo per pochi oggetti alla volta, ma dopo molte creazioni
+		// consecutive (ad es. al caricamento di un livello) un albero ricostruito è molto più veloce da interrogare.
+		void Rebuild();
+
+		int32_t GetHeight() const { return m_Root == NullNode ? 0 : m_Nodes[m_Root].Height; }
+
+	private:
+		struct Node
+		{
+			AABB Box;
+			union
+			{
+				int32_t Parent;
+				int32_t Next;	// Nodi liberi
+			};
+			int32_t Child1 = NullNode;
+			int32_t Child2 = NullNode;
+			// Foglia = 0, nodo libero = -1.
+			int32_t Height = -1;
+			uint32_t UserData = 0;
+
+			inline bool IsLeaf() const { return Child1 == NullNode; }
+		};
+
+		int32_t AllocateNode();
+		void FreeNode(int32_t nodeID);
+
+		void InsertLeaf(int32_t leaf);
+		void RemoveLeaf(int32_t leaf);
+		int32_t Balance(int32_t nodeID);
+		int32_t BuildTopDown(int32_t* leaves, int32_t count);
+
+	private:
+		std::vector<Node> m_Nodes;
+		int32_t m_Root = NullNode;
+		int32_t m_FreeList = NullNode;
+		float m_Margin;
+	};
+
+	template<typename Callback>
+	void DynamicAABBTree::Query(const AABB& box, Callback&& callback) const
+	{
+		if (m_Root == NullNode)
+			return;
+
+		// Stack locale: l'altezza di un albero bilanciato resta piccola anche con milioni di proxy.
+		int32_t stack[256];
+		int32_t count = 0;
+		stack[count++] = m_Root;
+
+		while (count > 0)
+		{
+			int32_t nodeID = stack[--count];
+			const Node& node = m_Nodes[nodeID];
+			if (!node.Box.Overlaps(box))
+				continue;
+
+			if (node.IsLeaf())
+			{
+				if (!callback(nodeID))
+					return;
+			}
+			else
+			{
+				HZ_CORE_ASSERT(count + 2 <= 256, "DynamicAABBTree query stack overflow!");
+				stack[count++] = node.Child1;
+				stack[count++] = node.Child2;
+			}
+		}
+	}
+
+	template<typename Callback>
+	void DynamicAABBTree::Raycast(const glm::vec2& origin, const glm::vec2& translation, Callback&& callback) const
+	{
+		if (m_Root == NullNode)
+			return;
+
+		float maxFraction = 1.0f;
+
+		int32_t stack[256];
+		int32_t count = 0;
+		stack[count++] = m_Root;
+
+		while (count > 0)
+		{
+			int32_t nodeID = stack[--count];
+			const Node& node = m_Nodes[nodeID];
+
+			float entry;
+			if (!node.Box.Raycast(origin, translation, maxFraction, entry))
+				continue;
+
+			if (node.IsLeaf())
+			{
+				float fraction = callback(nodeID, maxFraction);
+				if (fraction == 0.0f)
+					return;
+				maxFraction = std::min(maxFraction, fraction);
+			}
+			else
+			{
+				HZ_CORE_ASSERT(count + 2 <= 256, "DynamicAABBTree raycast stack overflow!");
+				stack[count++] = node.Child1;
+				stack[count++] = node.Child2;
+			}
+		}
+	}
+
+}
@@ -2,13 +2,14 @@
 #include "Buffer.h"
 
 #include "Renderer.h"
+#include "RenderCapture.h"
 #include "Platform/OpenGL/OpenGLBuffer.h"
 
 namespace GameEngine {
 
 	// Qui decidiamo quale API user il Renderer.
 
-	VertexBuffer* GameEngine::VertexBuffer::Create(float* vertices, uint32_t size)
+	VertexBuffer* GameEngine::VertexBuffer::Create(uint32_t size)
 	{
 		switch (Renderer::GetAPI())
 		{
@@ -19,7 +20,26 @@ namespace GameEngine {
 			}
 
 			case RendererAPI::API::OpenGL:
-				return new OpenGLVertexBuffer(vertices, size);
+				return RenderCapture::Capture(new OpenGLVertexBuffer(size), nullptr, size);
+
+		}
+
+		HZ_CORE_ASSERT(false, "Unknown Renderer API!");
+		return nullptr;
+	}
+
+	VertexBuffer* GameEngine::VertexBuffer::Create(const void* vertices, uint32_t size)
+	{
+		switch (Renderer::GetAPI())
+		{
+			case RendererAPI::API::None:
+			{
+				HZ_CORE_ASSERT(false, "RendererAPI::None is currently not supported");
+				return nullptr;
+			}
+
+			case RendererAPI::API::OpenGL:
+				return RenderCapture::Capture(new OpenGLVertexBuffer(vertices, size), vertices, size);
 
 		}
 
@@ -36,7 +56,7 @@ namespace GameEngine {
 				return nullptr;
 
 			case RendererAPI::API::OpenGL:
-				return new OpenGLIndexBuffer(indices, count);
+				return RenderCapture::Capture(new OpenGLIndexBuffer(indices, count), indices, count);
 
 		}
 		return nullptr;
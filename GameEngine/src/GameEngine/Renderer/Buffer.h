@@ -2,32 +2,80 @@
 
 namespace GameEngine {
 
+	// I tipi con suffisso N sono normalizzati: gli interi vengono letti dallo shader come float
+	// in [0, 1] (unsigned) o [-1, 1] (signed). I tipi Int/UInt/UByte4/Bool restano interi anche nello shader (ivec/uvec).
 	enum class ShaderDataType
 	{
-		None = 0, Float, Float2, Float3, Float4, Mat3, Mat4, Int, Int2, Int3, Int4, Bool
+		None = 0, Float, Float2, Float3, Float4, Mat3, Mat4, Int, Int2, Int3, Int4, UInt, Bool,
+		// Formati compatti: occupano da 2 a 4 volte meno memoria dei corrispettivi a 32 bit.
+		Half, Half2, Half4, UByte4, UByte4N, Short2N, UShort2N, Int1010102N, UInt1010102N
 	};
 
 	static uint32_t ShaderDataTypeSize(ShaderDataType type)
 	{
 		switch (type)
 		{
-			case ShaderDataType::Float:		return 4;
-			case ShaderDataType::Float2:	return 4 * 2;
-			case ShaderDataType::Float3:	return 4 * 3;
-			case ShaderDataType::Float4:	return 4 * 4;
-			case ShaderDataType::Mat3:		return 4 * 3 * 3;
-			case ShaderDataType::Mat4:		return 4 * 4 * 4;
-			case ShaderDataType::Int:		return 4;
-			case ShaderDataType::Int2:		return 4 * 2;
-			case ShaderDataType::Int3:		return 4 * 3;
-			case ShaderDataType::Int4:		return 4 * 4;
-			case ShaderDataType::Bool:		return 1;
+			case ShaderDataType::Float:			return 4;
+			case ShaderDataType::Float2:		return 4 * 2;
+			case ShaderDataType::Float3:		return 4 * 3;
+			case ShaderDataType::Float4:		return 4 * 4;
+			case ShaderDataType::Mat3:			return 4 * 3 * 3;
+			case ShaderDataType::Mat4:			return 4 * 4 * 4;
+			case ShaderDataType::Int:			return 4;
+			case ShaderDataType::Int2:			return 4 * 2;
+			case ShaderDataType::Int3:			return 4 * 3;
+			case ShaderDataType::Int4:			return 4 * 4;
+			case ShaderDataType::UInt:			return 4;
+			case ShaderDataType::Bool:			return 1;
+			case ShaderDataType::Half:			return 2;
+			case ShaderDataType::Half2:			return 2 * 2;
+			case ShaderDataType::Half4:			return 2 * 4;
+			case ShaderDataType::UByte4:		return 4;
+			case ShaderDataType::UByte4N:		return 4;
+			case ShaderDataType::Short2N:		return 2 * 2;
+			case ShaderDataType::UShort2N:		return 2 * 2;
+			case ShaderDataType::Int1010102N:	return 4;
+			case ShaderDataType::UInt1010102N:	return 4;
 		}
 
 		HZ_CORE_ASSERT(false, "Unknown ShaderDataType!");
 		return 0;
 	}
 
+	// Gli attributi interi devono essere passati con glVertexAttribIPointer (o equivalente),
+	// altrimenti la GPU li converte in float.
+	static bool ShaderDataTypeIsInteger(ShaderDataType type)
+	{
+		switch (type)
+		{
+			case ShaderDataType::Int:
+			case ShaderDataType::Int2:
+			case ShaderDataType::Int3:
+			case ShaderDataType::Int4:
+			case ShaderDataType::UInt:
+			case ShaderDataType::UByte4:
+			case ShaderDataType::Bool:
+				return true;
+			default:
+				return false;
+		}
+	}
+
+	static bool ShaderDataTypeIsNormalized(ShaderDataType type)
+	{
+		switch (type)
+		{
+			case ShaderDataType::UByte4N:
+			case ShaderDataType::Short2N:
+			case ShaderDataType::UShort2N:
+			case ShaderDataType::Int1010102N:
+			case ShaderDataType::UInt1010102N:
+				return true;
+			default:
+				return false;
+		}
+	}
+
 	struct BufferElement
 	{
 		std::string Name;
@@ -37,7 +85,7 @@ namespace GameEngine {
 		bool Normalized;
 
 		BufferElement(ShaderDataType type, const std::string& name, bool normalized = false)
-			: Name(name), Type(type), Size(ShaderDataTypeSize(type)), Offset(0), Normalized(normalized)
+			: Name(name), Type(type), Size(ShaderDataTypeSize(type)), Offset(0), Normalized(normalized || ShaderDataTypeIsNormalized(type))
 		{
 		}
 
@@ -45,19 +93,34 @@ namespace GameEngine {
 		{
 			switch (Type)
 			{
-				case ShaderDataType::Float:		return 1;
-				case ShaderDataType::Float2:	return 2;
-				case ShaderDataType::Float3:	return 3;
-				case ShaderDataType::Float4:	return 4;
-				case ShaderDataType::Mat3:		return 3 * 3;
-				case ShaderDataType::Mat4:		return 4 * 4;
-				case ShaderDataType::Int:		return 1;
-				case ShaderDataType::Int2:		return 2;
-				case ShaderDataType::Int3:		return 3;
-				case ShaderDataType::Int4:		return 4;
-				case ShaderDataType::Bool:		return 1;
+				case ShaderDataType::Float:			return 1;
+				case ShaderDataType::Float2:		return 2;
+				case ShaderDataType::Float3:		return 3;
+				case ShaderDataType::Float4:		return 4;
+				case ShaderDataType::Mat3:			return 3 * 3;
+				case ShaderDataType::Mat4:			return 4 * 4;
+				case ShaderDataType::Int:			return 1;
+				case ShaderDataType::Int2:			return 2;
+				case ShaderDataType::Int3:			return 3;
+				case ShaderDataType::Int4:			return 4;
+				case ShaderDataType::UInt:			return 1;
+				case ShaderDataType::Bool:			return 1;
+				case ShaderDataType::Half:			return 1;
+				case ShaderDataType::Half2:			return 2;
+				case ShaderDataType::Half4:			return 4;
+				case ShaderDataType::UByte4:		return 4;
+				case ShaderDataType::UByte4N:		return 4;
+				case ShaderDataType::Short2N:		return 2;
+				case ShaderDataType::UShort2N:		return 2;
+				case ShaderDataType::Int1010102N:	return 4;
+				case ShaderDataType::UInt1010102N:	return 4;
 			}
+
+			HZ_CORE_ASSERT(false, "Unknown ShaderDataType!");
+			return 0;
 		}
+
+		inline bool IsInteger() const { return ShaderDataTypeIsInteger(Type); }
 	};
 
 	class BufferLayout
@@ -72,6 +135,12 @@ namespace GameEngine {
 			CalculateOffsetAndStride();
 		}
 
+		BufferLayout(const std::vector<BufferElement>& elements)
+			: m_Elements(elements)
+		{
+			CalculateOffsetAndStride();
+		}
+
 		inline uint32_t GetStride() const { return m_Stride; }
 		inline const std::vector<BufferElement>& GetElements() const { return m_Elements; }
 
@@ -106,10 +175,23 @@ namespace GameEngine {
 		virtual void Bind() const = 0;
 		virtual void Unbind() const = 0;
 
+		// Aggiorna il contenuto del buffer a partire dall'inizio (usato dai buffer dinamici).
+		virtual void SetData(const void* data, uint32_t size) = 0;
+
+		// Mappa i primi size byte del buffer in sola scrittura. Il contenuto precedente viene scartato,
+		// così il driver può fornire nuova memoria invece di attendere che la GPU finisca di leggerlo.
+		virtual void* Map(uint32_t size) = 0;
+		virtual void Unmap() = 0;
+
+		// Byte validi: la dimensione iniziale per i buffer statici, l'ultimo SetData()/Map() per quelli dinamici.
+		virtual uint32_t GetSize() const = 0;
+
 		virtual const BufferLayout& GetLayout() const = 0;
 		virtual void SetLayout(const BufferLayout& layout) = 0;
 
-		static VertexBuffer* Create(float* vertices, uint32_t size);
+		// Buffer dinamico: viene allocato vuoto e riempito ogni frame con SetData().
+		static VertexBuffer* Create(uint32_t size);
+		static VertexBuffer* Create(const void* vertices, uint32_t size);
 	};
 
 	class IndexBuffer
@@ -121,7 +203,11 @@ namespace GameEngine {
 		virtual void Unbind() const = 0;
 
 		virtual uint32_t GetCount() const = 0;
+		// Dimensione in byte di un indice (2 o 4).
+		virtual uint32_t GetIndexSize() const = 0;
 
+		// Se tutti gli indici sono < 65536 il buffer viene salvato a 16 bit:
+		// metà della memoria e della banda rispetto a 32 bit, senza cambiare nulla per il chiamante.
 		static IndexBuffer* Create(uint32_t* indices, uint32_t count);
 
 	};
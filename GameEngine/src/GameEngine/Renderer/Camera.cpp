@@ -0,0 +1,40 @@
+#include "hzpch.h"
+#include "Camera.h"
+
+namespace GameEngine {
+
+	const glm::mat4& Camera::GetProjectionMatrix() const
+	{
+		if (m_ProjectionDirty)
+		{
+			m_ProjectionMatrix = CalculateProjectionMatrix();
+			m_ProjectionDirty = false;
+			m_ProjectionViewDirty = true;
+		}
+		return m_ProjectionMatrix;
+	}
+
+	const glm::mat4& Camera::GetViewMatrix() const
+	{
+		if (m_ViewDirty)
+		{
+			m_ViewMatrix = CalculateViewMatrix();
+			m_ViewDirty = false;
+			m_ProjectionViewDirty = true;
+		}
+		return m_ViewMatrix;
+	}
+
+	const glm::mat4& Camera::GetProjectionViewMatrix() const
+	{
+		const glm::mat4& projection = GetProjectionMatrix();
+		const glm::mat4& view = GetViewMatrix();
+		if (m_ProjectionViewDirty)
+		{
+			m_ProjectionViewMatrix = projection * view;
+			m_ProjectionViewDirty = false;
+		}
+		return m_ProjectionViewMatrix;
+	}
+
+}
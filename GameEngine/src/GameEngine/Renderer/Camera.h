@@ -0,0 +1,42 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+namespace GameEngine {
+
+	// Base comune delle camere. Le matrici sono calcolate in modo lazy: i setter segnano solo
+	// la matrice come da ricalcolare, e il ricalcolo avviene alla prima lettura successiva.
+	// Impostare posizione e rotazione nello stesso frame costa quindi un solo ricalcolo.
+	class Camera
+	{
+	public:
+		virtual ~Camera() = default;
+
+		const glm::vec3& GetPosition() const { return m_Position; }
+		void SetPosition(const glm::vec3& position) { m_Position = position; InvalidateView(); }
+
+		const glm::mat4& GetProjectionMatrix() const;
+		const glm::mat4& GetViewMatrix() const;
+		const glm::mat4& GetProjectionViewMatrix() const;
+
+	protected:
+		virtual glm::mat4 CalculateProjectionMatrix() const = 0;
+		virtual glm::mat4 CalculateViewMatrix() const = 0;
+
+		void InvalidateProjection() { m_ProjectionDirty = true; }
+		void InvalidateView() { m_ViewDirty = true; }
+
+	protected:
+		glm::vec3 m_Position = { 0.0f, 0.0f, 0.0f };
+
+	private:
+		mutable glm::mat4 m_ProjectionMatrix = glm::mat4(1.0f);
+		mutable glm::mat4 m_ViewMatrix = glm::mat4(1.0f);
+		mutable glm::mat4 m_ProjectionViewMatrix = glm::mat4(1.0f);
+
+		mutable bool m_ProjectionDirty = true;
+		mutable bool m_ViewDirty = true;
+		mutable bool m_ProjectionViewDirty = true;
+	};
+
+}
@@ -0,0 +1,138 @@
+#include "hzpch.h"
+#include "CulledInstanceBatch.h"
+
+#include "RenderCommand.h"
+
+namespace GameEngine {
+
+	// Il compute shader scrive il comando attraverso questo binding; la draw lo legge come GL_DRAW_INDIRECT_BUFFER.
+	static const uint32_t s_CommandBinding = 2;
+	static const uint32_t s_GroupSize = 64;
+
+	// Piani estratti come in Frustum::FromMatrix e test dell'AABB come in MathKernels::CullBoxes.
+	static const char* s_CullShaderSource = R"(
+		#version 450 core
+
+		layout(local_size_x = 64) in;
+
+		layout(std140, binding = 0) uniform ViewData
+		{
+			mat4 u_ProjectionView;
+			mat4 u_View;
+			mat4 u_Projection;
+			vec4 u_CameraPosition;
+		};
+
+		struct InstanceRecord
+		{
+			mat4 Transform;
+			vec4 BoundsMin;
+			vec4 BoundsMax;
+		};
+
+		layout(std430, binding = 0) readonly buffer InstanceData
+		{
+			InstanceRecord u_Instances[];
+		};
+
+		layout(std430, binding = 1) writeonly buffer VisibleInstances
+		{
+			uint u_VisibleInstances[];
+		};
+
+		layout(std430, binding = 2) buffer DrawCommand
+		{
+			uint u_Count;
+			uint u_InstanceCount;
+			uint u_FirstIndex;
+			int u_BaseVertex;
+			uint u_BaseInstance;
+		};
+
+		uniform int u_TotalInstances;
+
+		vec4 Row(int r)
+		{
+			return vec4(u_ProjectionView[0][r], u_ProjectionView[1][r], u_ProjectionView[2][r], u_ProjectionView[3][r]);
+		}
+
+		void main()
+		{
+			uint index = gl_GlobalInvocationID.x;
+			if (index >= uint(u_TotalInstances))
+				return;
+
+			vec4 planes[6] = vec4[6](Row(3) + Row(0), Row(3) - Row(0), Row(3) + Row(1), Row(3) - Row(1), Row(3) + Row(2), Row(3) - Row(2));
+
+			vec3 center = (u_Instances[index].BoundsMin.xyz + u_Instances[index].BoundsMax.xyz) * 0.5;
+			vec3 extents = (u_Instances[index].BoundsMax.xyz - u_Instances[index].BoundsMin.xyz) * 0.5;
+			for (int i = 0; i < 6; i++)
+			{
+				if (dot(planes[i].xyz, center) + planes[i].w + dot(abs(planes[i].xyz), extents) < 0.0)
+					return;
+			}
+
+			u_VisibleInstances[atomicAdd(u_InstanceCount, 1u)] = index;
+		}
+	)";
+
+	CulledInstanceBatch::CulledInstanceBatch(const Ref<Shader>& shader, const Ref<VertexArray>& mesh)
+		: m_Shader(shader), m_Mesh(mesh)
+	{
+		m_CullShader.reset(Shader::CreateCompute(s_CullShaderSource));
+		m_Command.reset(StorageBuffer::Create(5 * sizeof(uint32_t), s_CommandBinding));
+	}
+
+	void CulledInstanceBatch::SetInstances(const glm::mat4* transforms, const BoundingBox* bounds, uint32_t count)
+	{
+		m_Instances.resize(count);
+		for (uint32_t i = 0; i < count; i++)
+			m_Instances[i] = { transforms[i], glm::vec4(bounds[i].Min, 0.0f), glm::vec4(bounds[i].Max, 0.0f) };
+		m_InstancesDirty = true;
+	}
+
+	void CulledInstanceBatch::SetInstance(uint32_t index, const glm::mat4& transform, const BoundingBox& bounds)
+	{
+		HZ_CORE_ASSERT(index < m_Instances.size(), "Instance index out of range!");
+		m_Instances[index] = { transform, glm::vec4(bounds.Min, 0.0f), glm::vec4(bounds.Max, 0.0f) };
+
+		// Prima del primo Draw i buffer verranno comunque caricati per intero.
+		if (!m_InstancesDirty)
+			m_InstanceData->SetData(&m_Instances[index], sizeof(InstanceRecord), index * sizeof(InstanceRecord));
+	}
+
+	void CulledInstanceBatch::Draw()
+	{
+		uint32_t count = (uint32_t)m_Instances.size();
+		if (count == 0)
+			return;
+
+		if (m_InstancesDirty)
+		{
+			uint32_t size = count * sizeof(InstanceRecord);
+			if (!m_InstanceData || m_InstanceData->GetSize() < size)
+			{
+				m_InstanceData.reset(StorageBuffer::Create(size, InstanceDataBinding));
+				m_VisibleInstances.reset(StorageBuffer::Create(count * sizeof(uint32_t), VisibleInstancesBinding));
+			}
+			m_InstanceData->SetData(m_Instances.data(), size);
+			m_InstancesDirty = false;
+		}
+
+		// Il compute shader parte da zero istanze e incrementa instanceCount per ogni istanza visibile.
+		uint32_t command[5] = { m_Mesh->GetIndexBuffers()->GetCount(), 0, 0, 0, 0 };
+		m_Command->SetData(command, sizeof(command));
+
+		m_CullShader->Bind();
+		m_CullShader->SetInt("u_TotalInstances", (int)count);
+		m_InstanceData->Bind(InstanceDataBinding);
+		m_VisibleInstances->Bind(VisibleInstancesBinding);
+		m_Command->Bind(s_CommandBinding);
+		RenderCommand::DispatchCompute((count + s_GroupSize - 1) / s_GroupSize);
+
+		m_Shader->Bind();
+		m_Mesh->Bind();
+		RenderCommand::DrawIndexedIndirect(m_Mesh, m_Command, 1);
+	}
+
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "GameEngine/Core.h"
+#include "GameEngine/Renderer/Shader.h"
+#include "GameEngine/Renderer/VertexArray.h"
+#include "GameEngine/Renderer/StorageBuffer.h"
+#include "GameEngine/Math/MathKernels.h"
+
+#include <glm/glm.hpp>
+
+namespace GameEngine {
+
+	// Istanze della stessa mesh con il frustum culling eseguito sulla GPU, senza readback:
+	// - transform e AABB in world space di tutte le istanze stanno in uno storage buffer, caricato solo quando cambia;
+	// - Draw esegue un compute shader che testa ogni AABB con il frustum della camera dell'ultimo BeginScene
+	//   (stesso test di MathKernels::CullBoxes) e accoda gli indici delle istanze visibili;
+	// - il contatore delle istanze visibili è l'instanceCount del comando indiretto, che la draw legge direttamente.
+	// L'ordine delle istanze visibili non è deterministico: adatto a geometria opaca o con depth test.
+	//
+	// Lo shader di disegno riceve l'istanza con gl_InstanceID e dichiara:
+	// struct InstanceRecord { mat4 Transform; vec4 BoundsMin; vec4 BoundsMax; };
+	// layout(std430, binding = 0) readonly buffer InstanceData { InstanceRecord u_Instances[]; };
+	// layout(std430, binding = 1) readonly buffer VisibleInstances { uint u_VisibleInstances[]; };
+	class CulledInstanceBatch
+	{
+	public:
+		static const uint32_t InstanceDataBinding = 0;
+		static const uint32_t VisibleInstancesBinding = 1;
+
+		CulledInstanceBatch(const Ref<Shader>& shader, const Ref<VertexArray>& mesh);
+
+		// Sostituisce tutte le istanze.
+		void SetInstances(const glm::mat4* transforms, const BoundingBox* bounds, uint32_t count);
+		// Aggiorna una sola istanza, caricando solo il suo record.
+		void SetInstance(uint32_t index, const glm::mat4& transform, const BoundingBox& bounds);
+
+		// Culling e draw delle istanze visibili. Come Renderer::Submit, usa la camera dell'ultimo BeginScene.
+		void Draw();
+
+		inline uint32_t GetInstanceCount() const { return (uint32_t)m_Instances.size(); }
+
+	private:
+		// Stesso layout dell'InstanceRecord std430.
+		struct InstanceRecord
+		{
+			glm::mat4 Transform;
+			glm::vec4 BoundsMin;
+			glm::vec4 BoundsMax;
+		};
+
+	private:
+		Ref<Shader> m_Shader;
+		Ref<Shader> m_CullShader;
+		Ref<VertexArray> m_Mesh;
+
+		std::vector<InstanceRecord> m_Instances;
+		Ref<StorageBuffer> m_InstanceData;
+		Ref<StorageBuffer> m_VisibleInstances;
+		Ref<StorageBuffer> m_Command;
+		bool m_InstancesDirty = false;
+	};
+
+}
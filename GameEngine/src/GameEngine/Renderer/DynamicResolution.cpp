@@ -0,0 +1,111 @@
+#include "hzpch.h"
+#include "DynamicResolution.h"
+
+#include "RenderCommand.h"
+
+#include <cmath>
+
+namespace GameEngine {
+
+	// Dopo un cambio di scala le misure ancora in volo si riferiscono alla risoluzione precedente.
+	static const uint32_t s_SettleSamples = 4;
+	// Variazione massima della scala per correzione: evita oscillazioni con misure rumorose.
+	static const float s_MaxScaleStep = 0.1f;
+
+	DynamicResolution::DynamicResolution(uint32_t width, uint32_t height, const DynamicResolutionSettings& settings)
+		: m_Settings(settings), m_Width(width), m_Height(height)
+	{
+		FramebufferSpecification spec;
+		spec.Width = width;
+		spec.Height = height;
+		spec.Attachments = { FramebufferTextureFormat::RGBA8, FramebufferTextureFormat::Depth24Stencil8 };
+		m_Framebuffer.reset(Framebuffer::Create(spec));
+		m_GPUTimer.reset(GPUTimer::Create());
+
+		SetScale(m_Settings.MaxScale);
+	}
+
+	void DynamicResolution::Begin()
+	{
+		m_Framebuffer->Bind();
+		RenderCommand::SetViewport(0, 0, m_RenderWidth, m_RenderHeight);
+		m_GPUTimer->Begin();
+	}
+
+	void DynamicResolution::End()
+	{
+		m_GPUTimer->End();
+		m_Framebuffer->Unbind();
+
+		m_Framebuffer->BlitToScreen(m_RenderWidth, m_RenderHeight, m_Width, m_Height);
+		RenderCommand::SetViewport(0, 0, m_Width, m_Height);
+
+		UpdateScale();
+	}
+
+	void DynamicResolution::Resize(uint32_t width, uint32_t height)
+	{
+		if (width == 0 || height == 0)
+			return;
+
+		m_Width = width;
+		m_Height = height;
+		m_Framebuffer->Resize(width, height);
+		SetScale(m_Scale);
+	}
+
+	void DynamicResolution::SetEnabled(bool enabled)
+	{
+		m_Enabled = enabled;
+		if (!m_Enabled)
+			SetScale(m_Settings.MaxScale);
+	}
+
+	void DynamicResolution::UpdateScale()
+	{
+		uint32_t sampleIndex = m_GPUTimer->GetSampleIndex();
+		if (sampleIndex == m_LastSampleIndex)
+			return;
+		m_LastSampleIndex = sampleIndex;
+
+		if (!m_Enabled)
+			return;
+
+		if (m_SkipSamples > 0)
+		{
+			m_SkipSamples--;
+			return;
+		}
+
+		m_SampleTotal += m_GPUTimer->GetMilliseconds();
+		if (++m_SampleCount < m_Settings.SampleWindow)
+			return;
+
+		float average = m_SampleTotal / m_SampleCount;
+		m_SampleTotal = 0.0f;
+		m_SampleCount = 0;
+
+		const float target = m_Settings.TargetFrameTime;
+		if (average <= 0.0f || (average <= target && average >= target * m_Settings.Headroom))
+			return;
+
+		// Il costo di una scena limitata dal fill rate è proporzionale ai pixel, cioè al quadrato della scala:
+		// puntiamo al centro della fascia [Target * Headroom, Target].
+		float goal = target * (1.0f + m_Settings.Headroom) * 0.5f;
+		float scale = m_Scale * std::sqrt(goal / average);
+		scale = std::min(std::max(scale, m_Scale - s_MaxScaleStep), m_Scale + s_MaxScaleStep);
+		SetScale(scale);
+	}
+
+	void DynamicResolution::SetScale(float scale)
+	{
+		float previous = m_Scale;
+		m_Scale = std::min(std::max(scale, m_Settings.MinScale), m_Settings.MaxScale);
+		m_RenderWidth = std::max(1u, (uint32_t)(m_Width * m_Scale + 0.5f));
+		m_RenderHeight = std::max(1u, (uint32_t)(m_Height * m_Scale + 0.5f));
+
+		if (m_Scale != previous)
+			m_SkipSamples = s_SettleSamples;
+	}
+
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "Framebuffer.h"
+#include "GPUTimer.h"
+
+namespace GameEngine {
+
+	struct DynamicResolutionSettings
+	{
+		// Tempo GPU desiderato per la scena, in millisecondi.
+		float TargetFrameTime = 1000.0f / 60.0f;
+		// Fattori di scala per lato: 0.5 disegna un quarto dei pixel.
+		float MinScale = 0.5f;
+		float MaxScale = 1.0f;
+		// Sotto TargetFrameTime * Headroom c'è margine e la scala può risalire.
+		float Headroom = 0.85f;
+		// Numero di misure GPU mediate prima di ogni correzione.
+		uint32_t SampleWindow = 8;
+	};
+
+	// Disegna la scena in un framebuffer a risoluzione ridotta e la scala fino alla finestra.
+	// La scala viene scelta dai tempi GPU recenti, così le scene limitate dal fill rate mantengono il tempo obiettivo.
+	//
+	//	m_DynamicResolution.Begin();
+	//	... BeginScene/Submit/EndScene, viewport = GetRenderWidth() x GetRenderHeight() ...
+	//	m_DynamicResolution.End();
+	class DynamicResolution
+	{
+	public:
+		DynamicResolution(uint32_t width, uint32_t height, const DynamicResolutionSettings& settings = DynamicResolutionSettings());
+
+		// Attiva il framebuffer e imposta il viewport alla risoluzione di rendering corrente.
+		void Begin();
+		// Copia l'immagine nel backbuffer alla risoluzione della finestra e aggiorna la scala.
+		void End();
+
+		// Dimensioni di output (la finestra). Il framebuffer è allocato a piena risoluzione:
+		// cambiare la scala non rialloca nulla, si usa solo una porzione degli attachment.
+		void Resize(uint32_t width, uint32_t height);
+
+		// Disabilitata, la scala resta a MaxScale.
+		void SetEnabled(bool enabled);
+		inline bool IsEnabled() const { return m_Enabled; }
+
+		inline float GetScale() const { return m_Scale; }
+		inline uint32_t GetRenderWidth() const { return m_RenderWidth; }
+		inline uint32_t GetRenderHeight() const { return m_RenderHeight; }
+		inline uint32_t GetOutputWidth() const { return m_Width; }
+		inline uint32_t GetOutputHeight() const { return m_Height; }
+		// Ultimo tempo GPU misurato per la scena, in millisecondi.
+		inline float GetGPUTime() const { return m_GPUTimer->GetMilliseconds(); }
+
+		inline DynamicResolutionSettings& GetSettings() { return m_Settings; }
+		inline const Ref<Framebuffer>& GetFramebuffer() const { return m_Framebuffer; }
+
+	private:
+		void UpdateScale();
+		void SetScale(float scale);
+
+	private:
+		DynamicResolutionSettings m_Settings;
+		Ref<Framebuffer> m_Framebuffer;
+		Ref<GPUTimer> m_GPUTimer;
+
+		uint32_t m_Width, m_Height;
+		uint32_t m_RenderWidth, m_RenderHeight;
+		float m_Scale = 1.0f;
+		bool m_Enabled = true;
+
+		uint32_t m_LastSampleIndex = 0;
+		uint32_t m_SkipSamples = 0;
+		uint32_t m_SampleCount = 0;
+		float m_SampleTotal = 0.0f;
+	};
+
+}
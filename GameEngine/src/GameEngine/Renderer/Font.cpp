@@ -0,0 +1,225 @@
+#include "hzpch.h"
+#include "Font.h"
+
+#include <fstream>
+
+// Usiamo la copia di stb_truetype distribuita con ImGui. Con STBTT_STATIC l'implementazione resta privata
+// a questo file e non entra in conflitto con quella compilata da imgui_draw.cpp.
+#define STBTT_STATIC
+#define STB_TRUETYPE_IMPLEMENTATION
+#include "imstb_truetype.h"
+
+namespace GameEngine {
+
+	// Oltre questo numero di stringhe la cache viene svuotata: il testo che cambia ogni frame
+	// (contatori, timer) non deve farla crescere senza limite.
+	static const size_t s_MaxCachedLayouts = 4096;
+
+	// Valore del campo sul contorno del glifo: lo shader usa 0.5 come soglia.
+	static const uint8_t s_OnEdgeValue = 128;
+
+	static uint32_t DecodeUTF8(const std::string& text, size_t& index)
+	{
+		uint8_t c = (uint8_t)text[index++];
+		if (c < 0x80)
+			return c;
+
+		uint32_t length = c >= 0xF0 ? 3 : c >= 0xE0 ? 2 : c >= 0xC0 ? 1 : 0;
+		if (length == 0)
+			return 0xFFFD;
+
+		uint32_t codepoint = c & (0x3F >> length);
+		for (uint32_t i = 0; i < length; i++)
+		{
+			if (index >= text.size() || ((uint8_t)text[index] & 0xC0) != 0x80)
+				return 0xFFFD;
+			codepoint = (codepoint << 6) | ((uint8_t)text[index++] & 0x3F);
+		}
+		return codepoint;
+	}
+
+	Font::Font(const std::string& path, uint32_t glyphSize, uint32_t padding, uint32_t pageSize)
+		: m_GlyphSize(glyphSize), m_Padding(padding), m_PageSize(pageSize)
+	{
+		std::ifstream in(path, std::ios::binary | std::ios::ate);
+		if (!in)
+		{
+			HZ_CORE_ERROR("Could not open font '{0}'", path);
+			return;
+		}
+
+		m_FontData.resize((size_t)in.tellg());
+		in.seekg(0);
+		in.read((char*)m_FontData.data(), m_FontData.size());
+
+		stbtt_fontinfo* info = new stbtt_fontinfo();
+		int offset = stbtt_GetFontOffsetForIndex(m_FontData.data(), 0);
+		if (offset < 0 || !stbtt_InitFont(info, m_FontData.data(), offset))
+		{
+			HZ_CORE_ERROR("'{0}' is not a valid TrueType font", path);
+			delete info;
+			return;
+		}
+
+		m_FontInfo = info;
+		m_Scale = stbtt_ScaleForPixelHeight(info, (float)glyphSize);
+
+		int ascent, descent, lineGap;
+		stbtt_GetFontVMetrics(info, &ascent, &descent, &lineGap);
+		m_LineHeight = (ascent - descent + lineGap) * m_Scale / glyphSize;
+	}
+
+	Font::~Font()
+	{
+		delete (stbtt_fontinfo*)m_FontInfo;
+	}
+
+	const FontGlyph& Font::GetGlyph(uint32_t codepoint)
+	{
+		auto it = m_Glyphs.find(codepoint);
+		if (it != m_Glyphs.end())
+			return it->second;
+
+		const stbtt_fontinfo* info = (const stbtt_fontinfo*)m_FontInfo;
+		FontGlyph& glyph = m_Glyphs[codepoint];
+
+		int advance, leftSideBearing;
+		stbtt_GetCodepointHMetrics(info, (int)codepoint, &advance, &leftSideBearing);
+		glyph.Advance = advance * m_Scale / m_GlyphSize;
+
+		// pixelDistScale: di quanto cambia il valore per ogni pixel di distanza, così il padding copre tutto l'intervallo.
+		float pixelDistScale = (float)s_OnEdgeValue / m_Padding;
+		int width, height, xOffset, yOffset;
+		uint8_t* distance = stbtt_GetCodepointSDF(info, m_Scale, (int)codepoint, (int)m_Padding, s_OnEdgeValue, pixelDistScale,
+			&width, &height, &xOffset, &yOffset);
+		if (!distance)
+			return glyph;
+
+		if (AddToAtlas(distance, (uint32_t)width, (uint32_t)height, glyph))
+		{
+			// stb_truetype ha l'asse y verso il basso: yOffset è la distanza del bordo superiore dalla baseline.
+			glyph.PlaneMin = { (float)xOffset / m_GlyphSize, -(float)(yOffset + height) / m_GlyphSize };
+			glyph.PlaneMax = { (float)(xOffset + width) / m_GlyphSize, -(float)yOffset / m_GlyphSize };
+		}
+		stbtt_FreeSDF(distance, nullptr);
+		return glyph;
+	}
+
+	bool Font::AddToAtlas(const uint8_t* distance, uint32_t width, uint32_t height, FontGlyph& glyph)
+	{
+		uint32_t x = 0, y = 0;
+		uint32_t pageIndex = 0;
+		for (; pageIndex < m_Pages.size(); pageIndex++)
+		{
+			if (m_Pages[pageIndex].Packer.Pack(width, height, x, y))
+				break;
+		}
+
+		if (pageIndex == m_Pages.size())
+		{
+			Page page = { Ref<Texture2D>(Texture2D::Create(m_PageSize, m_PageSize)), SkylinePacker(m_PageSize, m_PageSize) };
+			if (!page.Packer.Pack(width, height, x, y))
+			{
+				HZ_CORE_WARN("Glyph of {0}x{1} pixels does not fit in a {2}x{2} font page", width, height, m_PageSize);
+				return false;
+			}
+
+			// Il colore è bianco, la distanza va nell'alpha: così la pagina è una normale texture RGBA8.
+			page.Pixels.resize((size_t)m_PageSize * m_PageSize * 4);
+			for (size_t i = 0; i < page.Pixels.size(); i += 4)
+			{
+				page.Pixels[i + 0] = 255;
+				page.Pixels[i + 1] = 255;
+				page.Pixels[i + 2] = 255;
+				page.Pixels[i + 3] = 0;
+			}
+			m_Pages.push_back(std::move(page));
+		}
+
+		Page& page = m_Pages[pageIndex];
+		for (uint32_t row = 0; row < height; row++)
+		{
+			uint8_t* destination = &page.Pixels[(((size_t)y + row) * m_PageSize + x) * 4 + 3];
+			for (uint32_t column = 0; column < width; column++)
+				destination[column * 4] = distance[row * width + column];
+		}
+		page.Dirty = true;
+
+		// La prima riga del bitmap è il bordo superiore del glifo.
+		glyph.UVMin = { (float)x / m_PageSize, (float)(y + height) / m_PageSize };
+		glyph.UVMax = { (float)(x + width) / m_PageSize, (float)y / m_PageSize };
+		glyph.Page = (int32_t)pageIndex;
+		return true;
+	}
+
+	void Font::Layout(const std::string& text, TextLayout& layout)
+	{
+		const stbtt_fontinfo* info = (const stbtt_fontinfo*)m_FontInfo;
+
+		glm::vec2 pen = { 0.0f, 0.0f };
+		uint32_t previous = 0;
+		size_t index = 0;
+		while (index < text.size())
+		{
+			uint32_t codepoint = DecodeUTF8(text, index);
+			if (codepoint == '\n')
+			{
+				layout.Size.x = std::max(layout.Size.x, pen.x);
+				pen = { 0.0f, pen.y - m_LineHeight };
+				previous = 0;
+				continue;
+			}
+
+			if (previous)
+				pen.x += stbtt_GetCodepointKernAdvance(info, (int)previous, (int)codepoint) * m_Scale / m_GlyphSize;
+
+			const FontGlyph& glyph = GetGlyph(codepoint);
+			if (glyph.Page >= 0)
+				layout.Quads.push_back({ pen + glyph.PlaneMin, pen + glyph.PlaneMax, glyph.UVMin, glyph.UVMax, (uint32_t)glyph.Page });
+
+			pen.x += glyph.Advance;
+			previous = codepoint;
+		}
+
+		layout.Size.x = std::max(layout.Size.x, pen.x);
+		layout.Size.y = m_LineHeight - pen.y;
+	}
+
+	const TextLayout& Font::GetLayout(const std::string& text)
+	{
+		auto it = m_Layouts.find(text);
+		if (it != m_Layouts.end())
+			return it->second;
+
+		if (m_Layouts.size() >= s_MaxCachedLayouts)
+			m_Layouts.clear();
+
+		TextLayout& layout = m_Layouts[text];
+		if (IsLoaded())
+			Layout(text, layout);
+		return layout;
+	}
+
+	void Font::Preload(const std::string& text)
+	{
+		if (!IsLoaded())
+			return;
+
+		size_t index = 0;
+		while (index < text.size())
+			GetGlyph(DecodeUTF8(text, index));
+	}
+
+	void Font::UploadPages()
+	{
+		for (Page& page : m_Pages)
+		{
+			if (!page.Dirty)
+				continue;
+
+			page.Texture->SetData(page.Pixels.data(), (uint32_t)page.Pixels.size());
+			page.Dirty = false;
+		}
+	}
+
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "GameEngine/Core.h"
+#include "GameEngine/Renderer/Texture.h"
+#include "GameEngine/Renderer/SpriteAtlas.h"
+
+#include <glm/glm.hpp>
+
+namespace GameEngine {
+
+	// Glifo nell'atlas. Le coordinate "plane" sono in em rispetto al punto sulla baseline in cui si trova la penna:
+	// moltiplicate per la dimensione del testo danno la posizione del quad nel mondo.
+	struct FontGlyph
+	{
+		glm::vec2 PlaneMin = { 0.0f, 0.0f };
+		glm::vec2 PlaneMax = { 0.0f, 0.0f };
+		glm::vec2 UVMin = { 0.0f, 0.0f };
+		glm::vec2 UVMax = { 0.0f, 0.0f };
+		float Advance = 0.0f;
+		// -1 per i glifi senza pixel (ad es. lo spazio).
+		int32_t Page = -1;
+	};
+
+	// Testo già impaginato: un quad per glifo visibile, pronto per essere scalato e traslato.
+	struct TextLayout
+	{
+		struct Quad
+		{
+			glm::vec2 PlaneMin, PlaneMax;
+			glm::vec2 UVMin, UVMax;
+			uint32_t Page;
+		};
+
+		std::vector<Quad> Quads;
+		// Ingombro in em: larghezza della riga più lunga, altezza di tutte le righe.
+		glm::vec2 Size = { 0.0f, 0.0f };
+	};
+
+	// Font TrueType renderizzato come signed distance field: ogni glifo viene rasterizzato una sola volta,
+	// alla prima richiesta, e impacchettato nelle pagine dell'atlas. La distanza viene interpolata dallo shader,
+	// quindi lo stesso glifo resta nitido a qualunque dimensione senza essere rasterizzato di nuovo.
+	class Font
+	{
+	public:
+		// glyphSize: altezza in pixel a cui vengono generati i glifi; padding: pixel di distanza codificati attorno al contorno.
+		Font(const std::string& path, uint32_t glyphSize = 32, uint32_t padding = 4, uint32_t pageSize = 1024);
+		~Font();
+
+		inline bool IsLoaded() const { return m_FontInfo != nullptr; }
+
+		// Restituisce il testo impaginato (UTF-8, '\n' va a capo). Il risultato viene tenuto in cache per stringa:
+		// le scritte che non cambiano non vengono mai impaginate di nuovo.
+		const TextLayout& GetLayout(const std::string& text);
+
+		// Genera in anticipo i glifi di text, ad es. per evitare rasterizzazioni durante il gioco.
+		void Preload(const std::string& text);
+
+		// Carica sulla GPU le pagine a cui sono stati aggiunti glifi. Chiamato dal Renderer2D prima di disegnare.
+		void UploadPages();
+
+		inline uint32_t GetPageCount() const { return (uint32_t)m_Pages.size(); }
+		inline const Ref<Texture2D>& GetPageTexture(uint32_t index) const { return m_Pages[index].Texture; }
+
+		// Distanza tra due righe consecutive, in em.
+		inline float GetLineHeight() const { return m_LineHeight; }
+		inline uint32_t GetGlyphCount() const { return (uint32_t)m_Glyphs.size(); }
+		inline uint32_t GetCachedLayoutCount() const { return (uint32_t)m_Layouts.size(); }
+
+	private:
+		const FontGlyph& GetGlyph(uint32_t codepoint);
+		bool AddToAtlas(const uint8_t* distance, uint32_t width, uint32_t height, FontGlyph& glyph);
+		void Layout(const std::string& text, TextLayout& layout);
+
+	private:
+		struct Page
+		{
+			Ref<Texture2D> Texture;
+			SkylinePacker Packer;
+			// Copia sulla CPU della pagina: la texture viene aggiornata per intero.
+			std::vector<uint8_t> Pixels;
+			bool Dirty = false;
+		};
+
+		std::vector<uint8_t> m_FontData;
+		// stbtt_fontinfo, tenuto opaco per non esporre stb_truetype nell'header.
+		void* m_FontInfo = nullptr;
+		float m_Scale = 0.0f;
+		float m_LineHeight = 1.0f;
+
+		uint32_t m_GlyphSize, m_Padding, m_PageSize;
+		std::vector<Page> m_Pages;
+		std::unordered_map<uint32_t, FontGlyph> m_Glyphs;
+		std::unordered_map<std::string, TextLayout> m_Layouts;
+	};
+
+}
@@ -0,0 +1,29 @@
+#include "hzpch.h"
+#include "Framebuffer.h"
+
+#include "Renderer.h"
+#include "RenderCapture.h"
+#include "Platform/OpenGL/OpenGLFramebuffer.h"
+
+namespace GameEngine {
+
+	Framebuffer* Framebuffer::Create(const FramebufferSpecification& spec)
+	{
+		switch (Renderer::GetAPI())
+		{
+			case RendererAPI::API::None:
+			{
+				HZ_CORE_ASSERT(false, "RendererAPI::None is currently not supported");
+				return nullptr;
+			}
+
+			case RendererAPI::API::OpenGL:
+				return RenderCapture::Capture(new OpenGLFramebuffer(spec));
+
+		}
+
+		HZ_CORE_ASSERT(false, "Unknown Renderer API!");
+		return nullptr;
+	}
+
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <vector>
+#include <glm/glm.hpp>
+
+#include "GameEngine/Core.h"
+
+namespace GameEngine {
+
+	enum class FramebufferTextureFormat
+	{
+		None = 0,
+
+		// Colore
+		RGBA8,
+		RGBA16F,
+
+		// Profondità/stencil
+		Depth24Stencil8
+	};
+
+	struct FramebufferSpecification
+	{
+		uint32_t Width = 0, Height = 0;
+		// Un attachment per formato, nell'ordine in cui vengono letti dallo shader (location 0, 1, ...).
+		// Al più un formato di profondità.
+		std::vector<FramebufferTextureFormat> Attachments;
+	};
+
+	// Destinazione di rendering offscreen: i color attachment sono texture leggibili dopo il rendering.
+	class Framebuffer
+	{
+	public:
+		virtual ~Framebuffer() = default;
+
+		virtual void Bind() = 0;
+		virtual void Unbind() = 0;
+
+		// Ricrea gli attachment con le nuove dimensioni: i contenuti precedenti vanno persi.
+		virtual void Resize(uint32_t width, uint32_t height) = 0;
+
+		// Pulisce un singolo color attachment senza toccare il clear color di RenderCommand.
+		virtual void ClearColorAttachment(uint32_t index, const glm::vec4& value) = 0;
+
+		// Copia la regione (0, 0, srcWidth, srcHeight) del primo color attachment nel backbuffer,
+		// scalata a (0, 0, dstWidth, dstHeight) con filtro lineare.
+		virtual void BlitToScreen(uint32_t srcWidth, uint32_t srcHeight, uint32_t dstWidth, uint32_t dstHeight) const = 0;
+
+		virtual uint32_t GetColorAttachmentRendererID(uint32_t index = 0) const = 0;
+		virtual const FramebufferSpecification& GetSpecification() const = 0;
+
+		static Framebuffer* Create(const FramebufferSpecification& spec);
+	};
+
+}
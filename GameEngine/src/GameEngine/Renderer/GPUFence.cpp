@@ -0,0 +1,28 @@
+#include "hzpch.h"
+#include "GPUFence.h"
+
+#include "Renderer.h"
+#include "Platform/OpenGL/OpenGLGPUFence.h"
+
+namespace GameEngine {
+
+	GPUFence* GPUFence::Create()
+	{
+		switch (Renderer::GetAPI())
+		{
+			case RendererAPI::API::None:
+			{
+				HZ_CORE_ASSERT(false, "RendererAPI::None is currently not supported");
+				return nullptr;
+			}
+
+			case RendererAPI::API::OpenGL:
+				return new OpenGLGPUFence();
+
+		}
+
+		HZ_CORE_ASSERT(false, "Unknown Renderer API!");
+		return nullptr;
+	}
+
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "GameEngine/Core.h"
+
+namespace GameEngine {
+
+	// Segnala quando la GPU ha eseguito tutti i comandi inviati prima della creazione del fence.
+	// È visibile da tutti i contesti condivisi: un fence creato sul thread di caricamento si può
+	// interrogare dal thread principale.
+	class GPUFence
+	{
+	public:
+		virtual ~GPUFence() = default;
+
+		// Non blocca: restituisce false se la GPU non ha ancora raggiunto il fence.
+		virtual bool IsSignaled() = 0;
+
+		static GPUFence* Create();
+	};
+
+}
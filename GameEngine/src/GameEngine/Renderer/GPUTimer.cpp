@@ -0,0 +1,28 @@
+#include "hzpch.h"
+#include "GPUTimer.h"
+
+#include "Renderer.h"
+#include "Platform/OpenGL/OpenGLGPUTimer.h"
+
+namespace GameEngine {
+
+	GPUTimer* GPUTimer::Create()
+	{
+		switch (Renderer::GetAPI())
+		{
+			case RendererAPI::API::None:
+			{
+				HZ_CORE_ASSERT(false, "RendererAPI::None is currently not supported");
+				return nullptr;
+			}
+
+			case RendererAPI::API::OpenGL:
+				return new OpenGLGPUTimer();
+
+		}
+
+		HZ_CORE_ASSERT(false, "Unknown Renderer API!");
+		return nullptr;
+	}
+
+}
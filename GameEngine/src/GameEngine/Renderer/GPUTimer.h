@@ -0,0 +1,25 @@
+#pragma once
+
+#include "GameEngine/Core.h"
+
+namespace GameEngine {
+
+	// Misura il tempo GPU dei comandi compresi tra Begin() ed End().
+	// Il risultato arriva con qualche frame di ritardo: leggerlo subito bloccherebbe la CPU in attesa della GPU.
+	class GPUTimer
+	{
+	public:
+		virtual ~GPUTimer() = default;
+
+		virtual void Begin() = 0;
+		virtual void End() = 0;
+
+		// Ultima misura disponibile in millisecondi, 0 finché la GPU non ne ha completata nessuna.
+		virtual float GetMilliseconds() const = 0;
+		// Incrementato ad ogni nuova misura: permette di non contare due volte lo stesso valore.
+		virtual uint32_t GetSampleIndex() const = 0;
+
+		static GPUTimer* Create();
+	};
+
+}
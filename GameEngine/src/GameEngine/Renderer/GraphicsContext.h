@@ -6,9 +6,18 @@ namespace GameEngine {
 	class GraphicsContext 
 	{
 	public:
+		virtual ~GraphicsContext() = default;
+
 		virtual void Init() = 0;
 		virtual void SwapBuffers() = 0;
 
+		// Contesto che condivide con questo buffer, texture e programmi, da usare su un altro thread.
+		// Va creato e distrutto sul thread principale; nullptr se la piattaforma non lo supporta.
+		virtual GraphicsContext* CreateSharedContext() { return nullptr; }
+		// Rende il contesto corrente sul thread chiamante, o lo stacca (un contesto è corrente su un solo thread alla volta).
+		virtual void MakeCurrent() {}
+		virtual void ReleaseCurrent() {}
+
 	};
 
 }
\ No newline at end of file
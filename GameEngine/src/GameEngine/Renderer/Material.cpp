@@ -0,0 +1,144 @@
+#include "hzpch.h"
+#include "Material.h"
+
+#include "Renderer.h"
+
+namespace GameEngine {
+
+	static uint32_t s_NextMaterialID = 1;
+	static uint32_t s_NextMaterialInstanceID = 1;
+
+	// Allineamento std140 dei tipi ammessi in un blocco di parametri: vec3 occupa 12 byte ma si allinea a 16.
+	// Restituisce 0 per i tipi non ammessi: mat3 (in std140 ogni colonna occupa un vec4) e i formati compatti dei vertici.
+	static uint32_t Std140Alignment(ShaderDataType type)
+	{
+		switch (type)
+		{
+			case ShaderDataType::Float:
+			case ShaderDataType::Int:
+			case ShaderDataType::UInt:
+			case ShaderDataType::Bool:		return 4;
+			case ShaderDataType::Float2:
+			case ShaderDataType::Int2:		return 8;
+			case ShaderDataType::Float3:
+			case ShaderDataType::Int3:
+			case ShaderDataType::Float4:
+			case ShaderDataType::Int4:
+			case ShaderDataType::Mat4:		return 16;
+			default:						return 0;
+		}
+	}
+
+	// In std140 i bool occupano 4 byte, come gli int.
+	static uint32_t Std140Size(ShaderDataType type)
+	{
+		return type == ShaderDataType::Bool ? 4 : ShaderDataTypeSize(type);
+	}
+
+	Material::Material(const Ref<Shader>& shader, const std::vector<MaterialParameter>& parameters)
+		: m_Shader(shader), m_Parameters(parameters), m_ID(s_NextMaterialID++)
+	{
+		uint32_t offset = 0;
+		for (auto it = m_Parameters.begin(); it != m_Parameters.end();)
+		{
+			uint32_t alignment = Std140Alignment(it->Type);
+			if (alignment == 0)
+			{
+				HZ_CORE_ERROR("Material parameter '{0}' has a type not supported in a parameter block!", it->Name);
+				it = m_Parameters.erase(it);
+				continue;
+			}
+
+			offset = (offset + alignment - 1) / alignment * alignment;
+			it->Offset = offset;
+			offset += Std140Size(it->Type);
+			++it;
+		}
+
+		// La dimensione di un blocco std140 è un multiplo di 16 byte.
+		m_ParameterBlockSize = (offset + 15) / 16 * 16;
+	}
+
+	const MaterialParameter* Material::FindParameter(const std::string& name) const
+	{
+		// I blocchi hanno pochi parametri: una ricerca lineare è più veloce di una mappa.
+		for (const auto& parameter : m_Parameters)
+		{
+			if (parameter.Name == name)
+				return &parameter;
+		}
+		return nullptr;
+	}
+
+	MaterialInstance::MaterialInstance(const Ref<Material>& material)
+		: m_Material(material), m_ID(s_NextMaterialInstanceID++)
+	{
+		uint32_t size = material->GetParameterBlockSize();
+		if (size == 0)
+			return;
+
+		m_ParameterBlock.resize(size, 0);
+		m_UniformBuffer.reset(UniformBuffer::Create(size, Renderer::MaterialDataBinding));
+	}
+
+	void MaterialInstance::SetParameter(const std::string& name, ShaderDataType type, const void* data, uint32_t size)
+	{
+		const MaterialParameter* parameter = m_Material->FindParameter(name);
+		HZ_CORE_ASSERT(parameter, "Unknown material parameter!");
+		HZ_CORE_ASSERT(!parameter || parameter->Type == type || (parameter->Type == ShaderDataType::Bool && type == ShaderDataType::Int), "Material parameter type mismatch!");
+		if (!parameter)
+			return;
+
+		// Scrivere lo stesso valore ogni frame non causa upload.
+		uint8_t* destination = &m_ParameterBlock[parameter->Offset];
+		if (memcmp(destination, data, size) == 0)
+			return;
+
+		memcpy(destination, data, size);
+		m_Dirty = true;
+	}
+
+	void MaterialInstance::SetInt(const std::string& name, int value)
+	{
+		SetParameter(name, ShaderDataType::Int, &value, sizeof(int));
+	}
+
+	void MaterialInstance::SetFloat(const std::string& name, float value)
+	{
+		SetParameter(name, ShaderDataType::Float, &value, sizeof(float));
+	}
+
+	void MaterialInstance::SetFloat2(const std::string& name, const glm::vec2& value)
+	{
+		SetParameter(name, ShaderDataType::Float2, &value, sizeof(glm::vec2));
+	}
+
+	void MaterialInstance::SetFloat3(const std::string& name, const glm::vec3& value)
+	{
+		SetParameter(name, ShaderDataType::Float3, &value, sizeof(glm::vec3));
+	}
+
+	void MaterialInstance::SetFloat4(const std::string& name, const glm::vec4& value)
+	{
+		SetParameter(name, ShaderDataType::Float4, &value, sizeof(glm::vec4));
+	}
+
+	void MaterialInstance::SetMat4(const std::string& name, const glm::mat4& value)
+	{
+		SetParameter(name, ShaderDataType::Mat4, &value, sizeof(glm::mat4));
+	}
+
+	void MaterialInstance::Bind()
+	{
+		if (!m_UniformBuffer)
+			return;
+
+		if (m_Dirty)
+		{
+			m_UniformBuffer->SetData(m_ParameterBlock.data(), (uint32_t)m_ParameterBlock.size());
+			m_Dirty = false;
+		}
+		m_UniformBuffer->Bind(Renderer::MaterialDataBinding);
+	}
+
+}
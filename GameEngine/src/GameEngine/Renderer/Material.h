@@ -0,0 +1,80 @@
+#pragma once
+
+#include "GameEngine/Core.h"
+#include "GameEngine/Renderer/Buffer.h"
+#include "GameEngine/Renderer/Shader.h"
+#include "GameEngine/Renderer/UniformBuffer.h"
+
+#include <glm/glm.hpp>
+
+namespace GameEngine {
+
+	struct MaterialParameter
+	{
+		std::string Name;
+		ShaderDataType Type;
+		// Offset nel blocco secondo le regole std140, calcolato dal Material.
+		uint32_t Offset = 0;
+
+		MaterialParameter(ShaderDataType type, const std::string& name)
+			: Name(name), Type(type)
+		{
+		}
+	};
+
+	// Shader più la descrizione del suo blocco di parametri. I parametri vanno elencati nello stesso ordine
+	// del blocco GLSL, che lo shader dichiara così:
+	// layout(std140, binding = 1) uniform MaterialData { vec4 u_Color; ... };
+	// Un Material è condiviso da tutte le sue istanze: i valori dei parametri stanno nelle MaterialInstance.
+	class Material
+	{
+	public:
+		Material(const Ref<Shader>& shader, const std::vector<MaterialParameter>& parameters = {});
+
+		inline const Ref<Shader>& GetShader() const { return m_Shader; }
+		inline const std::vector<MaterialParameter>& GetParameters() const { return m_Parameters; }
+		inline uint32_t GetParameterBlockSize() const { return m_ParameterBlockSize; }
+		// Identificativo progressivo, usato dal Renderer per raggruppare le draw call.
+		inline uint32_t GetID() const { return m_ID; }
+
+		const MaterialParameter* FindParameter(const std::string& name) const;
+
+	private:
+		Ref<Shader> m_Shader;
+		std::vector<MaterialParameter> m_Parameters;
+		uint32_t m_ParameterBlockSize = 0;
+		uint32_t m_ID;
+	};
+
+	// Valori dei parametri di un Material, in una copia sulla CPU del blocco std140 e in un uniform buffer.
+	// Il buffer viene aggiornato solo quando un parametro cambia davvero, al primo Bind successivo.
+	class MaterialInstance
+	{
+	public:
+		MaterialInstance(const Ref<Material>& material);
+
+		void SetInt(const std::string& name, int value);
+		void SetFloat(const std::string& name, float value);
+		void SetFloat2(const std::string& name, const glm::vec2& value);
+		void SetFloat3(const std::string& name, const glm::vec3& value);
+		void SetFloat4(const std::string& name, const glm::vec4& value);
+		void SetMat4(const std::string& name, const glm::mat4& value);
+
+		// Carica il blocco se è cambiato e lo collega a Renderer::MaterialDataBinding. Non fa il bind dello shader.
+		void Bind();
+
+		inline const Ref<Material>& GetMaterial() const { return m_Material; }
+		inline uint32_t GetID() const { return m_ID; }
+
+	private:
+		void SetParameter(const std::string& name, ShaderDataType type, const void* data, uint32_t size);
+
+	private:
+		Ref<Material> m_Material;
+		std::vector<uint8_t> m_ParameterBlock;
+		Ref<UniformBuffer> m_UniformBuffer;
+		bool m_Dirty = true;
+		uint32_t m_ID;
+	};
+
+}
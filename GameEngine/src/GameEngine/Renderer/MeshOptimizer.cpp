@@ -0,0 +1,377 @@
+#include "hzpch.h"
+#include "MeshOptimizer.h"
+
+#include <glm/glm.hpp>
+
+#include <string_view>
+
+namespace GameEngine {
+
+	MeshOptimizer::Statistics MeshOptimizer::AnalyzeVertexCache(const uint32_t* indices, uint32_t indexCount, uint32_t vertexCount, uint32_t cacheSize)
+	{
+		Statistics stats;
+		stats.IndexCount = indexCount;
+		if (indexCount == 0)
+			return stats;
+
+		// timestamp[v] = istante in cui v è entrato nella cache FIFO.
+		std::vector<uint32_t> timestamp(vertexCount, 0);
+		std::vector<bool> used(vertexCount, false);
+		uint32_t time = cacheSize + 1;
+		uint32_t misses = 0;
+
+		for (uint32_t i = 0; i < indexCount; i++)
+		{
+			uint32_t v = indices[i];
+			if (time - timestamp[v] > cacheSize)
+			{
+				timestamp[v] = time++;
+				misses++;
+			}
+
+			if (!used[v])
+			{
+				used[v] = true;
+				stats.VertexCount++;
+			}
+		}
+
+		stats.ACMR = indexCount >= 3 ? (float)misses / (float)(indexCount / 3) : 0.0f;
+		stats.ATVR = stats.VertexCount ? (float)misses / (float)stats.VertexCount : 0.0f;
+		return stats;
+	}
+
+	#pragma region Welding
+	uint32_t MeshOptimizer::GenerateVertexRemap(uint32_t* remap, const void* vertices, uint32_t vertexCount, uint32_t stride)
+	{
+		const char* data = (const char*)vertices;
+
+		// La chiave è il contenuto del vertice: due vertici uguali byte per byte vengono fusi.
+		std::unordered_map<std::string_view, uint32_t> unique;
+		unique.reserve(vertexCount);
+
+		uint32_t nextVertex = 0;
+		for (uint32_t i = 0; i < vertexCount; i++)
+		{
+			std::string_view key(data + (size_t)i * stride, stride);
+			auto [it, inserted] = unique.emplace(key, nextVertex);
+			remap[i] = it->second;
+			if (inserted)
+				nextVertex++;
+		}
+
+		return nextVertex;
+	}
+
+	void MeshOptimizer::RemapVertices(void* dst, const void* vertices, uint32_t vertexCount, uint32_t stride, const uint32_t* remap)
+	{
+		for (uint32_t i = 0; i < vertexCount; i++)
+			memcpy((char*)dst + (size_t)remap[i] * stride, (const char*)vertices + (size_t)i * stride, stride);
+	}
+
+	void MeshOptimizer::RemapIndices(uint32_t* dst, const uint32_t* indices, uint32_t indexCount, const uint32_t* remap)
+	{
+		for (uint32_t i = 0; i < indexCount; i++)
+			dst[i] = remap[indices[i]];
+	}
+	#pragma endregion
+
+	#pragma region Vertex Cache
+	// Parametri originali di "Linear-Speed Vertex Cache Optimisation" (Tom Forsyth, 2006).
+	static const uint32_t s_CacheSize = 32;
+	static const float s_CacheDecayPower = 1.5f;
+	static const float s_LastTriScore = 0.75f;
+	static const float s_ValenceBoostScale = 2.0f;
+	static const float s_ValenceBoostPower = 0.5f;
+
+	static float VertexScore(int32_t cachePosition, uint32_t remainingTriangles)
+	{
+		// Un vertice senza triangoli da emettere non deve più attirare nessuno.
+		if (remainingTriangles == 0)
+			return -1.0f;
+
+		float score = 0.0f;
+		if (cachePosition >= 0)
+		{
+			// I vertici dell'ultimo triangolo hanno un punteggio fisso, così non si favorisce
+			// un triangolo solo perché condivide un lato con quello appena emesso.
+			if (cachePosition < 3)
+				score = s_LastTriScore;
+			else
+			{
+				const float scaler = 1.0f / (s_CacheSize - 3);
+				score = powf(1.0f - (cachePosition - 3) * scaler, s_CacheDecayPower);
+			}
+		}
+
+		// Favoriamo i vertici con pochi triangoli rimasti, per non lasciare triangoli isolati.
+		score += s_ValenceBoostScale * powf((float)remainingTriangles, -s_ValenceBoostPower);
+		return score;
+	}
+
+	void MeshOptimizer::OptimizeVertexCache(uint32_t* dst, const uint32_t* indices, uint32_t indexCount, uint32_t vertexCount)
+	{
+		const uint32_t triangleCount = indexCount / 3;
+		if (triangleCount == 0)
+			return;
+
+		// Lista di adiacenza vertice -> triangoli, compatta in un unico array.
+		std::vector<uint32_t> remaining(vertexCount, 0);
+		for (uint32_t i = 0; i < indexCount; i++)
+			remaining[indices[i]]++;
+
+		std::vector<uint32_t> adjacencyOffset(vertexCount + 1, 0);
+		for (uint32_t v = 0; v < vertexCount; v++)
+			adjacencyOffset[v + 1] = adjacencyOffset[v] + remaining[v];
+
+		std::vector<uint32_t> adjacency(indexCount);
+		{
+			std::vector<uint32_t> fill(adjacencyOffset.begin(), adjacencyOffset.end() - 1);
+			for (uint32_t t = 0; t < triangleCount; t++)
+				for (uint32_t k = 0; k < 3; k++)
+					adjacency[fill[indices[t * 3 + k]]++] = t;
+		}
+
+		std::vector<int32_t> cachePosition(vertexCount, -1);
+		std::vector<float> vertexScore(vertexCount);
+		for (uint32_t v = 0; v < vertexCount; v++)
+			vertexScore[v] = VertexScore(-1, remaining[v]);
+
+		std::vector<float> triangleScore(triangleCount);
+		std::vector<bool> emitted(triangleCount, false);
+		for (uint32_t t = 0; t < triangleCount; t++)
+			triangleScore[t] = vertexScore[indices[t * 3 + 0]] + vertexScore[indices[t * 3 + 1]] + vertexScore[indices[t * 3 + 2]];
+
+		uint32_t bestTriangle = (uint32_t)(std::max_element(triangleScore.begin(), triangleScore.end()) - triangleScore.begin());
+		uint32_t inputCursor = 0;
+
+		std::vector<uint32_t> cache, newCache;
+		cache.reserve(s_CacheSize + 3);
+		newCache.reserve(s_CacheSize + 3);
+
+		for (uint32_t out = 0; out < triangleCount; out++)
+		{
+			// Nessun candidato nella cache: ripartiamo dal primo triangolo non ancora emesso.
+			if (bestTriangle == UINT32_MAX)
+			{
+				while (emitted[inputCursor])
+					inputCursor++;
+				bestTriangle = inputCursor;
+			}
+
+			const uint32_t* tri = &indices[bestTriangle * 3];
+			dst[out * 3 + 0] = tri[0];
+			dst[out * 3 + 1] = tri[1];
+			dst[out * 3 + 2] = tri[2];
+			emitted[bestTriangle] = true;
+
+			// Rimuoviamo il triangolo dalle liste di adiacenza dei suoi vertici.
+			for (uint32_t k = 0; k < 3; k++)
+			{
+				uint32_t v = tri[k];
+				uint32_t* begin = &adjacency[adjacencyOffset[v]];
+				uint32_t* end = begin + remaining[v];
+				uint32_t* it = std::find(begin, end, bestTriangle);
+				std::swap(*it, *(end - 1));
+				remaining[v]--;
+			}
+
+			// Il triangolo emesso va in testa alla cache, gli altri vertici scalano.
+			newCache.clear();
+			newCache.push_back(tri[0]);
+			newCache.push_back(tri[1]);
+			newCache.push_back(tri[2]);
+			for (uint32_t v : cache)
+			{
+				if (v != tri[0] && v != tri[1] && v != tri[2])
+					newCache.push_back(v);
+			}
+
+			for (size_t i = s_CacheSize; i < newCache.size(); i++)
+				cachePosition[newCache[i]] = -1;
+			if (newCache.size() > s_CacheSize)
+			{
+				// I vertici usciti dalla cache vanno comunque aggiornati.
+				for (size_t i = s_CacheSize; i < newCache.size(); i++)
+					vertexScore[newCache[i]] = VertexScore(-1, remaining[newCache[i]]);
+			}
+
+			for (size_t i = 0; i < newCache.size() && i < s_CacheSize; i++)
+			{
+				uint32_t v = newCache[i];
+				cachePosition[v] = (int32_t)i;
+				vertexScore[v] = VertexScore((int32_t)i, remaining[v]);
+			}
+
+			// Aggiorniamo i punteggi dei triangoli toccati e scegliamo il migliore tra questi.
+			bestTriangle = UINT32_MAX;
+			float bestScore = -1.0f;
+			for (uint32_t v : newCache)
+			{
+				const uint32_t* adjacent = &adjacency[adjacencyOffset[v]];
+				for (uint32_t a = 0; a < remaining[v]; a++)
+				{
+					uint32_t t = adjacent[a];
+					const uint32_t* ti = &indices[t * 3];
+					float score = vertexScore[ti[0]] + vertexScore[ti[1]] + vertexScore[ti[2]];
+					triangleScore[t] = score;
+					if (score > bestScore)
+					{
+						bestScore = score;
+						bestTriangle = t;
+					}
+				}
+			}
+
+			if (newCache.size() > s_CacheSize)
+				newCache.resize(s_CacheSize);
+			std::swap(cache, newCache);
+		}
+	}
+	#pragma endregion
+
+	#pragma region Overdraw
+	void MeshOptimizer::OptimizeOverdraw(uint32_t* dst, const uint32_t* indices, uint32_t indexCount, const float* positions, uint32_t vertexCount, uint32_t positionStride)
+	{
+		const uint32_t triangleCount = indexCount / 3;
+		if (triangleCount == 0)
+			return;
+
+		auto position = [&](uint32_t v) -> glm::vec3
+		{
+			const float* p = (const float*)((const char*)positions + (size_t)v * positionStride);
+			return { p[0], p[1], p[2] };
+		};
+
+		// Un nuovo cluster inizia dove la cache simulata non contiene nessuno dei tre vertici:
+		// spostare interi cluster non peggiora (quasi) l'ACMR ottenuto da OptimizeVertexCache.
+		const uint32_t cacheSize = 16;
+		std::vector<uint32_t> timestamp(vertexCount, 0);
+		uint32_t time = cacheSize + 1;
+		std::vector<uint32_t> clusterStart;
+		for (uint32_t t = 0; t < triangleCount; t++)
+		{
+			uint32_t misses = 0;
+			for (uint32_t k = 0; k < 3; k++)
+			{
+				uint32_t v = indices[t * 3 + k];
+				if (time - timestamp[v] > cacheSize)
+				{
+					timestamp[v] = time++;
+					misses++;
+				}
+			}
+
+			if (t == 0 || misses == 3)
+				clusterStart.push_back(t);
+		}
+		clusterStart.push_back(triangleCount);
+
+		glm::vec3 meshCentroid(0.0f);
+		for (uint32_t i = 0; i < indexCount; i++)
+			meshCentroid += position(indices[i]);
+		meshCentroid /= (float)indexCount;
+
+		// Potenziale di occlusione: quanto il cluster guarda verso l'esterno della mesh.
+		// I cluster esterni coprono quelli interni, quindi vanno disegnati per primi.
+		struct Cluster
+		{
+			uint32_t Start, End;
+			float Sort;
+		};
+		std::vector<Cluster> clusters;
+		clusters.reserve(clusterStart.size() - 1);
+		for (size_t c = 0; c + 1 < clusterStart.size(); c++)
+		{
+			glm::vec3 centroid(0.0f), normal(0.0f);
+			for (uint32_t t = clusterStart[c]; t < clusterStart[c + 1]; t++)
+			{
+				glm::vec3 p0 = position(indices[t * 3 + 0]);
+				glm::vec3 p1 = position(indices[t * 3 + 1]);
+				glm::vec3 p2 = position(indices[t * 3 + 2]);
+				centroid += p0 + p1 + p2;
+				// Il prodotto vettoriale non normalizzato pesa ogni triangolo per la sua area.
+				normal += glm::cross(p1 - p0, p2 - p0);
+			}
+
+			uint32_t count = clusterStart[c + 1] - clusterStart[c];
+			centroid /= (float)(count * 3);
+			float length = glm::length(normal);
+			if (length > 0.0f)
+				normal /= length;
+
+			clusters.push_back({ clusterStart[c], clusterStart[c + 1], glm::dot(centroid - meshCentroid, normal) });
+		}
+
+		std::stable_sort(clusters.begin(), clusters.end(), [](const Cluster& a, const Cluster& b) { return a.Sort > b.Sort; });
+
+		// dst e indices possono coincidere.
+		std::vector<uint32_t> source(indices, indices + indexCount);
+		uint32_t out = 0;
+		for (const Cluster& cluster : clusters)
+		{
+			for (uint32_t i = cluster.Start * 3; i < cluster.End * 3; i++)
+				dst[out++] = source[i];
+		}
+	}
+	#pragma endregion
+
+	#pragma region Vertex Fetch
+	uint32_t MeshOptimizer::OptimizeVertexFetch(void* dst, uint32_t* indices, uint32_t indexCount, const void* vertices, uint32_t vertexCount, uint32_t stride)
+	{
+		std::vector<uint32_t> remap(vertexCount, UINT32_MAX);
+		uint32_t nextVertex = 0;
+
+		for (uint32_t i = 0; i < indexCount; i++)
+		{
+			uint32_t& newIndex = remap[indices[i]];
+			if (newIndex == UINT32_MAX)
+			{
+				newIndex = nextVertex++;
+				memcpy((char*)dst + (size_t)newIndex * stride, (const char*)vertices + (size_t)indices[i] * stride, stride);
+			}
+			indices[i] = newIndex;
+		}
+
+		return nextVertex;
+	}
+	#pragma endregion
+
+	MeshOptimizer::Report MeshOptimizer::Optimize(std::vector<uint8_t>& vertices, uint32_t stride, std::vector<uint32_t>& indices, uint32_t positionOffset)
+	{
+		Report report;
+		uint32_t vertexCount = (uint32_t)(vertices.size() / stride);
+		uint32_t indexCount = (uint32_t)indices.size();
+		// I passi di riordino lavorano per triangoli: indici avanzati resterebbero azzerati.
+		HZ_CORE_ASSERT(indexCount >= 3 && indexCount % 3 == 0, "Optimize expects a triangle list!");
+		report.Before = AnalyzeVertexCache(indices.data(), indexCount, vertexCount);
+
+		// 1. Welding dei vertici duplicati.
+		std::vector<uint32_t> remap(vertexCount);
+		uint32_t uniqueCount = GenerateVertexRemap(remap.data(), vertices.data(), vertexCount, stride);
+		std::vector<uint8_t> welded((size_t)uniqueCount * stride);
+		RemapVertices(welded.data(), vertices.data(), vertexCount, stride, remap.data());
+		RemapIndices(indices.data(), indices.data(), indexCount, remap.data());
+		vertexCount = uniqueCount;
+
+		// 2. Ordine dei triangoli per la post-transform cache.
+		std::vector<uint32_t> optimized(indexCount);
+		OptimizeVertexCache(optimized.data(), indices.data(), indexCount, vertexCount);
+
+		// 3. Ordine dei cluster per ridurre l'overdraw.
+		OptimizeOverdraw(indices.data(), optimized.data(), indexCount, (const float*)(welded.data() + positionOffset), vertexCount, stride);
+
+		// 4. Ordine dei vertici per la cache dei fetch.
+		vertices.resize(welded.size());
+		vertexCount = OptimizeVertexFetch(vertices.data(), indices.data(), indexCount, welded.data(), vertexCount, stride);
+		vertices.resize((size_t)vertexCount * stride);
+
+		report.After = AnalyzeVertexCache(indices.data(), indexCount, vertexCount);
+
+		HZ_CORE_INFO("Mesh optimized: {0} -> {1} vertices, ACMR {2:.3f} -> {3:.3f}, ATVR {4:.3f} -> {5:.3f}",
+			report.Before.VertexCount, report.After.VertexCount, report.Before.ACMR, report.After.ACMR, report.Before.ATVR, report.After.ATVR);
+
+		return report;
+	}
+
+}
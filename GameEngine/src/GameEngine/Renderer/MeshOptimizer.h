@@ -0,0 +1,55 @@
+#pragma once
+
+#include "GameEngine/Core.h"
+
+namespace GameEngine {
+
+	// Fasi di ottimizzazione di una mesh indicizzata, da eseguire offline o al caricamento.
+	// Tutte le funzioni lavorano su liste di triangoli (3 indici per triangolo).
+	class MeshOptimizer
+	{
+	public:
+		struct Statistics
+		{
+			// Average Cache Miss Ratio: vertici trasformati per triangolo (0.5 ideale, 3.0 pessimo).
+			float ACMR = 0.0f;
+			// Average Transform to Vertex Ratio: vertici trasformati per vertice usato (1.0 ideale).
+			float ATVR = 0.0f;
+			uint32_t VertexCount = 0;
+			uint32_t IndexCount = 0;
+		};
+
+		struct Report
+		{
+			Statistics Before;
+			Statistics After;
+		};
+
+		// Simula una post-transform cache FIFO di cacheSize vertici.
+		static Statistics AnalyzeVertexCache(const uint32_t* indices, uint32_t indexCount, uint32_t vertexCount, uint32_t cacheSize = 16);
+
+		// Welding: trova i vertici con contenuto identico (byte per byte).
+		// remap[i] riceve il nuovo indice del vertice i; restituisce il numero di vertici unici.
+		static uint32_t GenerateVertexRemap(uint32_t* remap, const void* vertices, uint32_t vertexCount, uint32_t stride);
+		static void RemapVertices(void* dst, const void* vertices, uint32_t vertexCount, uint32_t stride, const uint32_t* remap);
+		static void RemapIndices(uint32_t* dst, const uint32_t* indices, uint32_t indexCount, const uint32_t* remap);
+
+		// Riordina i triangoli per riusare il più possibile la post-transform cache (algoritmo di Tom Forsyth).
+		static void OptimizeVertexCache(uint32_t* dst, const uint32_t* indices, uint32_t indexCount, uint32_t vertexCount);
+
+		// Riordina i cluster di triangoli prodotti da OptimizeVertexCache in modo che quelli rivolti
+		// verso l'esterno vengano disegnati prima (riduce l'overdraw senza peggiorare molto l'ACMR).
+		// positions: float3 all'inizio di ogni vertice, positionStride in byte.
+		static void OptimizeOverdraw(uint32_t* dst, const uint32_t* indices, uint32_t indexCount, const float* positions, uint32_t vertexCount, uint32_t positionStride);
+
+		// Riordina i vertici nell'ordine in cui vengono usati dagli indici (migliora la località dei fetch)
+		// e scarta quelli non referenziati. Gli indici vengono aggiornati sul posto.
+		// Restituisce il numero di vertici scritti in dst.
+		static uint32_t OptimizeVertexFetch(void* dst, uint32_t* indices, uint32_t indexCount, const void* vertices, uint32_t vertexCount, uint32_t stride);
+
+		// Pipeline completa: welding, vertex cache, overdraw e vertex fetch.
+		// positionOffset: offset in byte della posizione (float3) all'interno del vertice.
+		static Report Optimize(std::vector<uint8_t>& vertices, uint32_t stride, std::vector<uint32_t>& indices, uint32_t positionOffset = 0);
+	};
+
+}
@@ -0,0 +1,133 @@
+#include "hzpch.h"
+#include "MultiDrawBatch.h"
+
+#include "RenderCommand.h"
+
+namespace GameEngine {
+
+	// I comandi non vengono letti dagli shader: un binding a parte evita di sovrascrivere quelli dei dati.
+	static const uint32_t s_CommandBinding = 2;
+
+	MultiDrawBatch::MultiDrawBatch(const Ref<Shader>& shader, const BufferLayout& layout, uint32_t drawCapacity)
+		: m_Shader(shader), m_Layout(layout), m_DrawCapacity(std::max(drawCapacity, 1u))
+	{
+	}
+
+	uint32_t MultiDrawBatch::AddMesh(const void* vertices, uint32_t vertexCount, const uint32_t* indices, uint32_t indexCount)
+	{
+		const uint8_t* bytes = (const uint8_t*)vertices;
+		m_Vertices.insert(m_Vertices.end(), bytes, bytes + (size_t)vertexCount * m_Layout.GetStride());
+		m_Meshes.push_back({ m_VertexCount, (uint32_t)m_Indices.size(), indexCount });
+		m_Indices.insert(m_Indices.end(), indices, indices + indexCount);
+		m_VertexCount += vertexCount;
+
+		m_BuffersDirty = true;
+		return (uint32_t)m_Meshes.size() - 1;
+	}
+
+	void MultiDrawBatch::SetMaterialTable(const void* data, uint32_t size)
+	{
+		if (!m_MaterialTable || m_MaterialTable->GetSize() < size)
+			m_MaterialTable.reset(StorageBuffer::Create(size, MaterialTableBinding));
+		m_MaterialTable->SetData(data, size);
+	}
+
+	void MultiDrawBatch::CreateBuffers()
+	{
+		m_VertexArray.reset(VertexArray::Create());
+
+		Ref<VertexBuffer> vertexBuffer(VertexBuffer::Create(m_Vertices.data(), (uint32_t)m_Vertices.size()));
+		vertexBuffer->SetLayout(m_Layout);
+		m_VertexArray->AddVertexBuffer(vertexBuffer);
+
+		// a_DrawIndex vale 0, 1, 2, ...: con divisor 1 e baseInstance ogni istanza legge il proprio DrawRecord.
+		std::vector<uint32_t> drawIndices(m_DrawCapacity);
+		for (uint32_t i = 0; i < m_DrawCapacity; i++)
+			drawIndices[i] = i;
+
+		Ref<VertexBuffer> drawIndexBuffer(VertexBuffer::Create(drawIndices.data(), m_DrawCapacity * sizeof(uint32_t)));
+		drawIndexBuffer->SetLayout({
+			{ ShaderDataType::UInt, "a_DrawIndex" }
+		});
+		m_VertexArray->AddVertexBuffer(drawIndexBuffer, 1);
+
+		Ref<IndexBuffer> indexBuffer(IndexBuffer::Create(m_Indices.data(), (uint32_t)m_Indices.size()));
+		m_VertexArray->SetIndexBuffer(indexBuffer);
+
+		// Nel caso peggiore c'è un comando per mesh.
+		m_Commands.reset(StorageBuffer::Create((uint32_t)m_Meshes.size() * sizeof(DrawElementsIndirectCommand), s_CommandBinding));
+		m_DrawData.reset(StorageBuffer::Create(m_DrawCapacity * sizeof(DrawRecord), DrawDataBinding));
+
+		m_BuffersDirty = false;
+	}
+
+	void MultiDrawBatch::Begin()
+	{
+		m_PendingDraws.clear();
+	}
+
+	void MultiDrawBatch::Submit(uint32_t mesh, const glm::mat4& transform, uint32_t materialIndex)
+	{
+		HZ_CORE_ASSERT(mesh < m_Meshes.size(), "Unknown mesh!");
+		m_PendingDraws.push_back({ mesh, materialIndex, transform });
+	}
+
+	void MultiDrawBatch::End()
+	{
+		m_Stats = Statistics();
+		if (m_PendingDraws.empty())
+			return;
+
+		uint32_t drawCount = (uint32_t)m_PendingDraws.size();
+		if (drawCount > m_DrawCapacity)
+		{
+			m_DrawCapacity = std::max(m_DrawCapacity * 2, drawCount);
+			m_BuffersDirty = true;
+		}
+		if (m_BuffersDirty)
+			CreateBuffers();
+
+		// Counting sort per mesh: i DrawRecord di ogni mesh diventano contigui, nell'ordine di invio.
+		std::vector<uint32_t>& firstDraw = m_FirstDraw;
+		firstDraw.assign(m_Meshes.size() + 1, 0);
+		for (const PendingDraw& draw : m_PendingDraws)
+			firstDraw[draw.Mesh + 1]++;
+		for (size_t i = 1; i < firstDraw.size(); i++)
+			firstDraw[i] += firstDraw[i - 1];
+
+		m_CommandData.clear();
+		for (uint32_t mesh = 0; mesh < m_Meshes.size(); mesh++)
+		{
+			uint32_t instanceCount = firstDraw[mesh + 1] - firstDraw[mesh];
+			if (instanceCount == 0)
+				continue;
+
+			const Mesh& data = m_Meshes[mesh];
+			m_CommandData.push_back({ data.IndexCount, instanceCount, data.FirstIndex, (int32_t)data.BaseVertex, firstDraw[mesh] });
+		}
+
+		m_DrawRecords.resize(drawCount);
+		for (const PendingDraw& draw : m_PendingDraws)
+		{
+			DrawRecord& record = m_DrawRecords[firstDraw[draw.Mesh]++];
+			record.Transform = draw.Transform;
+			record.MaterialIndex = draw.MaterialIndex;
+		}
+
+		m_DrawData->SetData(m_DrawRecords.data(), drawCount * sizeof(DrawRecord));
+		m_Commands->SetData(m_CommandData.data(), (uint32_t)m_CommandData.size() * sizeof(DrawElementsIndirectCommand));
+
+		m_Shader->Bind();
+		m_DrawData->Bind(DrawDataBinding);
+		if (m_MaterialTable)
+			m_MaterialTable->Bind(MaterialTableBinding);
+
+		m_VertexArray->Bind();
+		RenderCommand::DrawIndexedIndirect(m_VertexArray, m_Commands, (uint32_t)m_CommandData.size());
+
+		m_Stats.Draws = drawCount;
+		m_Stats.Commands = (uint32_t)m_CommandData.size();
+		m_PendingDraws.clear();
+	}
+
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "GameEngine/Core.h"
+#include "GameEngine/Renderer/Shader.h"
+#include "GameEngine/Renderer/VertexArray.h"
+#include "GameEngine/Renderer/StorageBuffer.h"
+
+#include <glm/glm.hpp>
+
+namespace GameEngine {
+
+	// Disegna molte mesh diverse con una sola chiamata glMultiDrawElementsIndirect.
+	// - Le mesh vengono copiate una volta in un vertex buffer e un index buffer condivisi.
+	// - Ogni Submit aggiunge transform e indice del materiale all'array DrawData (storage buffer).
+	// - End ordina le draw per mesh: le draw consecutive della stessa mesh diventano un solo comando instanced,
+	//   e baseInstance fa sì che l'attributo per-istanza a_DrawIndex sia la posizione della draw in DrawData.
+	//
+	// Lo shader riceve a_DrawIndex come ultimo attributo, dopo quelli del layout delle mesh, e dichiara:
+	// struct DrawRecord { mat4 Transform; uint MaterialIndex; };
+	// layout(std430, binding = 0) readonly buffer DrawData { DrawRecord u_Draws[]; };
+	// layout(std430, binding = 1) readonly buffer MaterialTable { ... };  (opzionale, vedi SetMaterialTable)
+	class MultiDrawBatch
+	{
+	public:
+		static const uint32_t DrawDataBinding = 0;
+		static const uint32_t MaterialTableBinding = 1;
+
+		MultiDrawBatch(const Ref<Shader>& shader, const BufferLayout& layout, uint32_t drawCapacity = 4096);
+
+		// Gli indici sono relativi ai vertici della mesh. Restituisce l'id da passare a Submit.
+		uint32_t AddMesh(const void* vertices, uint32_t vertexCount, const uint32_t* indices, uint32_t indexCount);
+
+		// Dati dei materiali, indicizzati da DrawRecord.MaterialIndex: il formato è deciso dallo shader.
+		void SetMaterialTable(const void* data, uint32_t size);
+
+		void Begin();
+		void Submit(uint32_t mesh, const glm::mat4& transform, uint32_t materialIndex = 0);
+		// Carica comandi e DrawData e disegna tutto. Come Renderer::Submit, usa la camera dell'ultimo BeginScene.
+		void End();
+
+		struct Statistics
+		{
+			uint32_t Draws = 0;
+			uint32_t Commands = 0;
+		};
+		inline const Statistics& GetStats() const { return m_Stats; }
+		inline uint32_t GetMeshCount() const { return (uint32_t)m_Meshes.size(); }
+
+	private:
+		struct Mesh
+		{
+			uint32_t BaseVertex;
+			uint32_t FirstIndex;
+			uint32_t IndexCount;
+		};
+
+		// Stesso layout del DrawRecord std430: mat4 a 16 byte, struct arrotondata a 16.
+		struct DrawRecord
+		{
+			glm::mat4 Transform;
+			uint32_t MaterialIndex;
+			uint32_t Padding[3];
+		};
+
+		struct DrawElementsIndirectCommand
+		{
+			uint32_t Count;
+			uint32_t InstanceCount;
+			uint32_t FirstIndex;
+			int32_t BaseVertex;
+			uint32_t BaseInstance;
+		};
+
+		struct PendingDraw
+		{
+			uint32_t Mesh;
+			uint32_t MaterialIndex;
+			glm::mat4 Transform;
+		};
+
+		// Ricrea i buffer GPU dopo l'aggiunta di mesh o quando le draw superano la capacità.
+		void CreateBuffers();
+
+	private:
+		Ref<Shader> m_Shader;
+		BufferLayout m_Layout;
+		uint32_t m_DrawCapacity;
+
+		std::vector<uint8_t> m_Vertices;
+		std::vector<uint32_t> m_Indices;
+		uint32_t m_VertexCount = 0;
+		std::vector<Mesh> m_Meshes;
+		bool m_BuffersDirty = true;
+
+		Ref<VertexArray> m_VertexArray;
+		Ref<StorageBuffer> m_DrawData;
+		Ref<StorageBuffer> m_Commands;
+		Ref<StorageBuffer> m_MaterialTable;
+
+		std::vector<PendingDraw> m_PendingDraws;
+		std::vector<DrawRecord> m_DrawRecords;
+		std::vector<DrawElementsIndirectCommand> m_CommandData;
+		// Per ogni mesh, posizione in DrawData della sua prima draw.
+		std::vector<uint32_t> m_FirstDraw;
+
+		Statistics m_Stats;
+	};
+
+}
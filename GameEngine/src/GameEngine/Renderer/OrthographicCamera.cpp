@@ -6,18 +6,29 @@
 namespace GameEngine {
 
 	OrthographicCamera::OrthographicCamera(float left, float right, float bottom, float top)
-		: m_ProjectionMatrix(glm::ortho(left, right, bottom, top, -1.0f, 1.0f)), m_ViewMatrix(1.0f)
+		: m_Left(left), m_Right(right), m_Bottom(bottom), m_Top(top)
 	{
-		m_ProjectionViewMatrix = m_ProjectionMatrix * m_ViewMatrix;
 	}
 
-	void OrthographicCamera::RecalculateViewMatrix()
+	void OrthographicCamera::SetProjection(float left, float right, float bottom, float top)
 	{
-		glm::mat4 transform = glm::translate(glm::mat4(1.0), m_Position) * 
-			glm::rotate(glm::mat4(1.0), glm::radians(m_Rotation), glm::vec3(0, 0, 1));
+		m_Left = left;
+		m_Right = right;
+		m_Bottom = bottom;
+		m_Top = top;
+		InvalidateProjection();
+	}
 
-		m_ViewMatrix = glm::inverse(transform);
-		m_ProjectionViewMatrix = m_ProjectionMatrix * m_ViewMatrix;
+	glm::mat4 OrthographicCamera::CalculateProjectionMatrix() const
+	{
+		return glm::ortho(m_Left, m_Right, m_Bottom, m_Top, -1.0f, 1.0f);
+	}
+
+	glm::mat4 OrthographicCamera::CalculateViewMatrix() const
+	{
+		// inverse(T * R) = R^-1 * T^-1: basta ruotare e traslare in senso opposto, senza glm::inverse.
+		return glm::rotate(glm::mat4(1.0f), glm::radians(-m_Rotation), glm::vec3(0, 0, 1)) *
+			glm::translate(glm::mat4(1.0f), -m_Position);
 	}
 
-}
\ No newline at end of file
+}
@@ -1,34 +1,27 @@
 #pragma once
 
-#include <glm/glm.hpp>
+#include "Camera.h"
 
 namespace GameEngine {
 
-	class OrthographicCamera
+	class OrthographicCamera : public Camera
 	{
 	public:
 		OrthographicCamera(float left, float right, float bottom, float top);
 
-		const glm::vec3& GetPosition() const { return m_Position; }
-		void SetPosition(const glm::vec3& position) { m_Position = position; RecalculateViewMatrix(); }
+		void SetProjection(float left, float right, float bottom, float top);
 
 		float GetRotation() const { return m_Rotation; }
-		void SetRotation(float rotation) { m_Rotation = rotation; RecalculateViewMatrix(); }
+		void SetRotation(float rotation) { m_Rotation = rotation; InvalidateView(); }
 
-		const glm::mat4& GetProjectionMatrix() const { return m_ProjectionMatrix; }
-		const glm::mat4& GetViewMatrix() const { return m_ViewMatrix; }
-		const glm::mat4& GetProjectionViewMatrix() const { return m_ProjectionViewMatrix; }
-
-	private:
-		void RecalculateViewMatrix();
+	protected:
+		virtual glm::mat4 CalculateProjectionMatrix() const override;
+		// La View  l'inverso della matrice di trasformazione della camera.
+		virtual glm::mat4 CalculateViewMatrix() const override;
 
 	private:
-		glm::mat4 m_ProjectionMatrix;
-		// La View  l'inverso della matrice di trasformazione della camera.
-		glm::mat4 m_ViewMatrix;
-		glm::mat4 m_ProjectionViewMatrix;
+		float m_Left, m_Right, m_Bottom, m_Top;
 
-		glm::vec3 m_Position = { 0.0f, 0.0f, 0.0f };
 		// Essendo la camera ortografica (2D), la rotazione avviene solo sull'asse Z.
 		// Perci ci serve un solo valore e non un vettore.
 		float m_Rotation = 0.0f;
@@ -0,0 +1,234 @@
+#include "hzpch.h"
+#include "ParticleSystem.h"
+
+#include "VertexPacking.h"
+#include "GameEngine/Core/CPUInfo.h"
+#include "GameEngine/Core/JobSystem.h"
+
+#ifdef HZ_ARCH_X64
+	#include <immintrin.h>
+#endif
+
+namespace GameEngine {
+
+	// Sotto questa soglia il costo di distribuire il lavoro sui worker supera il guadagno.
+	static const uint32_t s_ParallelThreshold = 32768;
+	// Multiplo di 8: ogni blocco (tranne l'ultimo) viene processato interamente dal percorso SIMD.
+	static const uint32_t s_BatchSize = 16384;
+
+	struct ParticleStreams
+	{
+		float* PositionX;
+		float* PositionY;
+		float* VelocityX;
+		float* VelocityY;
+		float* Life;
+	};
+
+	using UpdateKernel = void(*)(const ParticleStreams&, uint32_t, uint32_t, float, const glm::vec2&);
+
+	#pragma region Update kernels
+	static void UpdateScalar(const ParticleStreams& p, uint32_t begin, uint32_t end, float dt, const glm::vec2& gravity)
+	{
+		const float gx = gravity.x * dt;
+		const float gy = gravity.y * dt;
+		for (uint32_t i = begin; i < end; i++)
+		{
+			p.VelocityX[i] += gx;
+			p.VelocityY[i] += gy;
+			p.PositionX[i] += p.VelocityX[i] * dt;
+			p.PositionY[i] += p.VelocityY[i] * dt;
+			p.Life[i] -= dt;
+		}
+	}
+
+#ifdef HZ_ARCH_X64
+	static void UpdateSSE(const ParticleStreams& p, uint32_t begin, uint32_t end, float dt, const glm::vec2& gravity)
+	{
+		const __m128 vdt = _mm_set1_ps(dt);
+		const __m128 gx = _mm_set1_ps(gravity.x * dt);
+		const __m128 gy = _mm_set1_ps(gravity.y * dt);
+
+		uint32_t i = begin;
+		for (; i + 4 <= end; i += 4)
+		{
+			__m128 vx = _mm_add_ps(_mm_loadu_ps(p.VelocityX + i), gx);
+			__m128 vy = _mm_add_ps(_mm_loadu_ps(p.VelocityY + i), gy);
+			_mm_storeu_ps(p.VelocityX + i, vx);
+			_mm_storeu_ps(p.VelocityY + i, vy);
+			_mm_storeu_ps(p.PositionX + i, _mm_add_ps(_mm_loadu_ps(p.PositionX + i), _mm_mul_ps(vx, vdt)));
+			_mm_storeu_ps(p.PositionY + i, _mm_add_ps(_mm_loadu_ps(p.PositionY + i), _mm_mul_ps(vy, vdt)));
+			_mm_storeu_ps(p.Life + i, _mm_sub_ps(_mm_loadu_ps(p.Life + i), vdt));
+		}
+
+		UpdateScalar(p, i, end, dt, gravity);
+	}
+
+	HZ_TARGET_AVX static void UpdateAVX(const ParticleStreams& p, uint32_t begin, uint32_t end, float dt, const glm::vec2& gravity)
+	{
+		const __m256 vdt = _mm256_set1_ps(dt);
+		const __m256 gx = _mm256_set1_ps(gravity.x * dt);
+		const __m256 gy = _mm256_set1_ps(gravity.y * dt);
+
+		uint32_t i = begin;
+		for (; i + 8 <= end; i += 8)
+		{
+			__m256 vx = _mm256_add_ps(_mm256_loadu_ps(p.VelocityX + i), gx);
+			__m256 vy = _mm256_add_ps(_mm256_loadu_ps(p.VelocityY + i), gy);
+			_mm256_storeu_ps(p.VelocityX + i, vx);
+			_mm256_storeu_ps(p.VelocityY + i, vy);
+			_mm256_storeu_ps(p.PositionX + i, _mm256_add_ps(_mm256_loadu_ps(p.PositionX + i), _mm256_mul_ps(vx, vdt)));
+			_mm256_storeu_ps(p.PositionY + i, _mm256_add_ps(_mm256_loadu_ps(p.PositionY + i), _mm256_mul_ps(vy, vdt)));
+			_mm256_storeu_ps(p.Life + i, _mm256_sub_ps(_mm256_loadu_ps(p.Life + i), vdt));
+		}
+
+		UpdateScalar(p, i, end, dt, gravity);
+	}
+#endif
+
+	static UpdateKernel SelectUpdateKernel()
+	{
+#ifdef HZ_ARCH_X64
+		if (CPUInfo::GetFeatures().AVX)
+			return UpdateAVX;
+		return UpdateSSE;
+#else
+		return UpdateScalar;
+#endif
+	}
+	#pragma endregion
+
+	ParticleEmitter::ParticleEmitter(uint32_t maxParticles)
+		: m_MaxParticles(maxParticles), m_Random(std::random_device()())
+	{
+		// Tutta la memoria viene allocata subito: emettere particelle non rialloca mai.
+		m_PositionX.resize(maxParticles);
+		m_PositionY.resize(maxParticles);
+		m_VelocityX.resize(maxParticles);
+		m_VelocityY.resize(maxParticles);
+		m_Life.resize(maxParticles);
+		m_InvLifeTime.resize(maxParticles);
+		m_SizeBegin.resize(maxParticles);
+		m_SizeEnd.resize(maxParticles);
+		m_ColorBegin.resize(maxParticles);
+		m_ColorEnd.resize(maxParticles);
+	}
+
+	void ParticleEmitter::Emit(const ParticleProps& props, uint32_t count)
+	{
+		HZ_CORE_ASSERT(props.LifeTime > 0.0f, "Particle lifetime must be positive!");
+
+		count = std::min(count, m_MaxParticles - m_AliveCount);
+
+		std::uniform_real_distribution<float> variation(-0.5f, 0.5f);
+		const uint32_t colorBegin = VertexPacking::PackUByte4N(props.ColorBegin);
+		const uint32_t colorEnd = VertexPacking::PackUByte4N(props.ColorEnd);
+
+		for (uint32_t n = 0; n < count; n++)
+		{
+			uint32_t i = m_AliveCount++;
+			m_PositionX[i] = props.Position.x;
+			m_PositionY[i] = props.Position.y;
+			m_VelocityX[i] = props.Velocity.x + props.VelocityVariation.x * variation(m_Random);
+			m_VelocityY[i] = props.Velocity.y + props.VelocityVariation.y * variation(m_Random);
+			m_Life[i] = props.LifeTime;
+			m_InvLifeTime[i] = 1.0f / props.LifeTime;
+
+			float sizeScale = 1.0f + props.SizeVariation * variation(m_Random);
+			m_SizeBegin[i] = props.SizeBegin * sizeScale;
+			m_SizeEnd[i] = props.SizeEnd * sizeScale;
+			m_ColorBegin[i] = colorBegin;
+			m_ColorEnd[i] = colorEnd;
+		}
+	}
+
+	void ParticleEmitter::OnUpdate(Timestep ts)
+	{
+		static const UpdateKernel s_Update = SelectUpdateKernel();
+
+		if (m_AliveCount == 0)
+			return;
+
+		const ParticleStreams streams = {
+			m_PositionX.data(), m_PositionY.data(), m_VelocityX.data(), m_VelocityY.data(), m_Life.data()
+		};
+		const float dt = ts;
+		const glm::vec2 gravity = m_Gravity;
+
+		if (m_AliveCount < s_ParallelThreshold)
+			s_Update(streams, 0, m_AliveCount, dt, gravity);
+		else
+			JobSystem::ParallelFor(m_AliveCount, s_BatchSize, [&](uint32_t begin, uint32_t end)
+			{
+				s_Update(streams, begin, end, dt, gravity);
+			});
+
+		RemoveDeadParticles();
+	}
+
+	void ParticleEmitter::RemoveDeadParticles()
+	{
+		uint32_t i = 0;
+		while (i < m_AliveCount)
+		{
+			if (m_Life[i] > 0.0f)
+			{
+				i++;
+				continue;
+			}
+
+			// L'ultima particella viva prende il posto di quella morta; i non avanza
+			// perché anche la particella spostata va controllata.
+			uint32_t last = --m_AliveCount;
+			m_PositionX[i] = m_PositionX[last];
+			m_PositionY[i] = m_PositionY[last];
+			m_VelocityX[i] = m_VelocityX[last];
+			m_VelocityY[i] = m_VelocityY[last];
+			m_Life[i] = m_Life[last];
+			m_InvLifeTime[i] = m_InvLifeTime[last];
+			m_SizeBegin[i] = m_SizeBegin[last];
+			m_SizeEnd[i] = m_SizeEnd[last];
+			m_ColorBegin[i] = m_ColorBegin[last];
+			m_ColorEnd[i] = m_ColorEnd[last];
+		}
+	}
+
+	// Interpola i 4 canali a 8 bit di due colori UByte4N; t = 1 restituisce begin, t = 0 end.
+	static uint32_t LerpPackedColor(uint32_t begin, uint32_t end, float t)
+	{
+		uint32_t weight = (uint32_t)(t * 256.0f);
+		uint32_t result = 0;
+		for (uint32_t shift = 0; shift < 32; shift += 8)
+		{
+			uint32_t b = (begin >> shift) & 0xff;
+			uint32_t e = (end >> shift) & 0xff;
+			uint32_t channel = (b * weight + e * (256 - weight)) >> 8;
+			result |= channel << shift;
+		}
+		return result;
+	}
+
+	void ParticleEmitter::WriteInstances(ParticleInstance* destination) const
+	{
+		auto write = [this, destination](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t i = begin; i < end; i++)
+			{
+				float t = std::min(std::max(m_Life[i] * m_InvLifeTime[i], 0.0f), 1.0f);
+
+				// La destinazione è spesso memoria write-combined: la scriviamo in ordine, una istanza intera alla volta.
+				ParticleInstance instance;
+				instance.Position = { m_PositionX[i], m_PositionY[i] };
+				instance.Size = m_SizeEnd[i] + (m_SizeBegin[i] - m_SizeEnd[i]) * t;
+				instance.Color = LerpPackedColor(m_ColorBegin[i], m_ColorEnd[i], t);
+				destination[i] = instance;
+			}
+		};
+
+		if (m_AliveCount < s_ParallelThreshold)
+			write(0, m_AliveCount);
+		else
+			JobSystem::ParallelFor(m_AliveCount, s_BatchSize, write);
+	}
+
+}
@@ -0,0 +1,37 @@
+#include "hzpch.h"
+#include "PerspectiveCamera.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace GameEngine {
+
+	PerspectiveCamera::PerspectiveCamera(float fov, float aspectRatio, float nearClip, float farClip)
+		: m_FieldOfView(fov), m_AspectRatio(aspectRatio), m_NearClip(nearClip), m_FarClip(farClip)
+	{
+	}
+
+	glm::vec3 PerspectiveCamera::GetForwardDirection() const
+	{
+		// In OpenGL la camera guarda verso -Z.
+		return glm::vec3(GetOrientation() * glm::vec4(0.0f, 0.0f, -1.0f, 0.0f));
+	}
+
+	glm::mat4 PerspectiveCamera::GetOrientation() const
+	{
+		return glm::rotate(glm::mat4(1.0f), glm::radians(m_Rotation.y), glm::vec3(0, 1, 0)) *
+			glm::rotate(glm::mat4(1.0f), glm::radians(m_Rotation.x), glm::vec3(1, 0, 0)) *
+			glm::rotate(glm::mat4(1.0f), glm::radians(m_Rotation.z), glm::vec3(0, 0, 1));
+	}
+
+	glm::mat4 PerspectiveCamera::CalculateProjectionMatrix() const
+	{
+		return glm::perspective(glm::radians(m_FieldOfView), m_AspectRatio, m_NearClip, m_FarClip);
+	}
+
+	glm::mat4 PerspectiveCamera::CalculateViewMatrix() const
+	{
+		// La rotazione è ortonormale: la sua inversa è la trasposta.
+		return glm::transpose(GetOrientation()) * glm::translate(glm::mat4(1.0f), -m_Position);
+	}
+
+}
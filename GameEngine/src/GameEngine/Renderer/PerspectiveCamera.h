@@ -0,0 +1,43 @@
+#pragma once
+
+#include "Camera.h"
+
+namespace GameEngine {
+
+	class PerspectiveCamera : public Camera
+	{
+	public:
+		PerspectiveCamera(float fov, float aspectRatio, float nearClip = 0.1f, float farClip = 1000.0f);
+
+		// Campo visivo verticale, in gradi.
+		float GetFieldOfView() const { return m_FieldOfView; }
+		void SetFieldOfView(float fov) { m_FieldOfView = fov; InvalidateProjection(); }
+
+		float GetAspectRatio() const { return m_AspectRatio; }
+		void SetAspectRatio(float aspectRatio) { m_AspectRatio = aspectRatio; InvalidateProjection(); }
+
+		void SetClipPlanes(float nearClip, float farClip) { m_NearClip = nearClip; m_FarClip = farClip; InvalidateProjection(); }
+
+		// Angoli di Eulero in gradi: x = pitch, y = yaw, z = roll.
+		const glm::vec3& GetRotation() const { return m_Rotation; }
+		void SetRotation(const glm::vec3& rotation) { m_Rotation = rotation; InvalidateView(); }
+
+		glm::vec3 GetForwardDirection() const;
+
+	protected:
+		virtual glm::mat4 CalculateProjectionMatrix() const override;
+		virtual glm::mat4 CalculateViewMatrix() const override;
+
+	private:
+		glm::mat4 GetOrientation() const;
+
+	private:
+		float m_FieldOfView;
+		float m_AspectRatio;
+		float m_NearClip;
+		float m_FarClip;
+
+		glm::vec3 m_Rotation = { 0.0f, 0.0f, 0.0f };
+	};
+
+}
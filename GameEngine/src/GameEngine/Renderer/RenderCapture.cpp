@@ -0,0 +1,890 @@
+#include "hzpch.h"
+#include "RenderCapture.h"
+
+#include "RenderCommand.h"
+
+#include <fstream>
+
+namespace GameEngine {
+
+	// I record vengono accumulati in memoria e scritti a blocchi: una write per chiamata renderebbe la cattura inutilizzabile.
+	static const size_t s_FlushThreshold = 4 * 1024 * 1024;
+
+	struct RenderCaptureData
+	{
+		std::ofstream File;
+		std::vector<uint8_t> Buffer;
+		RenderCaptureHeader Header;
+		uint32_t FrameLimit = 0;
+
+		uint32_t NextID = 1;
+		std::unordered_map<const void*, uint32_t> Resources;
+		std::unordered_map<std::string, uint32_t> Strings;
+
+		RendererAPI* PreviousAPI = nullptr;
+		Scope<RendererAPI> CaptureAPI;
+	};
+
+	static RenderCaptureData* s_Data = nullptr;
+
+	#pragma region Scrittura
+	static void Flush()
+	{
+		s_Data->File.write((const char*)s_Data->Buffer.data(), s_Data->Buffer.size());
+		s_Data->Buffer.clear();
+	}
+
+	static void WriteBytes(const void* data, size_t size)
+	{
+		const uint8_t* bytes = (const uint8_t*)data;
+		s_Data->Buffer.insert(s_Data->Buffer.end(), bytes, bytes + size);
+	}
+
+	static void WriteOp(RenderCaptureOp op)
+	{
+		if (s_Data->Buffer.size() >= s_FlushThreshold)
+			Flush();
+		s_Data->Buffer.push_back((uint8_t)op);
+	}
+
+	static void WriteU8(uint8_t value) { s_Data->Buffer.push_back(value); }
+	static void WriteU32(uint32_t value) { WriteBytes(&value, sizeof(value)); }
+	static void WriteFloats(const float* values, uint32_t count) { WriteBytes(values, count * sizeof(float)); }
+
+	static void WriteBlob(const void* data, uint32_t size)
+	{
+		WriteU32(size);
+		WriteBytes(data, size);
+	}
+
+	static void WriteString(const std::string& text)
+	{
+		WriteBlob(text.data(), (uint32_t)text.size());
+	}
+
+	// I nomi degli uniform si ripetono ad ogni frame: nel file compaiono una volta sola, poi solo come id.
+	static uint32_t GetStringID(const std::string& text)
+	{
+		auto it = s_Data->Strings.find(text);
+		if (it != s_Data->Strings.end())
+			return it->second;
+
+		uint32_t id = (uint32_t)s_Data->Strings.size() + 1;
+		s_Data->Strings[text] = id;
+		WriteOp(RenderCaptureOp::DefineString);
+		WriteU32(id);
+		WriteString(text);
+		return id;
+	}
+
+	static uint32_t RegisterResource(const void* resource)
+	{
+		uint32_t id = s_Data->NextID++;
+		s_Data->Resources[resource] = id;
+		return id;
+	}
+
+	static uint32_t GetResourceID(const void* resource)
+	{
+		auto it = s_Data->Resources.find(resource);
+		return it != s_Data->Resources.end() ? it->second : 0;
+	}
+
+	static void DestroyResource(const void* resource)
+	{
+		if (!RenderCapture::IsRecording())
+			return;
+
+		uint32_t id = GetResourceID(resource);
+		s_Data->Resources.erase(resource);
+		WriteOp(RenderCaptureOp::Destroy);
+		WriteU32(id);
+	}
+
+	// Record di una chiamata su una risorsa: op seguito dall'id.
+	static bool BeginResourceOp(RenderCaptureOp op, const void* resource)
+	{
+		if (!RenderCapture::IsRecording())
+			return false;
+
+		WriteOp(op);
+		WriteU32(GetResourceID(resource));
+		return true;
+	}
+	#pragma endregion
+
+	#pragma region Risorse catturate
+	// Ogni oggetto inoltra le chiamate alla risorsa del backend dopo averle registrate.
+	// Bind/Unbind dei vertex e index buffer non vengono registrati: lo stato che conta per le draw call è nel vertex array.
+
+	class CapturedVertexBuffer : public VertexBuffer
+	{
+	public:
+		CapturedVertexBuffer(VertexBuffer* target) : m_Target(target) {}
+		virtual ~CapturedVertexBuffer() { DestroyResource(this); }
+
+		virtual void Bind() const override { m_Target->Bind(); }
+		virtual void Unbind() const override { m_Target->Unbind(); }
+
+		virtual void SetData(const void* data, uint32_t size) override
+		{
+			if (BeginResourceOp(RenderCaptureOp::VertexBufferSetData, this))
+				WriteBlob(data, size);
+			m_Target->SetData(data, size);
+		}
+
+		// Il chiamante scrive in una copia locale: la memoria mappata è in sola scrittura e non può essere riletta.
+		virtual void* Map(uint32_t size) override
+		{
+			if (!RenderCapture::IsRecording())
+				return m_Target->Map(size);
+
+			m_Staging.resize(size);
+			return m_Staging.data();
+		}
+
+		virtual void Unmap() override
+		{
+			if (m_Staging.empty())
+			{
+				m_Target->Unmap();
+				return;
+			}
+
+			uint32_t size = (uint32_t)m_Staging.size();
+			if (BeginResourceOp(RenderCaptureOp::VertexBufferSetData, this))
+				WriteBlob(m_Staging.data(), size);
+
+			memcpy(m_Target->Map(size), m_Staging.data(), size);
+			m_Target->Unmap();
+			m_Staging.clear();
+		}
+
+		virtual uint32_t GetSize() const override { return m_Target->GetSize(); }
+
+		virtual const BufferLayout& GetLayout() const override { return m_Target->GetLayout(); }
+		virtual void SetLayout(const BufferLayout& layout) override
+		{
+			if (RenderCapture::IsRecording())
+			{
+				// I nomi vanno definiti prima del record: GetStringID può scrivere un DefineString.
+				std::vector<uint32_t> nameIDs;
+				for (const BufferElement& element : layout)
+					nameIDs.push_back(GetStringID(element.Name));
+
+				BeginResourceOp(RenderCaptureOp::VertexBufferSetLayout, this);
+				WriteU32((uint32_t)nameIDs.size());
+				for (size_t i = 0; i < nameIDs.size(); i++)
+				{
+					const BufferElement& element = layout.GetElements()[i];
+					WriteU8((uint8_t)element.Type);
+					WriteU8(element.Normalized ? 1 : 0);
+					WriteU32(nameIDs[i]);
+				}
+			}
+			m_Target->SetLayout(layout);
+		}
+
+	private:
+		Scope<VertexBuffer> m_Target;
+		std::vector<uint8_t> m_Staging;
+	};
+
+	class CapturedIndexBuffer : public IndexBuffer
+	{
+	public:
+		CapturedIndexBuffer(IndexBuffer* target) : m_Target(target) {}
+		virtual ~CapturedIndexBuffer() { DestroyResource(this); }
+
+		virtual void Bind() const override { m_Target->Bind(); }
+		virtual void Unbind() const override { m_Target->Unbind(); }
+
+		virtual uint32_t GetCount() const override { return m_Target->GetCount(); }
+		virtual uint32_t GetIndexSize() const override { return m_Target->GetIndexSize(); }
+
+	private:
+		Scope<IndexBuffer> m_Target;
+	};
+
+	class CapturedVertexArray : public VertexArray
+	{
+	public:
+		CapturedVertexArray(VertexArray* target) : m_Target(target) {}
+		virtual ~CapturedVertexArray() { DestroyResource(this); }
+
+		virtual void Bind() const override
+		{
+			BeginResourceOp(RenderCaptureOp::VertexArrayBind, this);
+			m_Target->Bind();
+		}
+
+		virtual void Unbind() const override
+		{
+			BeginResourceOp(RenderCaptureOp::VertexArrayUnbind, this);
+			m_Target->Unbind();
+		}
+
+		virtual void AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer, uint32_t instanceDivisor = 0) override
+		{
+			if (BeginResourceOp(RenderCaptureOp::VertexArrayAddVertexBuffer, this))
+			{
+				WriteU32(GetResourceID(vertexBuffer.get()));
+				WriteU32(instanceDivisor);
+			}
+			m_Target->AddVertexBuffer(vertexBuffer, instanceDivisor);
+		}
+
+		virtual void SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer) override
+		{
+			if (BeginResourceOp(RenderCaptureOp::VertexArraySetIndexBuffer, this))
+				WriteU32(GetResourceID(indexBuffer.get()));
+			m_Target->SetIndexBuffer(indexBuffer);
+		}
+
+		virtual const std::vector<Ref<VertexBuffer>>& GetVertexBuffers() const override { return m_Target->GetVertexBuffers(); }
+		virtual const Ref<IndexBuffer>& GetIndexBuffers() const override { return m_Target->GetIndexBuffers(); }
+		virtual uint32_t GetVertexCount() const override { return m_Target->GetVertexCount(); }
+
+	private:
+		Scope<VertexArray> m_Target;
+	};
+
+	class CapturedShader : public Shader
+	{
+	public:
+		CapturedShader(Shader* target) : m_Target(target) {}
+		virtual ~CapturedShader() { DestroyResource(this); }
+
+		virtual void Bind() const override
+		{
+			BeginResourceOp(RenderCaptureOp::ShaderBind, this);
+			m_Target->Bind();
+		}
+
+		virtual void Unbind() const override
+		{
+			BeginResourceOp(RenderCaptureOp::ShaderUnbind, this);
+			m_Target->Unbind();
+		}
+
+		virtual void SetInt(const std::string& name, int value) override
+		{
+			if (BeginUniformOp(RenderCaptureOp::ShaderSetInt, name))
+				WriteU32((uint32_t)value);
+			m_Target->SetInt(name, value);
+		}
+
+		virtual void SetIntArray(const std::string& name, int* values, uint32_t count) override
+		{
+			if (BeginUniformOp(RenderCaptureOp::ShaderSetIntArray, name))
+			{
+				WriteU32(count);
+				WriteBytes(values, count * sizeof(int));
+			}
+			m_Target->SetIntArray(name, values, count);
+		}
+
+		virtual void SetFloat3(const std::string& name, const glm::vec3& value) override
+		{
+			if (BeginUniformOp(RenderCaptureOp::ShaderSetFloat3, name))
+				WriteFloats(&value.x, 3);
+			m_Target->SetFloat3(name, value);
+		}
+
+		virtual void SetFloat4(const std::string& name, const glm::vec4& value) override
+		{
+			if (BeginUniformOp(RenderCaptureOp::ShaderSetFloat4, name))
+				WriteFloats(&value.x, 4);
+			m_Target->SetFloat4(name, value);
+		}
+
+		virtual void SetMat4(const std::string& name, const glm::mat4& value) override
+		{
+			if (BeginUniformOp(RenderCaptureOp::ShaderSetMat4, name))
+				WriteFloats(&value[0][0], 16);
+			m_Target->SetMat4(name, value);
+		}
+
+	private:
+		bool BeginUniformOp(RenderCaptureOp op, const std::string& name)
+		{
+			if (!RenderCapture::IsRecording())
+				return false;
+
+			// Il nome va definito prima dell'op che lo usa.
+			uint32_t nameID = GetStringID(name);
+			BeginResourceOp(op, this);
+			WriteU32(nameID);
+			return true;
+		}
+
+	private:
+		Scope<Shader> m_Target;
+	};
+
+	class CapturedTexture2D : public Texture2D
+	{
+	public:
+		CapturedTexture2D(Texture2D* target) : m_Target(target) {}
+		virtual ~CapturedTexture2D() { DestroyResource(this); }
+
+		virtual uint32_t GetWidth() const override { return m_Target->GetWidth(); }
+		virtual uint32_t GetHeight() const override { return m_Target->GetHeight(); }
+		virtual uint32_t GetRendererID() const override { return m_Target->GetRendererID(); }
+
+		virtual void SetData(void* data, uint32_t size) override
+		{
+			if (BeginResourceOp(RenderCaptureOp::TextureSetData, this))
+				WriteBlob(data, size);
+			m_Target->SetData(data, size);
+		}
+
+		virtual void Bind(uint32_t slot = 0) const override
+		{
+			if (BeginResourceOp(RenderCaptureOp::TextureBind, this))
+				WriteU32(slot);
+			m_Target->Bind(slot);
+		}
+
+	private:
+		Scope<Texture2D> m_Target;
+	};
+
+	class CapturedTextureArray : public TextureArray
+	{
+	public:
+		CapturedTextureArray(TextureArray* target) : m_Target(target) {}
+		virtual ~CapturedTextureArray() { DestroyResource(this); }
+
+		virtual uint32_t GetWidth() const override { return m_Target->GetWidth(); }
+		virtual uint32_t GetHeight() const override { return m_Target->GetHeight(); }
+		virtual uint32_t GetLayerCount() const override { return m_Target->GetLayerCount(); }
+		virtual uint32_t GetRendererID() const override { return m_Target->GetRendererID(); }
+
+		virtual void SetData(void* data, uint32_t size) override
+		{
+			if (BeginResourceOp(RenderCaptureOp::TextureSetData, this))
+				WriteBlob(data, size);
+			m_Target->SetData(data, size);
+		}
+
+		virtual void SetLayerData(uint32_t layer, const void* data, uint32_t size) override
+		{
+			if (BeginResourceOp(RenderCaptureOp::TextureArraySetLayerData, this))
+			{
+				WriteU32(layer);
+				WriteBlob(data, size);
+			}
+			m_Target->SetLayerData(layer, data, size);
+		}
+
+		virtual void Bind(uint32_t slot = 0) const override
+		{
+			if (BeginResourceOp(RenderCaptureOp::TextureBind, this))
+				WriteU32(slot);
+			m_Target->Bind(slot);
+		}
+
+	private:
+		Scope<TextureArray> m_Target;
+	};
+
+	class CapturedUniformBuffer : public UniformBuffer
+	{
+	public:
+		CapturedUniformBuffer(UniformBuffer* target) : m_Target(target) {}
+		virtual ~CapturedUniformBuffer() { DestroyResource(this); }
+
+		virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) override
+		{
+			if (BeginResourceOp(RenderCaptureOp::UniformBufferSetData, this))
+			{
+				WriteU32(offset);
+				WriteBlob(data, size);
+			}
+			m_Target->SetData(data, size, offset);
+		}
+
+		virtual void Bind(uint32_t binding) const override
+		{
+			if (BeginResourceOp(RenderCaptureOp::UniformBufferBind, this))
+				WriteU32(binding);
+			m_Target->Bind(binding);
+		}
+
+	private:
+		Scope<UniformBuffer> m_Target;
+	};
+
+	class CapturedStorageBuffer : public StorageBuffer
+	{
+	public:
+		CapturedStorageBuffer(StorageBuffer* target) : m_Target(target) {}
+		virtual ~CapturedStorageBuffer() { DestroyResource(this); }
+
+		virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) override
+		{
+			if (BeginResourceOp(RenderCaptureOp::StorageBufferSetData, this))
+			{
+				WriteU32(offset);
+				WriteBlob(data, size);
+			}
+			m_Target->SetData(data, size, offset);
+		}
+
+		virtual void Bind(uint32_t binding) const override
+		{
+			if (BeginResourceOp(RenderCaptureOp::StorageBufferBind, this))
+				WriteU32(binding);
+			m_Target->Bind(binding);
+		}
+
+		virtual uint32_t GetSize() const override { return m_Target->GetSize(); }
+		virtual uint32_t GetRendererID() const override { return m_Target->GetRendererID(); }
+
+	private:
+		Scope<StorageBuffer> m_Target;
+	};
+
+	class CapturedFramebuffer : public Framebuffer
+	{
+	public:
+		CapturedFramebuffer(Framebuffer* target) : m_Target(target) {}
+		virtual ~CapturedFramebuffer() { DestroyResource(this); }
+
+		virtual void Bind() override
+		{
+			BeginResourceOp(RenderCaptureOp::FramebufferBind, this);
+			m_Target->Bind();
+		}
+
+		virtual void Unbind() override
+		{
+			BeginResourceOp(RenderCaptureOp::FramebufferUnbind, this);
+			m_Target->Unbind();
+		}
+
+		virtual void Resize(uint32_t width, uint32_t height) override
+		{
+			if (BeginResourceOp(RenderCaptureOp::FramebufferResize, this))
+			{
+				WriteU32(width);
+				WriteU32(height);
+			}
+			m_Target->Resize(width, height);
+		}
+
+		virtual void ClearColorAttachment(uint32_t index, const glm::vec4& value) override
+		{
+			if (BeginResourceOp(RenderCaptureOp::FramebufferClearColorAttachment, this))
+			{
+				WriteU32(index);
+				WriteFloats(&value.x, 4);
+			}
+			m_Target->ClearColorAttachment(index, value);
+		}
+
+		virtual void BlitToScreen(uint32_t srcWidth, uint32_t srcHeight, uint32_t dstWidth, uint32_t dstHeight) const override
+		{
+			if (BeginResourceOp(RenderCaptureOp::FramebufferBlitToScreen, this))
+			{
+				WriteU32(srcWidth);
+				WriteU32(srcHeight);
+				WriteU32(dstWidth);
+				WriteU32(dstHeight);
+			}
+			m_Target->BlitToScreen(srcWidth, srcHeight, dstWidth, dstHeight);
+		}
+
+		virtual uint32_t GetColorAttachmentRendererID(uint32_t index = 0) const override { return m_Target->GetColorAttachmentRendererID(index); }
+		virtual const FramebufferSpecification& GetSpecification() const override { return m_Target->GetSpecification(); }
+
+	private:
+		Scope<Framebuffer> m_Target;
+	};
+
+	class CapturedRendererAPI : public RendererAPI
+	{
+	public:
+		CapturedRendererAPI(RendererAPI* target) : m_Target(target) {}
+
+		virtual void Init() override { m_Target->Init(); }
+
+		virtual void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) override
+		{
+			if (RenderCapture::IsRecording())
+			{
+				WriteOp(RenderCaptureOp::SetViewport);
+				WriteU32(x);
+				WriteU32(y);
+				WriteU32(width);
+				WriteU32(height);
+			}
+			m_Target->SetViewport(x, y, width, height);
+		}
+
+		virtual void SetClearColor(const glm::vec4& color) override
+		{
+			if (RenderCapture::IsRecording())
+			{
+				WriteOp(RenderCaptureOp::SetClearColor);
+				WriteFloats(&color.x, 4);
+			}
+			m_Target->SetClearColor(color);
+		}
+
+		virtual void Clear() override
+		{
+			if (RenderCapture::IsRecording())
+				WriteOp(RenderCaptureOp::Clear);
+			m_Target->Clear();
+		}
+
+		virtual void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0) override
+		{
+			if (BeginResourceOp(RenderCaptureOp::DrawIndexed, vertexArray.get()))
+				WriteU32(indexCount);
+			m_Target->DrawIndexed(vertexArray, indexCount);
+		}
+
+		virtual void DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t instanceCount, uint32_t indexCount = 0) override
+		{
+			if (BeginResourceOp(RenderCaptureOp::DrawIndexedInstanced, vertexArray.get()))
+			{
+				WriteU32(instanceCount);
+				WriteU32(indexCount);
+			}
+			m_Target->DrawIndexedInstanced(vertexArray, instanceCount, indexCount);
+		}
+
+		virtual void DrawIndexedIndirect(const Ref<VertexArray>& vertexArray, const Ref<StorageBuffer>& commands, uint32_t drawCount, uint32_t offset = 0) override
+		{
+			if (BeginResourceOp(RenderCaptureOp::DrawIndexedIndirect, vertexArray.get()))
+			{
+				WriteU32(GetResourceID(commands.get()));
+				WriteU32(drawCount);
+				WriteU32(offset);
+			}
+			m_Target->DrawIndexedIndirect(vertexArray, commands, drawCount, offset);
+		}
+
+		virtual void DispatchCompute(uint32_t groupsX, uint32_t groupsY = 1, uint32_t groupsZ = 1) override
+		{
+			if (RenderCapture::IsRecording())
+			{
+				WriteOp(RenderCaptureOp::DispatchCompute);
+				WriteU32(groupsX);
+				WriteU32(groupsY);
+				WriteU32(groupsZ);
+			}
+			m_Target->DispatchCompute(groupsX, groupsY, groupsZ);
+		}
+
+	private:
+		RendererAPI* m_Target;
+	};
+	#pragma endregion
+
+	#pragma region RenderCapture
+	bool RenderCapture::Begin(const std::string& path, uint32_t frameCount, uint32_t width, uint32_t height)
+	{
+		HZ_CORE_ASSERT(!s_Data, "A render capture is already in progress!");
+
+		s_Data = new RenderCaptureData();
+		s_Data->File.open(path, std::ios::binary);
+		if (!s_Data->File)
+		{
+			HZ_CORE_ERROR("Could not open capture file '{0}'", path);
+			delete s_Data;
+			s_Data = nullptr;
+			return false;
+		}
+
+		s_Data->Header.Width = width;
+		s_Data->Header.Height = height;
+		s_Data->FrameLimit = frameCount;
+		s_Data->Buffer.reserve(s_FlushThreshold + 64 * 1024);
+		WriteBytes(&s_Data->Header, sizeof(RenderCaptureHeader));
+
+		s_Data->PreviousAPI = RenderCommand::SetRendererAPI(nullptr);
+		s_Data->CaptureAPI.reset(new CapturedRendererAPI(s_Data->PreviousAPI));
+		RenderCommand::SetRendererAPI(s_Data->CaptureAPI.get());
+
+		HZ_CORE_INFO("Capturing {0} frames to '{1}'", frameCount, path);
+		return true;
+	}
+
+	void RenderCapture::End()
+	{
+		if (!s_Data)
+			return;
+
+		Flush();
+		// Il numero di frame è noto solo ora: riscriviamo l'header.
+		s_Data->File.seekp(0);
+		s_Data->File.write((const char*)&s_Data->Header, sizeof(RenderCaptureHeader));
+		s_Data->File.close();
+
+		HZ_CORE_INFO("Render capture finished: {0} frames, {1} resources alive", s_Data->Header.FrameCount, s_Data->Resources.size());
+
+		// Le risorse catturate restano in uso: da qui in poi si limitano ad inoltrare le chiamate.
+		RenderCommand::SetRendererAPI(s_Data->PreviousAPI);
+		delete s_Data;
+		s_Data = nullptr;
+	}
+
+	void RenderCapture::EndFrame()
+	{
+		if (!s_Data)
+			return;
+
+		WriteOp(RenderCaptureOp::FrameEnd);
+		if (++s_Data->Header.FrameCount >= s_Data->FrameLimit)
+			End();
+	}
+
+	bool RenderCapture::IsRecording()
+	{
+		return s_Data != nullptr;
+	}
+
+	VertexBuffer* RenderCapture::Capture(VertexBuffer* vertexBuffer, const void* vertices, uint32_t size)
+	{
+		if (!s_Data)
+			return vertexBuffer;
+
+		CapturedVertexBuffer* captured = new CapturedVertexBuffer(vertexBuffer);
+		WriteOp(RenderCaptureOp::CreateVertexBuffer);
+		WriteU32(RegisterResource(captured));
+		WriteU32(size);
+		WriteU8(vertices ? 1 : 0);
+		if (vertices)
+			WriteBlob(vertices, size);
+		return captured;
+	}
+
+	IndexBuffer* RenderCapture::Capture(IndexBuffer* indexBuffer, const uint32_t* indices, uint32_t count)
+	{
+		if (!s_Data)
+			return indexBuffer;
+
+		CapturedIndexBuffer* captured = new CapturedIndexBuffer(indexBuffer);
+		WriteOp(RenderCaptureOp::CreateIndexBuffer);
+		WriteU32(RegisterResource(captured));
+		WriteU32(count);
+		WriteBytes(indices, count * sizeof(uint32_t));
+		return captured;
+	}
+
+	VertexArray* RenderCapture::Capture(VertexArray* vertexArray)
+	{
+		if (!s_Data)
+			return vertexArray;
+
+		CapturedVertexArray* captured = new CapturedVertexArray(vertexArray);
+		WriteOp(RenderCaptureOp::CreateVertexArray);
+		WriteU32(RegisterResource(captured));
+		return captured;
+	}
+
+	Shader* RenderCapture::Capture(Shader* shader, const std::string& vertexSrc, const std::string& fragmentSrc)
+	{
+		if (!s_Data)
+			return shader;
+
+		CapturedShader* captured = new CapturedShader(shader);
+		WriteOp(RenderCaptureOp::CreateShader);
+		WriteU32(RegisterResource(captured));
+		WriteString(vertexSrc);
+		WriteString(fragmentSrc);
+		return captured;
+	}
+
+	Shader* RenderCapture::Capture(Shader* shader, const std::string& computeSrc)
+	{
+		if (!s_Data)
+			return shader;
+
+		CapturedShader* captured = new CapturedShader(shader);
+		WriteOp(RenderCaptureOp::CreateComputeShader);
+		WriteU32(RegisterResource(captured));
+		WriteString(computeSrc);
+		return captured;
+	}
+
+	Texture2D* RenderCapture::Capture(Texture2D* texture)
+	{
+		if (!s_Data)
+			return texture;
+
+		CapturedTexture2D* captured = new CapturedTexture2D(texture);
+		WriteOp(RenderCaptureOp::CreateTexture2D);
+		WriteU32(RegisterResource(captured));
+		WriteU32(texture->GetWidth());
+		WriteU32(texture->GetHeight());
+		return captured;
+	}
+
+	TextureArray* RenderCapture::Capture(TextureArray* textureArray)
+	{
+		if (!s_Data)
+			return textureArray;
+
+		CapturedTextureArray* captured = new CapturedTextureArray(textureArray);
+		WriteOp(RenderCaptureOp::CreateTextureArray);
+		WriteU32(RegisterResource(captured));
+		WriteU32(textureArray->GetWidth());
+		WriteU32(textureArray->GetHeight());
+		WriteU32(textureArray->GetLayerCount());
+		return captured;
+	}
+
+	UniformBuffer* RenderCapture::Capture(UniformBuffer* uniformBuffer, uint32_t size, uint32_t binding)
+	{
+		if (!s_Data)
+			return uniformBuffer;
+
+		CapturedUniformBuffer* captured = new CapturedUniformBuffer(uniformBuffer);
+		WriteOp(RenderCaptureOp::CreateUniformBuffer);
+		WriteU32(RegisterResource(captured));
+		WriteU32(size);
+		WriteU32(binding);
+		return captured;
+	}
+
+	StorageBuffer* RenderCapture::Capture(StorageBuffer* storageBuffer, uint32_t size, uint32_t binding)
+	{
+		if (!s_Data)
+			return storageBuffer;
+
+		CapturedStorageBuffer* captured = new CapturedStorageBuffer(storageBuffer);
+		WriteOp(RenderCaptureOp::CreateStorageBuffer);
+		WriteU32(RegisterResource(captured));
+		WriteU32(size);
+		WriteU32(binding);
+		return captured;
+	}
+
+	Framebuffer* RenderCapture::Capture(Framebuffer* framebuffer)
+	{
+		if (!s_Data)
+			return framebuffer;
+
+		const FramebufferSpecification& spec = framebuffer->GetSpecification();
+		CapturedFramebuffer* captured = new CapturedFramebuffer(framebuffer);
+		WriteOp(RenderCaptureOp::CreateFramebuffer);
+		WriteU32(RegisterResource(captured));
+		WriteU32(spec.Width);
+		WriteU32(spec.Height);
+		WriteU32((uint32_t)spec.Attachments.size());
+		for (FramebufferTextureFormat format : spec.Attachments)
+			WriteU8((uint8_t)format);
+		return captured;
+	}
+	#pragma endregion
+
+	#pragma region RenderCaptureReader
+	RenderCaptureReader::RenderCaptureReader(const std::string& path)
+	{
+		std::ifstream in(path, std::ios::binary | std::ios::ate);
+		if (!in)
+		{
+			HZ_CORE_ERROR("Could not open capture file '{0}'", path);
+			return;
+		}
+
+		m_Data.resize((size_t)in.tellg());
+		in.seekg(0);
+		in.read((char*)m_Data.data(), m_Data.size());
+
+		RenderCaptureHeader expected;
+		if (m_Data.size() < sizeof(RenderCaptureHeader))
+		{
+			HZ_CORE_ERROR("'{0}' is not a render capture", path);
+			return;
+		}
+
+		memcpy(&m_Header, m_Data.data(), sizeof(RenderCaptureHeader));
+		if (memcmp(m_Header.Magic, expected.Magic, sizeof(expected.Magic)) != 0 || m_Header.Version != expected.Version)
+		{
+			HZ_CORE_ERROR("'{0}' is not a render capture (or was written by an incompatible version)", path);
+			return;
+		}
+
+		m_Position = sizeof(RenderCaptureHeader);
+		m_Valid = true;
+	}
+
+	bool RenderCaptureReader::Next(RenderCaptureOp& op)
+	{
+		if (m_Error || m_Position >= m_Data.size())
+			return false;
+
+		uint8_t value = m_Data[m_Position++];
+		if (value >= (uint8_t)RenderCaptureOp::Count)
+		{
+			HZ_CORE_ERROR("Unknown render capture op {0} at offset {1}", value, m_Position - 1);
+			m_Error = true;
+			return false;
+		}
+
+		op = (RenderCaptureOp)value;
+		return true;
+	}
+
+	void RenderCaptureReader::Rewind()
+	{
+		m_Position = sizeof(RenderCaptureHeader);
+		m_Error = false;
+	}
+
+	const uint8_t* RenderCaptureReader::ReadBytes(uint32_t size)
+	{
+		if (m_Error || m_Data.size() - m_Position < size)
+		{
+			m_Error = true;
+			return nullptr;
+		}
+
+		const uint8_t* data = m_Data.data() + m_Position;
+		m_Position += size;
+		return data;
+	}
+
+	uint8_t RenderCaptureReader::ReadU8()
+	{
+		const uint8_t* data = ReadBytes(1);
+		return data ? *data : 0;
+	}
+
+	uint32_t RenderCaptureReader::ReadU32()
+	{
+		uint32_t value = 0;
+		if (const uint8_t* data = ReadBytes(sizeof(value)))
+			memcpy(&value, data, sizeof(value));
+		return value;
+	}
+
+	float RenderCaptureReader::ReadFloat()
+	{
+		float value = 0.0f;
+		if (const uint8_t* data = ReadBytes(sizeof(value)))
+			memcpy(&value, data, sizeof(value));
+		return value;
+	}
+
+	const uint8_t* RenderCaptureReader::ReadBlob(uint32_t& size)
+	{
+		size = ReadU32();
+		return ReadBytes(size);
+	}
+
+	std::string RenderCaptureReader::ReadString()
+	{
+		uint32_t size;
+		const uint8_t* data = ReadBlob(size);
+		return data ? std::string((const char*)data, size) : std::string();
+	}
+	#pragma endregion
+
+}
@@ -0,0 +1,152 @@
+#pragma once
+
+#include "GameEngine/Core.h"
+
+#include "Buffer.h"
+#include "VertexArray.h"
+#include "Shader.h"
+#include "Texture.h"
+#include "UniformBuffer.h"
+#include "StorageBuffer.h"
+#include "Framebuffer.h"
+
+#include <string>
+#include <vector>
+
+namespace GameEngine {
+
+	// Formato del file di cattura: header seguito da un flusso di record [u8 op][payload].
+	// Tutti i valori sono little-endian; blob = u32 size + byte, string = blob.
+	// Le risorse sono identificate da un id u32 (> 0) univoco per tutta la cattura, 0 = nessuna risorsa.
+	enum class RenderCaptureOp : uint8_t
+	{
+		FrameEnd = 0,						// -
+		DefineString,						// u32 id, string: nomi degli uniform, inviati una sola volta
+		Destroy,							// u32 id
+
+		CreateVertexBuffer,					// u32 id, u32 size, u8 hasData, [blob data]
+		CreateIndexBuffer,					// u32 id, u32 count, u32 indices[count]
+		CreateVertexArray,					// u32 id
+		CreateShader,						// u32 id, string vertexSrc, string fragmentSrc
+		CreateTexture2D,					// u32 id, u32 width, u32 height
+		CreateUniformBuffer,				// u32 id, u32 size, u32 binding
+		CreateFramebuffer,					// u32 id, u32 width, u32 height, u32 count, u8 formats[count]
+
+		VertexBufferSetLayout,				// u32 id, u32 count, { u8 type, u8 normalized, u32 nameId }[count]
+		VertexBufferSetData,				// u32 id, blob (anche per Map/Unmap)
+		VertexArrayAddVertexBuffer,			// u32 id, u32 vertexBuffer, u32 instanceDivisor
+		VertexArraySetIndexBuffer,			// u32 id, u32 indexBuffer
+		VertexArrayBind,					// u32 id
+		VertexArrayUnbind,					// u32 id
+		ShaderBind,							// u32 id
+		ShaderUnbind,						// u32 id
+		ShaderSetInt,						// u32 id, u32 nameId, i32 value
+		ShaderSetIntArray,					// u32 id, u32 nameId, u32 count, i32 values[count]
+		ShaderSetFloat3,					// u32 id, u32 nameId, f32[3]
+		ShaderSetFloat4,					// u32 id, u32 nameId, f32[4]
+		ShaderSetMat4,						// u32 id, u32 nameId, f32[16]
+		TextureSetData,						// u32 id, blob
+		TextureBind,						// u32 id, u32 slot
+		UniformBufferSetData,				// u32 id, u32 offset, blob
+		FramebufferBind,					// u32 id
+		FramebufferUnbind,					// u32 id
+		FramebufferResize,					// u32 id, u32 width, u32 height
+		FramebufferClearColorAttachment,	// u32 id, u32 index, f32[4]
+		FramebufferBlitToScreen,			// u32 id, u32 srcWidth, u32 srcHeight, u32 dstWidth, u32 dstHeight
+
+		SetViewport,						// u32 x, u32 y, u32 width, u32 height
+		SetClearColor,						// f32[4]
+		Clear,								// -
+		DrawIndexed,						// u32 vertexArray, u32 indexCount
+		DrawIndexedInstanced,				// u32 vertexArray, u32 instanceCount, u32 indexCount
+
+		UniformBufferBind,					// u32 id, u32 binding
+
+		CreateStorageBuffer,				// u32 id, u32 size, u32 binding
+		StorageBufferSetData,				// u32 id, u32 offset, blob
+		StorageBufferBind,					// u32 id, u32 binding
+		DrawIndexedIndirect,				// u32 vertexArray, u32 commands, u32 drawCount, u32 offset
+
+		CreateTextureArray,					// u32 id, u32 width, u32 height, u32 layers
+		TextureArraySetLayerData,			// u32 id, u32 layer, blob (SetData e Bind usano TextureSetData e TextureBind)
+
+		CreateComputeShader,				// u32 id, string computeSrc (Bind e uniform usano le op di Shader)
+		DispatchCompute,					// u32 groupsX, u32 groupsY, u32 groupsZ
+
+		Count
+	};
+
+	struct RenderCaptureHeader
+	{
+		char Magic[4] = { 'H', 'Z', 'R', 'C' };
+		uint32_t Version = 5;
+		// Dimensioni della finestra al momento della cattura: il replay crea un target delle stesse dimensioni.
+		uint32_t Width = 0, Height = 0;
+		// Frame completi nel file, scritto alla chiusura.
+		uint32_t FrameCount = 0;
+	};
+
+	// Registra su file ogni comando del renderer (RenderCommand, bind, upload e creazione delle risorse con i relativi dati)
+	// per un numero fissato di frame, così una scena lenta può essere rieseguita senza i contenuti originali.
+	//
+	// Begin() va chiamato prima di Renderer::Init, perché le risorse create prima non sarebbero nel file:
+	// da quel momento le factory restituiscono oggetti che registrano ogni chiamata e la inoltrano al backend,
+	// e RenderCommand passa da un RendererAPI che fa lo stesso. L'UI di ImGui, che usa direttamente OpenGL, non viene catturata.
+	class RenderCapture
+	{
+	public:
+		static bool Begin(const std::string& path, uint32_t frameCount, uint32_t width, uint32_t height);
+		static void End();
+		// Da chiamare alla fine di ogni frame: dopo frameCount frame la cattura si chiude da sola.
+		static void EndFrame();
+
+		static bool IsRecording();
+
+		// Usati dalle factory: se la cattura è attiva registrano la creazione e restituiscono un oggetto che
+		// registra le chiamate successive, altrimenti restituiscono l'oggetto così com'è.
+		static VertexBuffer* Capture(VertexBuffer* vertexBuffer, const void* vertices, uint32_t size);
+		static IndexBuffer* Capture(IndexBuffer* indexBuffer, const uint32_t* indices, uint32_t count);
+		static VertexArray* Capture(VertexArray* vertexArray);
+		static Shader* Capture(Shader* shader, const std::string& vertexSrc, const std::string& fragmentSrc);
+		static Shader* Capture(Shader* shader, const std::string& computeSrc);
+		static Texture2D* Capture(Texture2D* texture);
+		static TextureArray* Capture(TextureArray* textureArray);
+		static UniformBuffer* Capture(UniformBuffer* uniformBuffer, uint32_t size, uint32_t binding);
+		static StorageBuffer* Capture(StorageBuffer* storageBuffer, uint32_t size, uint32_t binding);
+		static Framebuffer* Capture(Framebuffer* framebuffer);
+	};
+
+	// Lettura sequenziale di un file di cattura, caricato interamente in memoria.
+	// I blob restituiti puntano dentro al buffer del reader e restano validi finché il reader esiste.
+	class RenderCaptureReader
+	{
+	public:
+		RenderCaptureReader(const std::string& path);
+
+		inline bool IsValid() const { return m_Valid; }
+		inline const RenderCaptureHeader& GetHeader() const { return m_Header; }
+
+		// false a fine file. Dopo Next() il payload va letto per intero, nell'ordine documentato in RenderCaptureOp.
+		bool Next(RenderCaptureOp& op);
+		// Torna al primo record dopo l'header.
+		void Rewind();
+
+		uint8_t ReadU8();
+		uint32_t ReadU32();
+		float ReadFloat();
+		const uint8_t* ReadBytes(uint32_t size);
+		const uint8_t* ReadBlob(uint32_t& size);
+		std::string ReadString();
+
+		// true se una lettura ha superato la fine del file (file troncato o corrotto).
+		inline bool HasError() const { return m_Error; }
+
+	private:
+		std::vector<uint8_t> m_Data;
+		RenderCaptureHeader m_Header;
+		size_t m_Position = 0;
+		bool m_Valid = false;
+		bool m_Error = false;
+	};
+
+}
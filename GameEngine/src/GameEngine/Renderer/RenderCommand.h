@@ -7,6 +7,16 @@ namespace GameEngine {
 	class RenderCommand
 	{
 	public:
+		inline static void Init()
+		{
+			s_RendererAPI->Init();
+		}
+
+		inline static void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+		{
+			s_RendererAPI->SetViewport(x, y, width, height);
+		}
+
 		inline static void SetClearColor(const glm::vec4& color)
 		{
 			s_RendererAPI->SetClearColor(color);
@@ -17,9 +27,33 @@ namespace GameEngine {
 			s_RendererAPI->Clear();
 		}
 
-		inline static void DrawIndexed(const Ref<VertexArray>& vertexArray)
+		inline static void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0)
+		{
+			s_RendererAPI->DrawIndexed(vertexArray, indexCount);
+		}
+
+		inline static void DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t instanceCount, uint32_t indexCount = 0)
+		{
+			s_RendererAPI->DrawIndexedInstanced(vertexArray, instanceCount, indexCount);
+		}
+
+		inline static void DrawIndexedIndirect(const Ref<VertexArray>& vertexArray, const Ref<StorageBuffer>& commands, uint32_t drawCount, uint32_t offset = 0)
+		{
+			s_RendererAPI->DrawIndexedIndirect(vertexArray, commands, drawCount, offset);
+		}
+
+		inline static void DispatchCompute(uint32_t groupsX, uint32_t groupsY = 1, uint32_t groupsZ = 1)
+		{
+			s_RendererAPI->DispatchCompute(groupsX, groupsY, groupsZ);
+		}
+
+		// Sostituisce il backend (ad es. con uno che non disegna nulla nei benchmark).
+		// Non prende possesso del puntatore: restituisce il backend precedente, da ripristinare dopo l'uso.
+		inline static RendererAPI* SetRendererAPI(RendererAPI* rendererAPI)
 		{
-			s_RendererAPI->DrawIndexed(vertexArray);
+			RendererAPI* previous = s_RendererAPI;
+			s_RendererAPI = rendererAPI;
+			return previous;
 		}
 
 	private:
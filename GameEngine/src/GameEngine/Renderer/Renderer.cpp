@@ -1,29 +1,111 @@
 #include "hzpch.h"
 #include "Renderer.h"
 
-#include "Platform/OpenGL/OpenGLShader.h"
+#include "Renderer2D.h"
 
 namespace GameEngine {
 
 	Renderer::SceneData* Renderer::m_SceneData = new Renderer::SceneData();
+	thread_local Renderer::Statistics Renderer::s_Stats;
 
-	void Renderer::BeginScene(OrthographicCamera& camera)
+	// Layout std140: mat4 e vec4 sono già allineati a 16 byte, quindi la struct C++ coincide con il blocco GLSL.
+	struct ViewData
 	{
-		m_SceneData->ProjectionViewMatrix = camera.GetProjectionViewMatrix();
+		glm::mat4 ProjectionView;
+		glm::mat4 View;
+		glm::mat4 Projection;
+		glm::vec4 CameraPosition;
+	};
+
+	void Renderer::Init()
+	{
+		RenderCommand::Init();
+
+		m_SceneData->ViewUniformBuffer.reset(UniformBuffer::Create(sizeof(ViewData), ViewDataBinding));
+
+		Renderer2D::Init();
+	}
+
+	void Renderer::Shutdown()
+	{
+		Renderer2D::Shutdown();
+
+		m_SceneData->ViewUniformBuffer.reset();
+		m_SceneData->MaterialDrawCommands.clear();
+	}
+
+	void Renderer::ResetStats()
+	{
+		s_Stats = Statistics();
+	}
+
+	void Renderer::BeginScene(const Camera& camera)
+	{
+		ViewData data;
+		data.ProjectionView = camera.GetProjectionViewMatrix();
+		data.View = camera.GetViewMatrix();
+		data.Projection = camera.GetProjectionMatrix();
+		data.CameraPosition = glm::vec4(camera.GetPosition(), 1.0f);
+		m_SceneData->ViewUniformBuffer->SetData(&data, sizeof(ViewData));
 	}
 
 	void Renderer::EndScene()
 	{
+		auto& commands = m_SceneData->MaterialDrawCommands;
+		if (commands.empty())
+			return;
+
+		// stable_sort: le draw della stessa istanza restano nell'ordine di invio.
+		std::stable_sort(commands.begin(), commands.end(), [](const MaterialDrawCommand& a, const MaterialDrawCommand& b)
+		{
+			return a.SortKey < b.SortKey;
+		});
+
+		// Materiali diversi possono usare lo stesso shader: ogni bind viene fatto solo quando l'oggetto cambia.
+		const Shader* boundShader = nullptr;
+		const MaterialInstance* boundMaterial = nullptr;
+		const VertexArray* boundVertexArray = nullptr;
+		for (const auto& command : commands)
+		{
+			const Ref<Shader>& shader = command.Material->GetMaterial()->GetShader();
+			if (shader.get() != boundShader)
+			{
+				shader->Bind();
+				boundShader = shader.get();
+			}
+
+			if (command.Material.get() != boundMaterial)
+			{
+				command.Material->Bind();
+				boundMaterial = command.Material.get();
+			}
+
+			if (command.Mesh.get() != boundVertexArray)
+			{
+				command.Mesh->Bind();
+				boundVertexArray = command.Mesh.get();
+			}
+
+			shader->SetMat4("u_Transform", command.Transform);
+			RenderCommand::DrawIndexed(command.Mesh);
+		}
+
+		commands.clear();
 	}
 
 	void Renderer::Submit(const Ref<Shader> shader, const Ref<VertexArray>& vertexArray, const glm::mat4& transform)
 	{
 		shader->Bind();
-		std::dynamic_pointer_cast<OpenGLShader>(shader)->UploadUniformMat4("u_ProjectionView", m_SceneData->ProjectionViewMatrix);
-		std::dynamic_pointer_cast<OpenGLShader>(shader)->UploadUniformMat4("u_Transform", transform);
+		shader->SetMat4("u_Transform", transform);
 
 		vertexArray->Bind();
 		RenderCommand::DrawIndexed(vertexArray);
 	}
 
+	void Renderer::Submit(const Ref<MaterialInstance>& material, const Ref<VertexArray>& vertexArray, const glm::mat4& transform)
+	{
+		uint64_t sortKey = ((uint64_t)material->GetMaterial()->GetID() << 32) | material->GetID();
+		m_SceneData->MaterialDrawCommands.push_back({ sortKey, material, vertexArray, transform });
+	}
+
 }
\ No newline at end of file
@@ -1,27 +1,72 @@
 #pragma once
 
 #include "RenderCommand.h"
-#include "OrthographicCamera.h"
+#include "Camera.h"
 #include "Shader.h"
+#include "UniformBuffer.h"
+#include "Material.h"
 
 namespace GameEngine {
 
 	class Renderer
 	{
 	public:
-		static void BeginScene(OrthographicCamera& camera);
+		static void Init();
+		static void Shutdown();
+
+		// Scrive i dati della camera nell'uniform buffer ViewData (binding ViewDataBinding), una sola volta per scena.
+		// Per pi viste nello stesso frame (split-screen, minimappa) basta impostare il viewport e chiamare di nuovo BeginScene.
+		static void BeginScene(const Camera& camera);
+		// Esegue le draw inviate con un materiale, raggruppate per materiale e istanza.
 		static void EndScene();
 		// Di default, passiamo come transform la matrice di identit, perch non  detto che vogliamo sempre inviare una trasformazione.
 		static void Submit(const Ref<Shader> shader, const Ref<VertexArray>& vertexArray, const glm::mat4& transform = glm::mat4(1.0f));
+		// La draw viene accodata ed eseguita in EndScene: ogni shader e ogni blocco di parametri vengono collegati
+		// una sola volta per gruppo, qualunque sia l'ordine di invio.
+		static void Submit(const Ref<MaterialInstance>& material, const Ref<VertexArray>& vertexArray, const glm::mat4& transform = glm::mat4(1.0f));
 
 		inline static RendererAPI::API GetAPI() { return RendererAPI::GetAPI(); }
 
+		// Gli shader dichiarano il blocco cos:
+		// layout(std140, binding = 0) uniform ViewData { mat4 u_ProjectionView; mat4 u_View; mat4 u_Projection; vec4 u_CameraPosition; };
+		static const uint32_t ViewDataBinding = 0;
+		// Binding del blocco MaterialData con i parametri della MaterialInstance corrente.
+		static const uint32_t MaterialDataBinding = 1;
+
+		// Contatori del frame corrente, aggiornati dal backend. Application li azzera all'inizio di ogni frame.
+		// Sono per thread: gli upload del ResourceLoader non si mescolano a quelli del frame.
+		struct Statistics
+		{
+			uint32_t DrawCalls = 0;
+			uint32_t ComputeDispatches = 0;
+			uint32_t Indices = 0;
+			uint32_t Vertices = 0;
+			// Bind di shader, vertex array, texture e framebuffer, cambi di viewport.
+			uint32_t StateChanges = 0;
+			uint32_t ShaderBinds = 0;
+			// Dati inviati ai buffer GPU (vertex, index, uniform) e alle texture.
+			uint64_t BufferBytesUploaded = 0;
+		};
+		inline static Statistics& GetStats() { return s_Stats; }
+		static void ResetStats();
+
 	private:
+		struct MaterialDrawCommand
+		{
+			// ID del Material nei 32 bit alti e della MaterialInstance in quelli bassi.
+			uint64_t SortKey;
+			Ref<MaterialInstance> Material;
+			Ref<VertexArray> Mesh;
+			glm::mat4 Transform;
+		};
+
 		struct SceneData
 		{
-			glm::mat4 ProjectionViewMatrix;
+			Ref<UniformBuffer> ViewUniformBuffer;
+			std::vector<MaterialDrawCommand> MaterialDrawCommands;
 		};
 
 		static SceneData* m_SceneData;
+		static thread_local Statistics s_Stats;
 	};
 }
\ No newline at end of file
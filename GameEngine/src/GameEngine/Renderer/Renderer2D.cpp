@@ -0,0 +1,633 @@
+#include "hzpch.h"
+#include "Renderer2D.h"
+
+#include "Renderer.h"
+#include "VertexArray.h"
+#include "Shader.h"
+#include "RenderCommand.h"
+#include "VertexPacking.h"
+
+namespace GameEngine {
+
+	// 24 byte per vertice: colore e UV usano formati normalizzati a 8/16 bit invece di float.
+	struct QuadVertex
+	{
+		glm::vec3 Position;
+		uint32_t Color;		// UByte4N
+		uint32_t TexCoord;	// UShort2N
+		int32_t TexIndex;
+	};
+
+	struct Renderer2DData
+	{
+		static const uint32_t MaxQuads = 10000;
+		static const uint32_t MaxVertices = MaxQuads * 4;
+		static const uint32_t MaxIndices = MaxQuads * 6;
+		// 16 è il minimo garantito da OpenGL per le texture unit del fragment shader.
+		static const uint32_t MaxTextureSlots = 16;
+
+		Ref<VertexArray> QuadVertexArray;
+		Ref<VertexBuffer> QuadVertexBuffer;
+		Ref<Shader> TextureShader;
+		Ref<Texture2D> WhiteTexture;
+
+		uint32_t QuadIndexCount = 0;
+		QuadVertex* QuadVertexBufferBase = nullptr;
+		QuadVertex* QuadVertexBufferPtr = nullptr;
+
+		// Lo slot 0 è sempre la texture bianca, usata dai quad a tinta unita.
+		std::array<Ref<Texture2D>, MaxTextureSlots> TextureSlots;
+		uint32_t TextureSlotIndex = 1;
+
+		// Quad unitario condiviso da tutte le particelle + buffer per-istanza riscritto ogni frame.
+		Ref<VertexArray> ParticleVertexArray;
+		Ref<VertexBuffer> ParticleQuadBuffer;
+		Ref<IndexBuffer> ParticleIndexBuffer;
+		Ref<VertexBuffer> ParticleInstanceBuffer;
+		Ref<Shader> ParticleShader;
+		uint32_t ParticleCapacity = 0;
+
+		// Batch dei glifi: stesso formato dei vertici e stesso index buffer dei quad, shader SDF.
+		Ref<VertexArray> TextVertexArray;
+		Ref<VertexBuffer> TextVertexBuffer;
+		Ref<Shader> TextShader;
+
+		uint32_t TextIndexCount = 0;
+		QuadVertex* TextVertexBufferBase = nullptr;
+		QuadVertex* TextVertexBufferPtr = nullptr;
+
+		// Pagine dei font usate nel batch e font a cui appartengono, per caricare i glifi nuovi prima della draw call.
+		std::array<Ref<Texture2D>, MaxTextureSlots> TextTextureSlots;
+		uint32_t TextTextureSlotIndex = 0;
+		std::vector<Ref<Font>> TextFonts;
+
+		Renderer2D::Statistics Stats;
+	};
+
+	static Renderer2DData* s_Data = nullptr;
+
+	void Renderer2D::Init()
+	{
+		s_Data = new Renderer2DData();
+
+		s_Data->QuadVertexArray.reset(VertexArray::Create());
+
+		s_Data->QuadVertexBuffer.reset(VertexBuffer::Create(Renderer2DData::MaxVertices * sizeof(QuadVertex)));
+		s_Data->QuadVertexBuffer->SetLayout({
+			{ ShaderDataType::Float3, "a_Position" },
+			{ ShaderDataType::UByte4N,  "a_Color" },
+			{ ShaderDataType::UShort2N, "a_TexCoord" },
+			{ ShaderDataType::Int,      "a_TexIndex" }
+		});
+		s_Data->QuadVertexArray->AddVertexBuffer(s_Data->QuadVertexBuffer);
+
+		s_Data->QuadVertexBufferBase = new QuadVertex[Renderer2DData::MaxVertices];
+
+		// Gli indici dei quad seguono sempre lo stesso schema: li generiamo una volta sola.
+		uint32_t* quadIndices = new uint32_t[Renderer2DData::MaxIndices];
+		uint32_t offset = 0;
+		for (uint32_t i = 0; i < Renderer2DData::MaxIndices; i += 6)
+		{
+			quadIndices[i + 0] = offset + 0;
+			quadIndices[i + 1] = offset + 1;
+			quadIndices[i + 2] = offset + 2;
+
+			quadIndices[i + 3] = offset + 2;
+			quadIndices[i + 4] = offset + 3;
+			quadIndices[i + 5] = offset + 0;
+
+			offset += 4;
+		}
+
+		Ref<IndexBuffer> quadIB;
+		quadIB.reset(IndexBuffer::Create(quadIndices, Renderer2DData::MaxIndices));
+		s_Data->QuadVertexArray->SetIndexBuffer(quadIB);
+		delete[] quadIndices;
+
+		s_Data->TextVertexArray.reset(VertexArray::Create());
+		s_Data->TextVertexBuffer.reset(VertexBuffer::Create(Renderer2DData::MaxVertices * sizeof(QuadVertex)));
+		s_Data->TextVertexBuffer->SetLayout(s_Data->QuadVertexBuffer->GetLayout());
+		s_Data->TextVertexArray->AddVertexBuffer(s_Data->TextVertexBuffer);
+		s_Data->TextVertexArray->SetIndexBuffer(quadIB);
+		s_Data->TextVertexBufferBase = new QuadVertex[Renderer2DData::MaxVertices];
+
+		s_Data->WhiteTexture.reset(Texture2D::Create(1, 1));
+		uint32_t whiteTextureData = 0xffffffff;
+		s_Data->WhiteTexture->SetData(&whiteTextureData, sizeof(uint32_t));
+		s_Data->TextureSlots[0] = s_Data->WhiteTexture;
+
+		std::string vertexSrc = R"(
+			#version 450 core
+
+			layout(location = 0) in vec3 a_Position;
+			layout(location = 1) in vec4 a_Color;
+			layout(location = 2) in vec2 a_TexCoord;
+			layout(location = 3) in int a_TexIndex;
+
+			layout(std140, binding = 0) uniform ViewData
+			{
+				mat4 u_ProjectionView;
+				mat4 u_View;
+				mat4 u_Projection;
+				vec4 u_CameraPosition;
+			};
+
+			out vec4 v_Color;
+			out vec2 v_TexCoord;
+			flat out int v_TexIndex;
+
+			void main()
+			{
+				v_Color = a_Color;
+				v_TexCoord = a_TexCoord;
+				v_TexIndex = a_TexIndex;
+				gl_Position = u_ProjectionView * vec4(a_Position, 1.0);
+			}
+		)";
+
+		std::string fragmentSrc = R"(
+			#version 450 core
+
+			layout(location = 0) out vec4 color;
+
+			in vec4 v_Color;
+			in vec2 v_TexCoord;
+			flat in int v_TexIndex;
+
+			uniform sampler2D u_Textures[16];
+
+			// Un batch mescola quad con texture diverse: v_TexIndex non è dinamicamente uniforme
+			// e non può indicizzare l'array di sampler, quindi ogni caso usa un indice costante.
+			// L'indice è costante all'interno di un quad, quindi le derivate per il mipmapping restano valide.
+			vec4 SampleTexture(vec2 uv)
+			{
+				switch (v_TexIndex)
+				{
+					case 0: return texture(u_Textures[0], uv);
+					case 1: return texture(u_Textures[1], uv);
+					case 2: return texture(u_Textures[2], uv);
+					case 3: return texture(u_Textures[3], uv);
+					case 4: return texture(u_Textures[4], uv);
+					case 5: return texture(u_Textures[5], uv);
+					case 6: return texture(u_Textures[6], uv);
+					case 7: return texture(u_Textures[7], uv);
+					case 8: return texture(u_Textures[8], uv);
+					case 9: return texture(u_Textures[9], uv);
+					case 10: return texture(u_Textures[10], uv);
+					case 11: return texture(u_Textures[11], uv);
+					case 12: return texture(u_Textures[12], uv);
+					case 13: return texture(u_Textures[13], uv);
+					case 14: return texture(u_Textures[14], uv);
+					default: return texture(u_Textures[15], uv);
+				}
+			}
+
+			void main()
+			{
+				color = SampleTexture(v_TexCoord) * v_Color;
+			}
+		)";
+
+		s_Data->TextureShader.reset(Shader::Create(vertexSrc, fragmentSrc));
+
+		int32_t samplers[Renderer2DData::MaxTextureSlots];
+		for (uint32_t i = 0; i < Renderer2DData::MaxTextureSlots; i++)
+			samplers[i] = i;
+
+		s_Data->TextureShader->Bind();
+		s_Data->TextureShader->SetIntArray("u_Textures", samplers, Renderer2DData::MaxTextureSlots);
+
+		#pragma region Testo
+		// Le texture usano GL_NEAREST in ingrandimento: l'interpolazione bilineare della distanza, che rende
+		// il bordo liscio a qualunque scala, viene fatta a mano. fwidth() dà la larghezza di un pixel
+		// dello schermo in unità di distanza, quindi l'antialiasing resta di circa un pixel.
+		std::string textFragmentSrc = R"(
+			#version 450 core
+
+			layout(location = 0) out vec4 color;
+
+			in vec4 v_Color;
+			in vec2 v_TexCoord;
+			flat in int v_TexIndex;
+
+			uniform sampler2D u_Textures[16];
+
+			// Come per i quad, v_TexIndex non è dinamicamente uniforme: la pagina si sceglie con indici costanti.
+			ivec2 PageSize()
+			{
+				switch (v_TexIndex)
+				{
+					case 0: return textureSize(u_Textures[0], 0);
+					case 1: return textureSize(u_Textures[1], 0);
+					case 2: return textureSize(u_Textures[2], 0);
+					case 3: return textureSize(u_Textures[3], 0);
+					case 4: return textureSize(u_Textures[4], 0);
+					case 5: return textureSize(u_Textures[5], 0);
+					case 6: return textureSize(u_Textures[6], 0);
+					case 7: return textureSize(u_Textures[7], 0);
+					case 8: return textureSize(u_Textures[8], 0);
+					case 9: return textureSize(u_Textures[9], 0);
+					case 10: return textureSize(u_Textures[10], 0);
+					case 11: return textureSize(u_Textures[11], 0);
+					case 12: return textureSize(u_Textures[12], 0);
+					case 13: return textureSize(u_Textures[13], 0);
+					case 14: return textureSize(u_Textures[14], 0);
+					default: return textureSize(u_Textures[15], 0);
+				}
+			}
+
+			float FetchDistance(ivec2 texel)
+			{
+				switch (v_TexIndex)
+				{
+					case 0: return texelFetch(u_Textures[0], texel, 0).a;
+					case 1: return texelFetch(u_Textures[1], texel, 0).a;
+					case 2: return texelFetch(u_Textures[2], texel, 0).a;
+					case 3: return texelFetch(u_Textures[3], texel, 0).a;
+					case 4: return texelFetch(u_Textures[4], texel, 0).a;
+					case 5: return texelFetch(u_Textures[5], texel, 0).a;
+					case 6: return texelFetch(u_Textures[6], texel, 0).a;
+					case 7: return texelFetch(u_Textures[7], texel, 0).a;
+					case 8: return texelFetch(u_Textures[8], texel, 0).a;
+					case 9: return texelFetch(u_Textures[9], texel, 0).a;
+					case 10: return texelFetch(u_Textures[10], texel, 0).a;
+					case 11: return texelFetch(u_Textures[11], texel, 0).a;
+					case 12: return texelFetch(u_Textures[12], texel, 0).a;
+					case 13: return texelFetch(u_Textures[13], texel, 0).a;
+					case 14: return texelFetch(u_Textures[14], texel, 0).a;
+					default: return texelFetch(u_Textures[15], texel, 0).a;
+				}
+			}
+
+			float SampleDistance(vec2 uv)
+			{
+				ivec2 size = PageSize();
+				vec2 position = uv * vec2(size) - 0.5;
+				ivec2 texel = ivec2(floor(position));
+				vec2 f = position - floor(position);
+
+				ivec2 last = size - 1;
+				float d00 = FetchDistance(clamp(texel, ivec2(0), last));
+				float d10 = FetchDistance(clamp(texel + ivec2(1, 0), ivec2(0), last));
+				float d01 = FetchDistance(clamp(texel + ivec2(0, 1), ivec2(0), last));
+				float d11 = FetchDistance(clamp(texel + ivec2(1, 1), ivec2(0), last));
+				return mix(mix(d00, d10, f.x), mix(d01, d11, f.x), f.y);
+			}
+
+			void main()
+			{
+				float distance = SampleDistance(v_TexCoord);
+				float width = max(fwidth(distance), 0.0001);
+				float alpha = smoothstep(0.5 - width, 0.5 + width, distance);
+				if (alpha <= 0.0)
+					discard;
+
+				color = vec4(v_Color.rgb, v_Color.a * alpha);
+			}
+		)";
+
+		s_Data->TextShader.reset(Shader::Create(vertexSrc, textFragmentSrc));
+		s_Data->TextShader->Bind();
+		s_Data->TextShader->SetIntArray("u_Textures", samplers, Renderer2DData::MaxTextureSlots);
+		#pragma endregion
+
+		#pragma region Particelle
+		float particleQuad[4 * 2] = {
+			-0.5f, -0.5f,
+			 0.5f, -0.5f,
+			 0.5f,  0.5f,
+			-0.5f,  0.5f
+		};
+		s_Data->ParticleQuadBuffer.reset(VertexBuffer::Create(particleQuad, sizeof(particleQuad)));
+		s_Data->ParticleQuadBuffer->SetLayout({
+			{ ShaderDataType::Float2, "a_Corner" }
+		});
+
+		uint32_t particleIndices[6] = { 0, 1, 2, 2, 3, 0 };
+		s_Data->ParticleIndexBuffer.reset(IndexBuffer::Create(particleIndices, 6));
+
+		std::string particleVertexSrc = R"(
+			#version 450 core
+
+			layout(location = 0) in vec2 a_Corner;
+			layout(location = 1) in vec2 a_Position;
+			layout(location = 2) in float a_Size;
+			layout(location = 3) in vec4 a_Color;
+
+			layout(std140, binding = 0) uniform ViewData
+			{
+				mat4 u_ProjectionView;
+				mat4 u_View;
+				mat4 u_Projection;
+				vec4 u_CameraPosition;
+			};
+
+			out vec4 v_Color;
+
+			void main()
+			{
+				v_Color = a_Color;
+				gl_Position = u_ProjectionView * vec4(a_Position + a_Corner * a_Size, 0.0, 1.0);
+			}
+		)";
+
+		std::string particleFragmentSrc = R"(
+			#version 450 core
+
+			layout(location = 0) out vec4 color;
+
+			in vec4 v_Color;
+
+			void main()
+			{
+				color = v_Color;
+			}
+		)";
+
+		s_Data->ParticleShader.reset(Shader::Create(particleVertexSrc, particleFragmentSrc));
+		#pragma endregion
+	}
+
+	void Renderer2D::Shutdown()
+	{
+		delete[] s_Data->QuadVertexBufferBase;
+		delete[] s_Data->TextVertexBufferBase;
+		delete s_Data;
+		s_Data = nullptr;
+	}
+
+	void Renderer2D::BeginScene(const Camera& camera)
+	{
+		Renderer::BeginScene(camera);
+
+		StartBatch();
+	}
+
+	void Renderer2D::EndScene()
+	{
+		Flush();
+	}
+
+	void Renderer2D::StartBatch()
+	{
+		s_Data->QuadIndexCount = 0;
+		s_Data->QuadVertexBufferPtr = s_Data->QuadVertexBufferBase;
+		s_Data->TextureSlotIndex = 1;
+
+		s_Data->TextIndexCount = 0;
+		s_Data->TextVertexBufferPtr = s_Data->TextVertexBufferBase;
+		s_Data->TextTextureSlotIndex = 0;
+		s_Data->TextFonts.clear();
+	}
+
+	void Renderer2D::Flush()
+	{
+		FlushQuads();
+		FlushText();
+	}
+
+	void Renderer2D::FlushQuads()
+	{
+		if (s_Data->QuadIndexCount == 0)
+			return;
+
+		uint32_t dataSize = (uint32_t)((uint8_t*)s_Data->QuadVertexBufferPtr - (uint8_t*)s_Data->QuadVertexBufferBase);
+		s_Data->QuadVertexBuffer->SetData(s_Data->QuadVertexBufferBase, dataSize);
+
+		for (uint32_t i = 0; i < s_Data->TextureSlotIndex; i++)
+			s_Data->TextureSlots[i]->Bind(i);
+
+		s_Data->TextureShader->Bind();
+		s_Data->QuadVertexArray->Bind();
+		RenderCommand::DrawIndexed(s_Data->QuadVertexArray, s_Data->QuadIndexCount);
+		s_Data->Stats.DrawCalls++;
+	}
+
+	void Renderer2D::FlushText()
+	{
+		if (s_Data->TextIndexCount == 0)
+			return;
+
+		// I glifi generati durante il frame vengono caricati qui, una volta per pagina.
+		for (const Ref<Font>& font : s_Data->TextFonts)
+			font->UploadPages();
+
+		uint32_t dataSize = (uint32_t)((uint8_t*)s_Data->TextVertexBufferPtr - (uint8_t*)s_Data->TextVertexBufferBase);
+		s_Data->TextVertexBuffer->SetData(s_Data->TextVertexBufferBase, dataSize);
+
+		for (uint32_t i = 0; i < s_Data->TextTextureSlotIndex; i++)
+			s_Data->TextTextureSlots[i]->Bind(i);
+
+		s_Data->TextShader->Bind();
+		s_Data->TextVertexArray->Bind();
+		RenderCommand::DrawIndexed(s_Data->TextVertexArray, s_Data->TextIndexCount);
+		s_Data->Stats.DrawCalls++;
+	}
+
+	void Renderer2D::NextBatch()
+	{
+		Flush();
+		StartBatch();
+	}
+
+	void Renderer2D::SubmitQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec2& uvMin, const glm::vec2& uvMax,
+		const Ref<Texture2D>& texture, const glm::vec4& color)
+	{
+		if (s_Data->QuadIndexCount >= Renderer2DData::MaxIndices)
+			NextBatch();
+
+		// Cerchiamo la texture tra quelle già presenti nel batch: con un atlas sono poche pagine,
+		// quindi la ricerca lineare è più veloce di una mappa.
+		int32_t textureIndex = 0;
+		for (uint32_t i = 0; i < s_Data->TextureSlotIndex; i++)
+		{
+			if (s_Data->TextureSlots[i].get() == texture.get())
+			{
+				textureIndex = (int32_t)i;
+				break;
+			}
+		}
+
+		if (textureIndex == 0 && texture != s_Data->WhiteTexture)
+		{
+			if (s_Data->TextureSlotIndex >= Renderer2DData::MaxTextureSlots)
+				NextBatch();
+
+			textureIndex = (int32_t)s_Data->TextureSlotIndex;
+			s_Data->TextureSlots[s_Data->TextureSlotIndex] = texture;
+			s_Data->TextureSlotIndex++;
+		}
+
+		const glm::vec2 half = size * 0.5f;
+		const glm::vec3 corners[4] = {
+			{ position.x - half.x, position.y - half.y, position.z },
+			{ position.x + half.x, position.y - half.y, position.z },
+			{ position.x + half.x, position.y + half.y, position.z },
+			{ position.x - half.x, position.y + half.y, position.z }
+		};
+		const uint32_t texCoords[4] = {
+			VertexPacking::PackUShort2N({ uvMin.x, uvMin.y }),
+			VertexPacking::PackUShort2N({ uvMax.x, uvMin.y }),
+			VertexPacking::PackUShort2N({ uvMax.x, uvMax.y }),
+			VertexPacking::PackUShort2N({ uvMin.x, uvMax.y })
+		};
+		const uint32_t packedColor = VertexPacking::PackUByte4N(color);
+
+		for (uint32_t i = 0; i < 4; i++)
+		{
+			s_Data->QuadVertexBufferPtr->Position = corners[i];
+			s_Data->QuadVertexBufferPtr->Color = packedColor;
+			s_Data->QuadVertexBufferPtr->TexCoord = texCoords[i];
+			s_Data->QuadVertexBufferPtr->TexIndex = textureIndex;
+			s_Data->QuadVertexBufferPtr++;
+		}
+
+		s_Data->QuadIndexCount += 6;
+		s_Data->Stats.QuadCount++;
+	}
+
+	void Renderer2D::DrawQuad(const glm::vec2& position, const glm::vec2& size, const glm::vec4& color)
+	{
+		DrawQuad({ position.x, position.y, 0.0f }, size, color);
+	}
+
+	void Renderer2D::DrawQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec4& color)
+	{
+		SubmitQuad(position, size, { 0.0f, 0.0f }, { 1.0f, 1.0f }, s_Data->WhiteTexture, color);
+	}
+
+	void Renderer2D::DrawSprite(const glm::vec2& position, const glm::vec2& size, const SpriteRegion& region, const glm::vec4& tint)
+	{
+		DrawSprite({ position.x, position.y, 0.0f }, size, region, tint);
+	}
+
+	void Renderer2D::DrawSprite(const glm::vec3& position, const glm::vec2& size, const SpriteRegion& region, const glm::vec4& tint)
+	{
+		HZ_CORE_ASSERT(region.Texture, "Sprite region has no texture!");
+		SubmitQuad(position, size, region.UVMin, region.UVMax, region.Texture, tint);
+	}
+
+	void Renderer2D::DrawString(const std::string& text, const Ref<Font>& font, const glm::vec2& position, float size, const glm::vec4& color)
+	{
+		DrawString(text, font, { position.x, position.y, 0.0f }, size, color);
+	}
+
+	void Renderer2D::DrawString(const std::string& text, const Ref<Font>& font, const glm::vec3& position, float size, const glm::vec4& color)
+	{
+		HZ_CORE_ASSERT(font, "DrawString needs a font!");
+
+		const TextLayout& layout = font->GetLayout(text);
+		const uint32_t packedColor = VertexPacking::PackUByte4N(color);
+
+		for (const TextLayout::Quad& quad : layout.Quads)
+		{
+			if (s_Data->TextIndexCount >= Renderer2DData::MaxIndices)
+				NextBatch();
+
+			const Ref<Texture2D>& page = font->GetPageTexture(quad.Page);
+			int32_t textureIndex = -1;
+			for (uint32_t i = 0; i < s_Data->TextTextureSlotIndex; i++)
+			{
+				if (s_Data->TextTextureSlots[i].get() == page.get())
+				{
+					textureIndex = (int32_t)i;
+					break;
+				}
+			}
+
+			if (textureIndex < 0)
+			{
+				if (s_Data->TextTextureSlotIndex >= Renderer2DData::MaxTextureSlots)
+					NextBatch();
+
+				// Una pagina nuova nel batch è l'unico momento in cui può comparire un font nuovo.
+				if (std::find(s_Data->TextFonts.begin(), s_Data->TextFonts.end(), font) == s_Data->TextFonts.end())
+					s_Data->TextFonts.push_back(font);
+
+				textureIndex = (int32_t)s_Data->TextTextureSlotIndex;
+				s_Data->TextTextureSlots[s_Data->TextTextureSlotIndex] = page;
+				s_Data->TextTextureSlotIndex++;
+			}
+
+			const glm::vec2 min = quad.PlaneMin * size;
+			const glm::vec2 max = quad.PlaneMax * size;
+			const glm::vec3 corners[4] = {
+				{ position.x + min.x, position.y + min.y, position.z },
+				{ position.x + max.x, position.y + min.y, position.z },
+				{ position.x + max.x, position.y + max.y, position.z },
+				{ position.x + min.x, position.y + max.y, position.z }
+			};
+			const uint32_t texCoords[4] = {
+				VertexPacking::PackUShort2N({ quad.UVMin.x, quad.UVMin.y }),
+				VertexPacking::PackUShort2N({ quad.UVMax.x, quad.UVMin.y }),
+				VertexPacking::PackUShort2N({ quad.UVMax.x, quad.UVMax.y }),
+				VertexPacking::PackUShort2N({ quad.UVMin.x, quad.UVMax.y })
+			};
+
+			for (uint32_t i = 0; i < 4; i++)
+			{
+				s_Data->TextVertexBufferPtr->Position = corners[i];
+				s_Data->TextVertexBufferPtr->Color = packedColor;
+				s_Data->TextVertexBufferPtr->TexCoord = texCoords[i];
+				s_Data->TextVertexBufferPtr->TexIndex = textureIndex;
+				s_Data->TextVertexBufferPtr++;
+			}
+
+			s_Data->TextIndexCount += 6;
+			s_Data->Stats.GlyphCount++;
+		}
+	}
+
+	void Renderer2D::CreateParticleBuffers(uint32_t capacity)
+	{
+		// Gli attributi di un vertex array puntano al buffer con cui sono stati configurati:
+		// se il buffer delle istanze cresce va ricreato anche il vertex array.
+		s_Data->ParticleInstanceBuffer.reset(VertexBuffer::Create(capacity * (uint32_t)sizeof(ParticleInstance)));
+		s_Data->ParticleInstanceBuffer->SetLayout({
+			{ ShaderDataType::Float2,  "a_Position" },
+			{ ShaderDataType::Float,   "a_Size" },
+			{ ShaderDataType::UByte4N, "a_Color" }
+		});
+
+		s_Data->ParticleVertexArray.reset(VertexArray::Create());
+		s_Data->ParticleVertexArray->AddVertexBuffer(s_Data->ParticleQuadBuffer);
+		s_Data->ParticleVertexArray->AddVertexBuffer(s_Data->ParticleInstanceBuffer, 1);
+		s_Data->ParticleVertexArray->SetIndexBuffer(s_Data->ParticleIndexBuffer);
+		s_Data->ParticleCapacity = capacity;
+	}
+
+	void Renderer2D::DrawParticles(const ParticleEmitter& emitter)
+	{
+		uint32_t count = emitter.GetAliveCount();
+		if (count == 0)
+			return;
+
+		NextBatch();
+
+		if (count > s_Data->ParticleCapacity)
+			CreateParticleBuffers(std::max(emitter.GetMaxParticles(), count));
+
+		// Le istanze vengono scritte direttamente nella memoria del buffer, senza copie intermedie.
+		ParticleInstance* instances = (ParticleInstance*)s_Data->ParticleInstanceBuffer->Map(count * (uint32_t)sizeof(ParticleInstance));
+		emitter.WriteInstances(instances);
+		s_Data->ParticleInstanceBuffer->Unmap();
+
+		s_Data->ParticleShader->Bind();
+
+		s_Data->ParticleVertexArray->Bind();
+		RenderCommand::DrawIndexedInstanced(s_Data->ParticleVertexArray, count);
+		s_Data->Stats.DrawCalls++;
+		s_Data->Stats.ParticleCount += count;
+	}
+
+	void Renderer2D::ResetStats()
+	{
+		s_Data->Stats = Statistics();
+	}
+
+	Renderer2D::Statistics Renderer2D::GetStats()
+	{
+		return s_Data->Stats;
+	}
+
+}
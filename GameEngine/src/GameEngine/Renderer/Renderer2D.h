@@ -0,0 +1,62 @@
+#pragma once
+
+#include "Camera.h"
+#include "Texture.h"
+#include "SpriteAtlas.h"
+#include "Font.h"
+#include "ParticleSystem.h"
+
+namespace GameEngine {
+
+	// Batch renderer per quad e sprite: i vertici vengono accumulati in un unico
+	// vertex buffer dinamico e inviati alla GPU con una sola draw call per batch.
+	// Fino a MaxTextureSlots texture diverse (ad es. le pagine di uno SpriteAtlas)
+	// possono convivere nello stesso batch.
+	class Renderer2D
+	{
+	public:
+		static void Init();
+		static void Shutdown();
+
+		// Richiama Renderer::BeginScene: i dati della camera arrivano agli shader tramite l'uniform buffer ViewData.
+		static void BeginScene(const Camera& camera);
+		static void EndScene();
+		static void Flush();
+
+		static void DrawQuad(const glm::vec2& position, const glm::vec2& size, const glm::vec4& color);
+		static void DrawQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec4& color);
+
+		static void DrawSprite(const glm::vec2& position, const glm::vec2& size, const SpriteRegion& region, const glm::vec4& tint = glm::vec4(1.0f));
+		static void DrawSprite(const glm::vec3& position, const glm::vec2& size, const SpriteRegion& region, const glm::vec4& tint = glm::vec4(1.0f));
+
+		// Le particelle vengono disegnate con una sola draw call instanced, dopo aver
+		// svuotato il batch corrente per rispettare l'ordine di disegno.
+		static void DrawParticles(const ParticleEmitter& emitter);
+
+		// position: inizio della baseline della prima riga; size: altezza di un em in unità del mondo.
+		// I glifi hanno un batch separato, disegnato subito dopo quello dei quad: il testo resta sopra
+		// ai quad inviati prima dello stesso Flush.
+		static void DrawString(const std::string& text, const Ref<Font>& font, const glm::vec2& position, float size, const glm::vec4& color = glm::vec4(1.0f));
+		static void DrawString(const std::string& text, const Ref<Font>& font, const glm::vec3& position, float size, const glm::vec4& color = glm::vec4(1.0f));
+
+		struct Statistics
+		{
+			uint32_t DrawCalls = 0;
+			uint32_t QuadCount = 0;
+			uint32_t ParticleCount = 0;
+			uint32_t GlyphCount = 0;
+		};
+		static void ResetStats();
+		static Statistics GetStats();
+
+	private:
+		static void SubmitQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec2& uvMin, const glm::vec2& uvMax,
+			const Ref<Texture2D>& texture, const glm::vec4& color);
+		static void CreateParticleBuffers(uint32_t capacity);
+		static void FlushQuads();
+		static void FlushText();
+		static void StartBatch();
+		static void NextBatch();
+	};
+
+}
@@ -2,6 +2,7 @@
 
 #include <glm/glm.hpp>
 #include "VertexArray.h"
+#include "StorageBuffer.h"
 
 namespace GameEngine {
 
@@ -14,10 +15,20 @@ namespace GameEngine {
 		};
 
 	public:
+		virtual void Init() = 0;
+		virtual void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) = 0;
 		virtual void SetClearColor(const glm::vec4& color) = 0;
 		virtual void Clear() = 0;
 
-		virtual void DrawIndexed(const Ref<VertexArray>& vertexArray) = 0;
+		// Con indexCount = 0 vengono disegnati tutti gli indici dell'index buffer.
+		virtual void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0) = 0;
+		virtual void DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t instanceCount, uint32_t indexCount = 0) = 0;
+		// drawCount draw lette da commands a partire dal byte offset, in un'unica chiamata. Ogni comando ha il formato
+		// DrawElementsIndirectCommand: { count, instanceCount, firstIndex, baseVertex, baseInstance }, 20 byte.
+		virtual void DrawIndexedIndirect(const Ref<VertexArray>& vertexArray, const Ref<StorageBuffer>& commands, uint32_t drawCount, uint32_t offset = 0) = 0;
+		// Esegue il compute shader collegato. Al ritorno le scritture sugli storage buffer sono visibili
+		// alle draw e ai comandi indiretti successivi.
+		virtual void DispatchCompute(uint32_t groupsX, uint32_t groupsY = 1, uint32_t groupsZ = 1) = 0;
 		
 		inline static API GetAPI() { return s_API; }
 
@@ -0,0 +1,190 @@
+#include "hzpch.h"
+#include "ResourceLoader.h"
+
+#include "GPUFence.h"
+#include "RenderCapture.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace GameEngine {
+
+	struct PendingCompletion
+	{
+		Scope<GPUFence> Fence;
+		ResourceLoader::CompletionFn Completion;
+	};
+
+	struct ResourceLoaderData
+	{
+		GraphicsContext* Context = nullptr;
+		std::thread Thread;
+
+		std::deque<std::pair<ResourceLoader::UploadFn, ResourceLoader::CompletionFn>> Jobs;
+		std::mutex JobMutex;
+		std::condition_variable WakeCondition;
+		bool Running = true;
+
+		// Scritta dal thread di caricamento, letta dal thread principale.
+		std::deque<PendingCompletion> Completions;
+		std::mutex CompletionMutex;
+
+		std::atomic<uint32_t> PendingCount{ 0 };
+	};
+
+	static ResourceLoaderData* s_Data = nullptr;
+
+	static void LoaderLoop()
+	{
+		s_Data->Context->MakeCurrent();
+
+		while (true)
+		{
+			std::pair<ResourceLoader::UploadFn, ResourceLoader::CompletionFn> job;
+			{
+				std::unique_lock<std::mutex> lock(s_Data->JobMutex);
+				s_Data->WakeCondition.wait(lock, [] { return !s_Data->Running || !s_Data->Jobs.empty(); });
+
+				if (s_Data->Jobs.empty())
+					break;
+
+				job = std::move(s_Data->Jobs.front());
+				s_Data->Jobs.pop_front();
+			}
+
+			job.first();
+
+			// Il fence segue i comandi del job: quando è segnalato, le risorse sono utilizzabili da ogni contesto.
+			PendingCompletion completion = { Scope<GPUFence>(GPUFence::Create()), std::move(job.second) };
+			std::lock_guard<std::mutex> lock(s_Data->CompletionMutex);
+			s_Data->Completions.push_back(std::move(completion));
+		}
+
+		s_Data->Context->ReleaseCurrent();
+	}
+
+	void ResourceLoader::Init(GraphicsContext* context)
+	{
+		s_Data = new ResourceLoaderData();
+
+		// Le risorse create durante una cattura devono finire nel file, dal thread principale.
+		if (context && !RenderCapture::IsRecording())
+			s_Data->Context = context->CreateSharedContext();
+
+		// Il contesto condiviso non è corrente su nessun thread: lo diventa sul thread di caricamento.
+		if (s_Data->Context)
+			s_Data->Thread = std::thread(LoaderLoop);
+
+		HZ_CORE_INFO("ResourceLoader: {0}", s_Data->Context ? "background thread with shared context" : "synchronous uploads");
+	}
+
+	void ResourceLoader::Shutdown()
+	{
+		if (!s_Data)
+			return;
+
+		if (s_Data->Context)
+		{
+			{
+				std::lock_guard<std::mutex> lock(s_Data->JobMutex);
+				s_Data->Running = false;
+			}
+			s_Data->WakeCondition.notify_all();
+			s_Data->Thread.join();
+
+			// Il contesto va distrutto sul thread che lo ha creato (con GLFW quello principale).
+			delete s_Data->Context;
+		}
+
+		delete s_Data;
+		s_Data = nullptr;
+	}
+
+	bool ResourceLoader::IsAsync()
+	{
+		return s_Data && s_Data->Context;
+	}
+
+	void ResourceLoader::Enqueue(UploadFn upload, CompletionFn completion)
+	{
+		HZ_CORE_ASSERT(s_Data, "ResourceLoader not initialized!");
+		s_Data->PendingCount++;
+
+		if (!s_Data->Context)
+		{
+			upload();
+			std::lock_guard<std::mutex> lock(s_Data->CompletionMutex);
+			s_Data->Completions.push_back({ nullptr, std::move(completion) });
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(s_Data->JobMutex);
+			s_Data->Jobs.emplace_back(std::move(upload), std::move(completion));
+		}
+		s_Data->WakeCondition.notify_one();
+	}
+
+	void ResourceLoader::CreateVertexBuffer(std::vector<uint8_t> data, std::function<void(const Ref<VertexBuffer>&)> completion)
+	{
+		auto buffer = std::make_shared<Ref<VertexBuffer>>();
+		Enqueue([buffer, data = std::move(data)]() { buffer->reset(VertexBuffer::Create(data.data(), (uint32_t)data.size())); },
+			[buffer, completion = std::move(completion)]() { completion(*buffer); });
+	}
+
+	void ResourceLoader::CreateTexture2D(uint32_t width, uint32_t height, std::vector<uint8_t> pixels, std::function<void(const Ref<Texture2D>&)> completion)
+	{
+		HZ_CORE_ASSERT(pixels.size() == (size_t)width * height * 4, "Texture data must be RGBA8!");
+		auto texture = std::make_shared<Ref<Texture2D>>();
+		Enqueue([texture, width, height, pixels = std::move(pixels)]() mutable
+			{
+				texture->reset(Texture2D::Create(width, height));
+				(*texture)->SetData(pixels.data(), (uint32_t)pixels.size());
+			},
+			[texture, completion = std::move(completion)]() { completion(*texture); });
+	}
+
+	void ResourceLoader::CreateShader(std::string vertexSrc, std::string fragmentSrc, std::function<void(const Ref<Shader>&)> completion)
+	{
+		auto shader = std::make_shared<Ref<Shader>>();
+		Enqueue([shader, vertexSrc = std::move(vertexSrc), fragmentSrc = std::move(fragmentSrc)]() { shader->reset(Shader::Create(vertexSrc, fragmentSrc)); },
+			[shader, completion = std::move(completion)]() { completion(*shader); });
+	}
+
+	void ResourceLoader::ProcessCompletions()
+	{
+		if (!s_Data)
+			return;
+
+		while (true)
+		{
+			PendingCompletion completion;
+			{
+				std::lock_guard<std::mutex> lock(s_Data->CompletionMutex);
+				// Le completion rispettano l'ordine di invio: ci fermiamo al primo job non ancora terminato.
+				if (s_Data->Completions.empty())
+					return;
+				PendingCompletion& front = s_Data->Completions.front();
+				if (front.Fence && !front.Fence->IsSignaled())
+					return;
+
+				completion = std::move(front);
+				s_Data->Completions.pop_front();
+			}
+
+			// Fuori dal lock: la completion può accodare altri job.
+			if (completion.Completion)
+				completion.Completion();
+			s_Data->PendingCount--;
+		}
+	}
+
+	uint32_t ResourceLoader::GetPendingCount()
+	{
+		return s_Data ? s_Data->PendingCount.load() : 0;
+	}
+
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "GameEngine/Core.h"
+#include "GameEngine/Renderer/GraphicsContext.h"
+#include "GameEngine/Renderer/Buffer.h"
+#include "GameEngine/Renderer/Shader.h"
+#include "GameEngine/Renderer/Texture.h"
+
+namespace GameEngine {
+
+	// Thread di caricamento con un proprio contesto grafico, condiviso con quello della finestra:
+	// creazione e upload di buffer, texture e shader avvengono lì, senza fermare il frame.
+	// Dopo ogni job il thread inserisce un GPUFence; la completion del job viene eseguita sul thread principale,
+	// in ProcessCompletions, solo quando il fence è segnalato, cioè quando la risorsa è davvero pronta.
+	//
+	// Tra contesti si condividono buffer, texture e shader, ma non i vertex array: vanno creati sul thread
+	// principale, nella completion. Se il contesto non supporta la condivisione, o durante una RenderCapture,
+	// i job vengono eseguiti subito sul thread chiamante e le completion restano comunque rimandate.
+	class ResourceLoader
+	{
+	public:
+		using UploadFn = std::function<void()>;
+		using CompletionFn = std::function<void()>;
+
+		static void Init(GraphicsContext* context);
+		// Completa i job già accodati, senza eseguirne le completion.
+		static void Shutdown();
+
+		static bool IsAsync();
+
+		// upload gira sul thread di caricamento (con il suo contesto corrente), completion sul thread principale.
+		static void Enqueue(UploadFn upload, CompletionFn completion = nullptr);
+
+		// Helper per i casi comuni: i dati vengono spostati nel job, la risorsa arriva pronta alla callback.
+		static void CreateVertexBuffer(std::vector<uint8_t> data, std::function<void(const Ref<VertexBuffer>&)> completion);
+		// pixels: RGBA8, width * height * 4 byte.
+		static void CreateTexture2D(uint32_t width, uint32_t height, std::vector<uint8_t> pixels, std::function<void(const Ref<Texture2D>&)> completion);
+		static void CreateShader(std::string vertexSrc, std::string fragmentSrc, std::function<void(const Ref<Shader>&)> completion);
+
+		// Da chiamare una volta per frame: esegue, in ordine di invio, le completion dei job già terminati dalla GPU.
+		static void ProcessCompletions();
+		// Job accodati o in attesa del fence.
+		static uint32_t GetPendingCount();
+	};
+
+}
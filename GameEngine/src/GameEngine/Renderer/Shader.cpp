@@ -2,6 +2,7 @@
 #include "Shader.h"
 
 #include "Renderer.h"
+#include "RenderCapture.h"
 #include "Platform/OpenGL/OpenGLShader.h"
 
 namespace GameEngine {
@@ -17,7 +18,26 @@ namespace GameEngine {
 			}
 
 			case RendererAPI::API::OpenGL:
-				return new OpenGLShader(vertexSrc, fragmentSrc);
+				return RenderCapture::Capture(new OpenGLShader(vertexSrc, fragmentSrc), vertexSrc, fragmentSrc);
+
+		}
+
+		HZ_CORE_ASSERT(false, "Unknown Renderer API!");
+		return nullptr;
+	}
+
+	Shader* Shader::CreateCompute(const std::string& computeSrc)
+	{
+		switch (Renderer::GetAPI())
+		{
+			case RendererAPI::API::None:
+			{
+				HZ_CORE_ASSERT(false, "RendererAPI::None is currently not supported");
+				return nullptr;
+			}
+
+			case RendererAPI::API::OpenGL:
+				return RenderCapture::Capture(new OpenGLShader(computeSrc), computeSrc);
 
 		}
 
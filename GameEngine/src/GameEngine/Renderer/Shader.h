@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <glm/glm.hpp>
 
 namespace GameEngine {
 
@@ -12,7 +13,16 @@ namespace GameEngine {
 		virtual void Bind() const = 0;
 		virtual void Unbind() const = 0;
 
+		// Upload indipendente dal backend: Renderer li usa senza conoscere l'implementazione concreta.
+		virtual void SetInt(const std::string& name, int value) = 0;
+		virtual void SetIntArray(const std::string& name, int* values, uint32_t count) = 0;
+		virtual void SetFloat3(const std::string& name, const glm::vec3& value) = 0;
+		virtual void SetFloat4(const std::string& name, const glm::vec4& value) = 0;
+		virtual void SetMat4(const std::string& name, const glm::mat4& value) = 0;
+
 		static Shader* Create(const std::string& vertexSrc, const std::string& fragmentSrc);
+		// Programma con il solo stage compute, da eseguire con RenderCommand::DispatchCompute dopo il Bind.
+		static Shader* CreateCompute(const std::string& computeSrc);
 	};
 
 }
\ No newline at end of file
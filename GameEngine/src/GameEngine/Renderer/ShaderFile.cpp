@@ -0,0 +1,250 @@
+#include "hzpch.h"
+#include "ShaderFile.h"
+
+#include <fstream>
+
+namespace GameEngine {
+
+	// Protegge da #include ciclici tra file diversi, che l'include-once non intercetta se i percorsi differiscono.
+	static const uint32_t s_MaxIncludeDepth = 16;
+
+	static bool ReadFile(const std::string& path, std::string& result)
+	{
+		std::ifstream in(path, std::ios::in | std::ios::binary);
+		if (!in)
+			return false;
+
+		in.seekg(0, std::ios::end);
+		result.resize((size_t)in.tellg());
+		in.seekg(0, std::ios::beg);
+		in.read(&result[0], result.size());
+		return true;
+	}
+
+	static std::string GetDirectory(const std::string& path)
+	{
+		size_t slash = path.find_last_of("/\\");
+		return slash == std::string::npos ? std::string() : path.substr(0, slash + 1);
+	}
+
+	// Le #define devono seguire #version, che in GLSL deve essere la prima direttiva del sorgente.
+	static std::string InsertDefines(const std::string& source, const std::string& defines)
+	{
+		size_t version = source.find("#version");
+		if (version == std::string::npos)
+			return defines + source;
+
+		size_t lineEnd = source.find('\n', version);
+		if (lineEnd == std::string::npos)
+			return source + "\n" + defines;
+
+		std::string result = source;
+		result.insert(lineEnd + 1, defines);
+		return result;
+	}
+
+	ShaderFile::ShaderFile(const std::string& path)
+		: m_Path(path)
+	{
+		std::string source;
+		if (!ReadFile(path, source))
+		{
+			HZ_CORE_ERROR("Could not open shader '{0}'", path);
+			return;
+		}
+
+		// Prima si divide il file nelle sezioni #type, poi ogni sezione risolve i propri #include:
+		// un file comune incluso da entrambi gli stage viene così copiato in tutti e due.
+		std::string sections[2];
+		int32_t current = -1;
+
+		std::istringstream stream(source);
+		std::string line;
+		while (std::getline(stream, line))
+		{
+			std::istringstream tokens(line);
+			std::string directive;
+			tokens >> directive;
+
+			if (directive == "#type")
+			{
+				std::string type;
+				tokens >> type;
+				if (type == "vertex")
+					current = 0;
+				else if (type == "fragment" || type == "pixel")
+					current = 1;
+				else
+				{
+					HZ_CORE_ERROR("Unknown shader type '{0}' in '{1}'", type, path);
+					return;
+				}
+				continue;
+			}
+
+			// Prima del primo #type sono ammessi solo commenti e #pragma multi_compile.
+			if (current < 0)
+			{
+				std::string pragma;
+				if (directive == "#pragma" && (tokens >> pragma) && pragma == "multi_compile")
+					AddKeywordGroup(line);
+				continue;
+			}
+
+			sections[current] += line;
+			sections[current] += '\n';
+		}
+
+		if (sections[0].empty() || sections[1].empty())
+		{
+			HZ_CORE_ERROR("Shader '{0}' needs both a '#type vertex' and a '#type fragment' section", path);
+			return;
+		}
+
+		std::unordered_set<std::string> included = { path };
+		if (!Expand(path, sections[0], included, m_VertexSource, 0))
+			return;
+
+		included = { path };
+		if (!Expand(path, sections[1], included, m_FragmentSource, 0))
+			return;
+
+		m_Loaded = true;
+	}
+
+	bool ShaderFile::Expand(const std::string& path, const std::string& source, std::unordered_set<std::string>& included, std::string& output, uint32_t depth)
+	{
+		if (depth > s_MaxIncludeDepth)
+		{
+			HZ_CORE_ERROR("Includes nested too deeply in '{0}'", path);
+			return false;
+		}
+
+		std::istringstream stream(source);
+		std::string line;
+		while (std::getline(stream, line))
+		{
+			std::istringstream tokens(line);
+			std::string directive;
+			tokens >> directive;
+
+			if (directive == "#include")
+			{
+				size_t begin = line.find_first_of("\"<");
+				size_t end = line.find_last_of("\">");
+				if (begin == std::string::npos || end <= begin)
+				{
+					HZ_CORE_ERROR("Malformed #include in '{0}': {1}", path, line);
+					return false;
+				}
+
+				// Ogni file viene incluso una sola volta per stage, come con #pragma once.
+				std::string includePath = GetDirectory(path) + line.substr(begin + 1, end - begin - 1);
+				if (!included.insert(includePath).second)
+					continue;
+
+				std::string includeSource;
+				if (!ReadFile(includePath, includeSource))
+				{
+					HZ_CORE_ERROR("Could not open '{0}' included by '{1}'", includePath, path);
+					return false;
+				}
+
+				if (!Expand(includePath, includeSource, included, output, depth + 1))
+					return false;
+				continue;
+			}
+
+			if (directive == "#type")
+			{
+				HZ_CORE_ERROR("'#type' is only allowed in the main shader file, found in '{0}'", path);
+				return false;
+			}
+
+			std::string pragma;
+			if (directive == "#pragma" && (tokens >> pragma) && pragma == "multi_compile")
+			{
+				AddKeywordGroup(line);
+				continue;
+			}
+
+			output += line;
+			output += '\n';
+		}
+		return true;
+	}
+
+	void ShaderFile::AddKeywordGroup(const std::string& pragma)
+	{
+		std::istringstream tokens(pragma);
+		std::string skip;
+		tokens >> skip >> skip;
+
+		std::vector<std::string> group;
+		std::string keyword;
+		while (tokens >> keyword)
+		{
+			// "_" (o "__") è l'opzione senza keyword.
+			if (keyword.find_first_not_of('_') == std::string::npos)
+				keyword.clear();
+			group.push_back(keyword);
+		}
+
+		// Lo stesso gruppo può arrivare da un file incluso in entrambi gli stage.
+		if (group.size() < 2 || std::find(m_KeywordGroups.begin(), m_KeywordGroups.end(), group) != m_KeywordGroups.end())
+			return;
+
+		HZ_CORE_ASSERT((uint64_t)m_VariantCount * group.size() <= UINT32_MAX, "Too many shader variants!");
+		m_KeywordGroups.push_back(group);
+		m_VariantCount *= (uint32_t)group.size();
+	}
+
+	uint32_t ShaderFile::GetVariantKey(const std::vector<std::string>& keywords) const
+	{
+		// La chiave è il numero della variante scritto in base mista: una cifra per gruppo.
+		uint32_t key = 0, stride = 1;
+		for (const auto& group : m_KeywordGroups)
+		{
+			uint32_t option = 0;
+			for (uint32_t i = 0; i < group.size(); i++)
+			{
+				if (!group[i].empty() && std::find(keywords.begin(), keywords.end(), group[i]) != keywords.end())
+					option = i;
+			}
+
+			key += option * stride;
+			stride *= (uint32_t)group.size();
+		}
+		return key;
+	}
+
+	Ref<Shader> ShaderFile::GetVariant(const std::vector<std::string>& keywords)
+	{
+		return GetVariantByKey(GetVariantKey(keywords));
+	}
+
+	Ref<Shader> ShaderFile::GetVariantByKey(uint32_t key)
+	{
+		auto it = m_Variants.find(key);
+		if (it != m_Variants.end())
+			return it->second;
+
+		if (!m_Loaded || key >= m_VariantCount)
+			return nullptr;
+
+		std::string defines;
+		uint32_t digits = key;
+		for (const auto& group : m_KeywordGroups)
+		{
+			const std::string& keyword = group[digits % group.size()];
+			digits /= (uint32_t)group.size();
+			if (!keyword.empty())
+				defines += "#define " + keyword + "\n";
+		}
+
+		Ref<Shader> shader(Shader::Create(InsertDefines(m_VertexSource, defines), InsertDefines(m_FragmentSource, defines)));
+		m_Variants[key] = shader;
+		return shader;
+	}
+
+}
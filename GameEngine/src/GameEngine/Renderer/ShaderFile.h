@@ -0,0 +1,53 @@
+#pragma once
+
+#include "GameEngine/Core.h"
+#include "GameEngine/Renderer/Shader.h"
+
+namespace GameEngine {
+
+	// Shader scritto in un unico file .glsl:
+	// - "#type vertex" e "#type fragment" aprono le sezioni dei due stage;
+	// - "#include "file"" inserisce un altro file, con il percorso relativo a quello che lo include;
+	// - "#pragma multi_compile A B C" dichiara un gruppo di keyword alternative, "_" indica nessuna keyword.
+	// Ogni combinazione di keyword è una variante: viene compilata solo alla prima richiesta e poi tenuta in cache.
+	class ShaderFile
+	{
+	public:
+		ShaderFile(const std::string& path);
+
+		inline bool IsLoaded() const { return m_Loaded; }
+		inline const std::string& GetPath() const { return m_Path; }
+
+		// Variante con attive le keyword indicate. Per i gruppi non nominati vale la prima opzione.
+		Ref<Shader> GetVariant(const std::vector<std::string>& keywords = {});
+
+		// La chiave identifica una variante senza confrontare stringhe: si calcola una volta
+		// con GetVariantKey e si usa con GetVariantByKey nei percorsi chiamati ogni frame.
+		uint32_t GetVariantKey(const std::vector<std::string>& keywords) const;
+		Ref<Shader> GetVariantByKey(uint32_t key);
+
+		inline const std::vector<std::vector<std::string>>& GetKeywordGroups() const { return m_KeywordGroups; }
+		inline uint32_t GetVariantCount() const { return m_VariantCount; }
+		inline uint32_t GetCompiledVariantCount() const { return (uint32_t)m_Variants.size(); }
+		// Dimensione dei sorgenti già espansi, usata dall'AssetManager come stima della memoria.
+		inline uint64_t GetSourceSize() const { return m_VertexSource.size() + m_FragmentSource.size(); }
+
+	private:
+		bool Expand(const std::string& path, const std::string& source, std::unordered_set<std::string>& included, std::string& output, uint32_t depth);
+		void AddKeywordGroup(const std::string& pragma);
+
+	private:
+		std::string m_Path;
+		bool m_Loaded = false;
+
+		// Sorgenti con gli #include già risolti e senza le righe #pragma multi_compile.
+		std::string m_VertexSource;
+		std::string m_FragmentSource;
+
+		std::vector<std::vector<std::string>> m_KeywordGroups;
+		uint32_t m_VariantCount = 1;
+
+		std::unordered_map<uint32_t, Ref<Shader>> m_Variants;
+	};
+
+}
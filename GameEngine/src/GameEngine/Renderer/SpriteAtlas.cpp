@@ -0,0 +1,243 @@
+#include "hzpch.h"
+#include "SpriteAtlas.h"
+
+namespace GameEngine {
+
+	#pragma region Skyline Packer
+	SkylinePacker::SkylinePacker(uint32_t width, uint32_t height)
+		: m_Width(width), m_Height(height)
+	{
+		Reset();
+	}
+
+	void SkylinePacker::Reset()
+	{
+		m_Skyline.clear();
+		m_Skyline.push_back({ 0, 0, m_Width });
+		m_UsedArea = 0;
+	}
+
+	int SkylinePacker::Fit(size_t index, uint32_t width, uint32_t height) const
+	{
+		uint32_t x = m_Skyline[index].X;
+		if (x + width > m_Width)
+			return -1;
+
+		// Il rettangolo può coprire più gradini: deve appoggiarsi sul più alto.
+		uint32_t y = 0;
+		int32_t widthLeft = (int32_t)width;
+		size_t i = index;
+		while (widthLeft > 0)
+		{
+			y = std::max(y, m_Skyline[i].Y);
+			if (y + height > m_Height)
+				return -1;
+
+			widthLeft -= (int32_t)m_Skyline[i].Width;
+			i++;
+		}
+
+		return (int)y;
+	}
+
+	bool SkylinePacker::Pack(uint32_t width, uint32_t height, uint32_t& outX, uint32_t& outY)
+	{
+		size_t bestIndex = m_Skyline.size();
+		uint32_t bestBottom = UINT32_MAX;
+		uint32_t bestWidth = UINT32_MAX;
+
+		for (size_t i = 0; i < m_Skyline.size(); i++)
+		{
+			int y = Fit(i, width, height);
+			if (y < 0)
+				continue;
+
+			// Scegliamo la posizione più bassa; a parità, il gradino più stretto (meno spazio sprecato).
+			uint32_t bottom = (uint32_t)y + height;
+			if (bottom < bestBottom || (bottom == bestBottom && m_Skyline[i].Width < bestWidth))
+			{
+				bestIndex = i;
+				bestBottom = bottom;
+				bestWidth = m_Skyline[i].Width;
+				outX = m_Skyline[i].X;
+				outY = (uint32_t)y;
+			}
+		}
+
+		if (bestIndex == m_Skyline.size())
+			return false;
+
+		AddLevel(bestIndex, outX, outY, width, height);
+		m_UsedArea += (uint64_t)width * height;
+		return true;
+	}
+
+	void SkylinePacker::AddLevel(size_t index, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+	{
+		m_Skyline.insert(m_Skyline.begin() + index, { x, y + height, width });
+
+		// Accorciamo (o rimuoviamo) i gradini coperti dal nuovo rettangolo.
+		for (size_t i = index + 1; i < m_Skyline.size(); i++)
+		{
+			Node& previous = m_Skyline[i - 1];
+			Node& node = m_Skyline[i];
+			if (node.X >= previous.X + previous.Width)
+				break;
+
+			uint32_t shrink = previous.X + previous.Width - node.X;
+			if (node.Width <= shrink)
+			{
+				m_Skyline.erase(m_Skyline.begin() + i);
+				i--;
+				continue;
+			}
+
+			node.X += shrink;
+			node.Width -= shrink;
+			break;
+		}
+
+		// Uniamo i gradini adiacenti alla stessa altezza.
+		for (size_t i = 0; i + 1 < m_Skyline.size(); i++)
+		{
+			if (m_Skyline[i].Y == m_Skyline[i + 1].Y)
+			{
+				m_Skyline[i].Width += m_Skyline[i + 1].Width;
+				m_Skyline.erase(m_Skyline.begin() + i + 1);
+				i--;
+			}
+		}
+	}
+	#pragma endregion
+
+	#pragma region Sprite Atlas
+	const SpriteRegion* SpriteAtlas::GetRegion(const std::string& name) const
+	{
+		auto it = m_Regions.find(name);
+		return it != m_Regions.end() ? &it->second : nullptr;
+	}
+	#pragma endregion
+
+	#pragma region Sprite Atlas Builder
+	SpriteAtlasBuilder::SpriteAtlasBuilder(uint32_t pageWidth, uint32_t pageHeight, uint32_t padding)
+		: m_PageWidth(pageWidth), m_PageHeight(pageHeight), m_Padding(padding)
+	{
+	}
+
+	void SpriteAtlasBuilder::AddSprite(const std::string& name, uint32_t width, uint32_t height, const void* pixels)
+	{
+		// Uno sprite vuoto non ha pixel da replicare nel padding.
+		if (width == 0 || height == 0)
+		{
+			HZ_CORE_ERROR("Sprite '{0}' has zero size ({1}x{2})!", name, width, height);
+			return;
+		}
+
+		PendingSprite sprite;
+		sprite.Name = name;
+		sprite.Width = width;
+		sprite.Height = height;
+		sprite.Pixels.resize((size_t)width * height * 4);
+		memcpy(sprite.Pixels.data(), pixels, sprite.Pixels.size());
+		m_Sprites.push_back(std::move(sprite));
+	}
+
+	// Copia lo sprite nella pagina e replica i pixel del bordo nel padding (edge extrusion).
+	static void BlitWithPadding(std::vector<uint8_t>& page, uint32_t pageWidth, const std::vector<uint8_t>& pixels,
+		uint32_t width, uint32_t height, uint32_t dstX, uint32_t dstY, uint32_t padding)
+	{
+		for (int32_t y = -(int32_t)padding; y < (int32_t)(height + padding); y++)
+		{
+			uint32_t srcY = (uint32_t)std::clamp(y, 0, (int32_t)height - 1);
+			for (int32_t x = -(int32_t)padding; x < (int32_t)(width + padding); x++)
+			{
+				uint32_t srcX = (uint32_t)std::clamp(x, 0, (int32_t)width - 1);
+				const uint8_t* src = &pixels[((size_t)srcY * width + srcX) * 4];
+				uint8_t* dst = &page[((size_t)(dstY + y) * pageWidth + (dstX + x)) * 4];
+				memcpy(dst, src, 4);
+			}
+		}
+	}
+
+	Ref<SpriteAtlas> SpriteAtlasBuilder::Build()
+	{
+		Ref<SpriteAtlas> atlas = std::make_shared<SpriteAtlas>();
+
+		// Inserire prima gli sprite più alti produce uno skyline più regolare e meno spazio sprecato.
+		std::vector<PendingSprite*> order;
+		order.reserve(m_Sprites.size());
+		for (auto& sprite : m_Sprites)
+			order.push_back(&sprite);
+		std::stable_sort(order.begin(), order.end(), [](const PendingSprite* a, const PendingSprite* b)
+		{
+			return a->Height != b->Height ? a->Height > b->Height : a->Width > b->Width;
+		});
+
+		struct Page
+		{
+			SkylinePacker Packer;
+			std::vector<uint8_t> Pixels;
+			std::vector<std::pair<std::string, SpriteRegion>> Regions;
+		};
+		std::vector<Page> pages;
+
+		for (PendingSprite* sprite : order)
+		{
+			uint32_t paddedWidth = sprite->Width + 2 * m_Padding;
+			uint32_t paddedHeight = sprite->Height + 2 * m_Padding;
+			if (paddedWidth > m_PageWidth || paddedHeight > m_PageHeight)
+			{
+				HZ_CORE_ERROR("Sprite '{0}' ({1}x{2}) does not fit in an atlas page!", sprite->Name, sprite->Width, sprite->Height);
+				continue;
+			}
+
+			// Proviamo le pagine esistenti, altrimenti ne apriamo una nuova.
+			uint32_t x = 0, y = 0;
+			size_t pageIndex = 0;
+			for (; pageIndex < pages.size(); pageIndex++)
+			{
+				if (pages[pageIndex].Packer.Pack(paddedWidth, paddedHeight, x, y))
+					break;
+			}
+
+			if (pageIndex == pages.size())
+			{
+				pages.push_back({ SkylinePacker(m_PageWidth, m_PageHeight), std::vector<uint8_t>((size_t)m_PageWidth * m_PageHeight * 4, 0), {} });
+				pages.back().Packer.Pack(paddedWidth, paddedHeight, x, y);
+			}
+
+			Page& page = pages[pageIndex];
+			uint32_t spriteX = x + m_Padding;
+			uint32_t spriteY = y + m_Padding;
+			BlitWithPadding(page.Pixels, m_PageWidth, sprite->Pixels, sprite->Width, sprite->Height, spriteX, spriteY, m_Padding);
+
+			SpriteRegion region;
+			region.UVMin = { (float)spriteX / m_PageWidth, (float)spriteY / m_PageHeight };
+			region.UVMax = { (float)(spriteX + sprite->Width) / m_PageWidth, (float)(spriteY + sprite->Height) / m_PageHeight };
+			region.Width = sprite->Width;
+			region.Height = sprite->Height;
+			page.Regions.emplace_back(sprite->Name, region);
+		}
+
+		for (auto& page : pages)
+		{
+			Ref<Texture2D> texture;
+			texture.reset(Texture2D::Create(m_PageWidth, m_PageHeight));
+			texture->SetData(page.Pixels.data(), (uint32_t)page.Pixels.size());
+			atlas->m_Pages.push_back(texture);
+
+			for (auto& [name, region] : page.Regions)
+			{
+				region.Texture = texture;
+				atlas->m_Regions[name] = region;
+			}
+
+			HZ_CORE_INFO("Sprite atlas page {0}: {1} sprites, {2:.1f}% occupied", atlas->m_Pages.size() - 1, page.Regions.size(), page.Packer.GetOccupancy() * 100.0f);
+		}
+
+		m_Sprites.clear();
+		return atlas;
+	}
+	#pragma endregion
+
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "GameEngine/Core.h"
+#include "GameEngine/Renderer/Texture.h"
+
+#include <glm/glm.hpp>
+
+namespace GameEngine {
+
+	// Packer "skyline bottom-left": il bordo superiore dei rettangoli già inseriti
+	// viene mantenuto come una linea a gradini (skyline) e ogni nuovo rettangolo
+	// viene appoggiato nel punto in cui la sua base rimane più in basso possibile.
+	class SkylinePacker
+	{
+	public:
+		SkylinePacker(uint32_t width, uint32_t height);
+
+		// Restituisce false se il rettangolo non entra nella pagina.
+		bool Pack(uint32_t width, uint32_t height, uint32_t& outX, uint32_t& outY);
+		void Reset();
+
+		inline uint32_t GetWidth() const { return m_Width; }
+		inline uint32_t GetHeight() const { return m_Height; }
+
+		// Frazione dell'area della pagina occupata dai rettangoli inseriti.
+		float GetOccupancy() const { return (float)m_UsedArea / (float)(m_Width * m_Height); }
+
+	private:
+		// Restituisce la y a cui il rettangolo può essere appoggiato partendo dal nodo index, -1 se non entra.
+		int Fit(size_t index, uint32_t width, uint32_t height) const;
+		void AddLevel(size_t index, uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+
+	private:
+		struct Node
+		{
+			uint32_t X, Y, Width;
+		};
+
+		uint32_t m_Width, m_Height;
+		uint64_t m_UsedArea = 0;
+		std::vector<Node> m_Skyline;
+	};
+
+	// Porzione di un atlas occupata da uno sprite.
+	struct SpriteRegion
+	{
+		Ref<Texture2D> Texture;
+		glm::vec2 UVMin = { 0.0f, 0.0f };
+		glm::vec2 UVMax = { 1.0f, 1.0f };
+		uint32_t Width = 0, Height = 0;
+	};
+
+	class SpriteAtlas
+	{
+	public:
+		// Restituisce nullptr se lo sprite non è presente nell'atlas.
+		const SpriteRegion* GetRegion(const std::string& name) const;
+
+		inline uint32_t GetPageCount() const { return (uint32_t)m_Pages.size(); }
+		inline const Ref<Texture2D>& GetPage(uint32_t index) const { return m_Pages[index]; }
+
+	private:
+		std::vector<Ref<Texture2D>> m_Pages;
+		std::unordered_map<std::string, SpriteRegion> m_Regions;
+
+		friend class SpriteAtlasBuilder;
+	};
+
+	// Raccoglie gli sprite al caricamento e li impacchetta in poche texture grandi,
+	// così che il batch renderer possa disegnare sprite diversi senza cambiare texture.
+	class SpriteAtlasBuilder
+	{
+	public:
+		// padding: pixel lasciati attorno a ogni sprite (riempiti replicando il bordo)
+		// per evitare che il filtraggio legga i pixel degli sprite vicini.
+		SpriteAtlasBuilder(uint32_t pageWidth = 2048, uint32_t pageHeight = 2048, uint32_t padding = 1);
+
+		// pixels: RGBA8, width * height * 4 byte. I dati vengono copiati.
+		void AddSprite(const std::string& name, uint32_t width, uint32_t height, const void* pixels);
+
+		// Impacchetta tutti gli sprite aggiunti e carica le pagine sulla GPU.
+		Ref<SpriteAtlas> Build();
+
+	private:
+		struct PendingSprite
+		{
+			std::string Name;
+			uint32_t Width, Height;
+			std::vector<uint8_t> Pixels;
+		};
+
+		uint32_t m_PageWidth, m_PageHeight, m_Padding;
+		std::vector<PendingSprite> m_Sprites;
+	};
+
+}
@@ -0,0 +1,29 @@
+#include "hzpch.h"
+#include "StorageBuffer.h"
+
+#include "Renderer.h"
+#include "RenderCapture.h"
+#include "Platform/OpenGL/OpenGLStorageBuffer.h"
+
+namespace GameEngine {
+
+	StorageBuffer* StorageBuffer::Create(uint32_t size, uint32_t binding)
+	{
+		switch (Renderer::GetAPI())
+		{
+			case RendererAPI::API::None:
+			{
+				HZ_CORE_ASSERT(false, "RendererAPI::None is currently not supported");
+				return nullptr;
+			}
+
+			case RendererAPI::API::OpenGL:
+				return RenderCapture::Capture(new OpenGLStorageBuffer(size, binding), size, binding);
+
+		}
+
+		HZ_CORE_ASSERT(false, "Unknown Renderer API!");
+		return nullptr;
+	}
+
+}
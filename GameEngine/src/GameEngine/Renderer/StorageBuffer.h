@@ -0,0 +1,23 @@
+#pragma once
+
+#include "GameEngine/Core.h"
+
+namespace GameEngine {
+
+	// Shader storage buffer: array di dimensione arbitraria che gli shader leggono con
+	// layout(std430, binding = N) buffer. Contiene anche i comandi delle draw indirette.
+	class StorageBuffer
+	{
+	public:
+		virtual ~StorageBuffer() {}
+
+		virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) = 0;
+		virtual void Bind(uint32_t binding) const = 0;
+
+		virtual uint32_t GetSize() const = 0;
+		virtual uint32_t GetRendererID() const = 0;
+
+		static StorageBuffer* Create(uint32_t size, uint32_t binding);
+	};
+
+}
@@ -0,0 +1,61 @@
+#include "hzpch.h"
+#include "Texture.h"
+
+#include "Renderer.h"
+#include "RenderCapture.h"
+#include "Platform/OpenGL/OpenGLTexture.h"
+#include "Platform/OpenGL/OpenGLExtensions.h"
+
+namespace GameEngine {
+
+	Texture2D* Texture2D::Create(uint32_t width, uint32_t height)
+	{
+		switch (Renderer::GetAPI())
+		{
+			case RendererAPI::API::None:
+			{
+				HZ_CORE_ASSERT(false, "RendererAPI::None is currently not supported");
+				return nullptr;
+			}
+
+			case RendererAPI::API::OpenGL:
+				return RenderCapture::Capture(new OpenGLTexture2D(width, height));
+
+		}
+
+		HZ_CORE_ASSERT(false, "Unknown Renderer API!");
+		return nullptr;
+	}
+
+	bool Texture2D::IsBindlessSupported()
+	{
+		switch (Renderer::GetAPI())
+		{
+			case RendererAPI::API::None:	return false;
+			case RendererAPI::API::OpenGL:	return OpenGLExtensions::HasBindlessTexture() && !RenderCapture::IsRecording();
+		}
+
+		HZ_CORE_ASSERT(false, "Unknown Renderer API!");
+		return false;
+	}
+
+	TextureArray* TextureArray::Create(uint32_t width, uint32_t height, uint32_t layers)
+	{
+		switch (Renderer::GetAPI())
+		{
+			case RendererAPI::API::None:
+			{
+				HZ_CORE_ASSERT(false, "RendererAPI::None is currently not supported");
+				return nullptr;
+			}
+
+			case RendererAPI::API::OpenGL:
+				return RenderCapture::Capture(new OpenGLTextureArray(width, height, layers));
+
+		}
+
+		HZ_CORE_ASSERT(false, "Unknown Renderer API!");
+		return nullptr;
+	}
+
+}
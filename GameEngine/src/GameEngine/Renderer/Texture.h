@@ -0,0 +1,51 @@
+#pragma once
+
+#include <string>
+
+#include "GameEngine/Core.h"
+
+namespace GameEngine {
+
+	// Classe base per tutte le texture.
+	class Texture
+	{
+	public:
+		virtual ~Texture() = default;
+
+		virtual uint32_t GetWidth() const = 0;
+		virtual uint32_t GetHeight() const = 0;
+		virtual uint32_t GetRendererID() const = 0;
+
+		// Carica i pixel (RGBA8) nella texture. size è espresso in byte e deve coprire l'intera texture.
+		virtual void SetData(void* data, uint32_t size) = 0;
+
+		virtual void Bind(uint32_t slot = 0) const = 0;
+
+		// Handle di GL_ARB_bindless_texture, reso residente alla prima richiesta. 0 se il backend non lo supporta.
+		virtual uint64_t GetBindlessHandle() const { return 0; }
+	};
+
+	class Texture2D : public Texture
+	{
+	public:
+		static Texture2D* Create(uint32_t width, uint32_t height);
+
+		// Vero se le texture possono essere usate dagli shader tramite GetBindlessHandle.
+		// Durante una RenderCapture è sempre falso: gli handle cambiano a ogni esecuzione e il replay non li ritroverebbe.
+		static bool IsBindlessSupported();
+	};
+
+	// Array di texture RGBA8 della stessa dimensione (GL_TEXTURE_2D_ARRAY): lo shader sceglie il layer con la
+	// terza coordinata, quindi texture diverse non richiedono bind diversi. SetData carica tutti i layer insieme.
+	class TextureArray : public Texture
+	{
+	public:
+		virtual uint32_t GetLayerCount() const = 0;
+
+		// Carica i pixel di un solo layer: size deve coprire width * height * 4 byte.
+		virtual void SetLayerData(uint32_t layer, const void* data, uint32_t size) = 0;
+
+		static TextureArray* Create(uint32_t width, uint32_t height, uint32_t layers);
+	};
+
+}
@@ -0,0 +1,125 @@
+#include "hzpch.h"
+#include "TextureLibrary.h"
+
+namespace GameEngine {
+
+	// Limite alla memoria di un singolo array: le texture grandi ottengono array con meno layer.
+	static const uint64_t s_MaxArrayBytes = 64 * 1024 * 1024;
+
+	TextureLibrary::TextureLibrary(bool allowBindless)
+		: m_Bindless(allowBindless && Texture2D::IsBindlessSupported())
+	{
+	}
+
+	uint32_t TextureLibrary::AllocateIndex()
+	{
+		m_TextureCount++;
+		m_TableDirty = true;
+
+		if (!m_FreeIndices.empty())
+		{
+			uint32_t index = m_FreeIndices.back();
+			m_FreeIndices.pop_back();
+			m_LiveIndices[index] = true;
+			return index;
+		}
+
+		m_Table.push_back({ 0, 0, 0 });
+		m_LiveIndices.push_back(true);
+		if (m_Bindless)
+			m_Textures.emplace_back();
+		return (uint32_t)m_Table.size() - 1;
+	}
+
+	uint32_t TextureLibrary::Add(uint32_t width, uint32_t height, const void* pixels)
+	{
+		uint32_t size = width * height * 4;
+
+		if (m_Bindless)
+		{
+			Ref<Texture2D> texture(Texture2D::Create(width, height));
+			texture->SetData((void*)pixels, size);
+
+			uint32_t index = AllocateIndex();
+			m_Table[index] = { texture->GetBindlessHandle(), 0, 0 };
+			m_Textures[index] = texture;
+			return index;
+		}
+
+		// Primo array della stessa dimensione con un layer libero, altrimenti se ne crea uno nuovo.
+		uint32_t arrayIndex = 0;
+		for (; arrayIndex < m_Arrays.size(); arrayIndex++)
+		{
+			const ArrayPage& page = m_Arrays[arrayIndex];
+			if (page.Array->GetWidth() == width && page.Array->GetHeight() == height &&
+				(!page.FreeLayers.empty() || page.UsedLayers < page.Array->GetLayerCount()))
+				break;
+		}
+
+		if (arrayIndex == m_Arrays.size())
+		{
+			HZ_CORE_ASSERT(m_Arrays.size() < MaxArrays, "TextureLibrary is full: too many different texture sizes!");
+			if (m_Arrays.size() >= MaxArrays)
+				return InvalidIndex;
+
+			uint32_t layers = (uint32_t)std::min<uint64_t>(MaxLayersPerArray, std::max<uint64_t>(1, s_MaxArrayBytes / size));
+			ArrayPage page;
+			page.Array.reset(TextureArray::Create(width, height, layers));
+			m_Arrays.push_back(page);
+		}
+
+		ArrayPage& page = m_Arrays[arrayIndex];
+		uint32_t layer;
+		if (!page.FreeLayers.empty())
+		{
+			layer = page.FreeLayers.back();
+			page.FreeLayers.pop_back();
+		}
+		else
+			layer = page.UsedLayers++;
+
+		page.Array->SetLayerData(layer, pixels, size);
+
+		uint32_t index = AllocateIndex();
+		m_Table[index] = { 0, arrayIndex, layer };
+		return index;
+	}
+
+	void TextureLibrary::Remove(uint32_t index)
+	{
+		HZ_CORE_ASSERT(index < m_Table.size() && m_LiveIndices[index], "Unknown or already removed texture index!");
+		if (index >= m_Table.size() || !m_LiveIndices[index])
+			return;
+
+		if (m_Bindless)
+			m_Textures[index].reset();
+		else
+			m_Arrays[m_Table[index].Array].FreeLayers.push_back(m_Table[index].Layer);
+
+		m_Table[index] = { 0, 0, 0 };
+		m_LiveIndices[index] = false;
+		m_FreeIndices.push_back(index);
+		m_TextureCount--;
+		m_TableDirty = true;
+	}
+
+	void TextureLibrary::Bind()
+	{
+		if (m_Table.empty())
+			return;
+
+		if (m_TableDirty)
+		{
+			uint32_t size = (uint32_t)(m_Table.size() * sizeof(TableEntry));
+			if (!m_TableBuffer || m_TableBuffer->GetSize() < size)
+				m_TableBuffer.reset(StorageBuffer::Create(size, TableBinding));
+			m_TableBuffer->SetData(m_Table.data(), size);
+			m_TableDirty = false;
+		}
+		m_TableBuffer->Bind(TableBinding);
+
+		for (uint32_t i = 0; i < m_Arrays.size(); i++)
+			m_Arrays[i].Array->Bind(i);
+	}
+
+}
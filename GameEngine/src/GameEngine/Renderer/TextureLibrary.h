@@ -0,0 +1,76 @@
+#pragma once
+
+#include "GameEngine/Core.h"
+#include "GameEngine/Renderer/Texture.h"
+#include "GameEngine/Renderer/StorageBuffer.h"
+
+namespace GameEngine {
+
+	// Raccolta di texture a cui le draw fanno riferimento con un indice scritto nei propri dati (vertici, istanze
+	// o DrawRecord), invece che con un bind: texture diverse non spezzano più batch e draw indirette.
+	// - Senza bindless le texture della stessa dimensione finiscono nei layer di uno stesso TextureArray,
+	//   e gli array vengono collegati tutti insieme alle unità 0 .. MaxArrays - 1.
+	// - Con GL_ARB_bindless_texture ogni texture resta separata e lo shader la legge dal suo handle.
+	// In entrambi i casi lo shader trova la texture nella tabella:
+	// struct TextureEntry { uvec2 Handle; uint Array; uint Layer; };
+	// layout(std430, binding = 3) readonly buffer TextureTable { TextureEntry u_TextureTable[]; };
+	class TextureLibrary
+	{
+	public:
+		static const uint32_t TableBinding = 3;
+		// Deve coincidere con la dimensione di u_TextureArrays negli shader.
+		static const uint32_t MaxArrays = 8;
+		static const uint32_t MaxLayersPerArray = 64;
+		static const uint32_t InvalidIndex = 0xFFFFFFFF;
+
+		TextureLibrary(bool allowBindless = true);
+
+		// Copia i pixel (RGBA8, width * height * 4 byte) nella libreria. Restituisce l'indice da usare negli shader.
+		uint32_t Add(uint32_t width, uint32_t height, const void* pixels);
+		// L'indice e il layer tornano disponibili per le Add successive.
+		void Remove(uint32_t index);
+
+		// Carica la tabella se è cambiata e la collega a TableBinding, insieme agli array. Non fa il bind dello shader.
+		void Bind();
+
+		// Gli shader scelgono il percorso con la keyword BINDLESS (vedi assets/shaders/TextureLibrary.glsl nella Sandbox).
+		inline bool IsBindless() const { return m_Bindless; }
+		inline uint32_t GetTextureCount() const { return m_TextureCount; }
+		inline uint32_t GetArrayCount() const { return (uint32_t)m_Arrays.size(); }
+
+	private:
+		// Stesso layout del TextureEntry std430: uvec2 a 8 byte, struct arrotondata a 8.
+		struct TableEntry
+		{
+			uint64_t Handle;
+			uint32_t Array;
+			uint32_t Layer;
+		};
+
+		struct ArrayPage
+		{
+			Ref<TextureArray> Array;
+			uint32_t UsedLayers = 0;
+			std::vector<uint32_t> FreeLayers;
+		};
+
+		uint32_t AllocateIndex();
+
+	private:
+		bool m_Bindless;
+
+		std::vector<ArrayPage> m_Arrays;
+		// Solo nel percorso bindless: le texture, indicizzate come la tabella.
+		std::vector<Ref<Texture2D>> m_Textures;
+
+		std::vector<TableEntry> m_Table;
+		// Indici assegnati e non ancora rimossi: una seconda Remove dello stesso indice viene rifiutata.
+		std::vector<bool> m_LiveIndices;
+		std::vector<uint32_t> m_FreeIndices;
+		uint32_t m_TextureCount = 0;
+
+		Ref<StorageBuffer> m_TableBuffer;
+		bool m_TableDirty = false;
+	};
+
+}
@@ -0,0 +1,329 @@
+#include "hzpch.h"
+#include "Tilemap.h"
+
+#include "Renderer.h"
+#include "RenderCommand.h"
+#include "VertexPacking.h"
+
+#include <cfloat>
+
+namespace GameEngine {
+
+	static const std::string s_TilemapVertexSrc = R"(
+		#version 450 core
+
+		layout(location = 0) in vec2 a_Position;
+		layout(location = 1) in vec2 a_TexCoord;
+
+		layout(std140, binding = 0) uniform ViewData
+		{
+			mat4 u_ProjectionView;
+			mat4 u_View;
+			mat4 u_Projection;
+			vec4 u_CameraPosition;
+		};
+
+		out vec2 v_TexCoord;
+
+		void main()
+		{
+			v_TexCoord = a_TexCoord;
+			gl_Position = u_ProjectionView * vec4(a_Position, 0.0, 1.0);
+		}
+	)";
+
+	static const std::string s_TilemapFragmentSrc = R"(
+		#version 450 core
+
+		layout(location = 0) out vec4 color;
+
+		in vec2 v_TexCoord;
+
+		uniform sampler2D u_Tileset;
+
+		void main()
+		{
+			color = texture(u_Tileset, v_TexCoord);
+			if (color.a == 0.0)
+				discard;
+		}
+	)";
+
+	Tilemap::Tilemap(const TilemapSpecification& specification, const Tileset& tileset)
+		: m_Specification(specification), m_Tileset(tileset)
+	{
+		HZ_CORE_ASSERT(specification.ChunkSize > 0 && specification.ChunkSize <= 128, "Chunk size must be between 1 and 128 tiles!");
+		HZ_CORE_ASSERT(tileset.Texture, "Tilemap needs a tileset texture!");
+
+		m_Tiles.resize((size_t)specification.Width * specification.Height, 0);
+		m_ChunksX = (specification.Width + specification.ChunkSize - 1) / specification.ChunkSize;
+		m_ChunksY = (specification.Height + specification.ChunkSize - 1) / specification.ChunkSize;
+		m_Chunks.resize((size_t)m_ChunksX * m_ChunksY);
+
+		// Lo schema degli indici è lo stesso per tutti i chunk: un solo index buffer, grande quanto un chunk pieno.
+		// Con chunk fino a 128x128 gli indici restano sotto 65536 e vengono salvati a 16 bit.
+		uint32_t maxQuads = specification.ChunkSize * specification.ChunkSize;
+		std::vector<uint32_t> indices(maxQuads * 6);
+		for (uint32_t i = 0, offset = 0; i < indices.size(); i += 6, offset += 4)
+		{
+			indices[i + 0] = offset + 0;
+			indices[i + 1] = offset + 1;
+			indices[i + 2] = offset + 2;
+
+			indices[i + 3] = offset + 2;
+			indices[i + 4] = offset + 3;
+			indices[i + 5] = offset + 0;
+		}
+		m_IndexBuffer.reset(IndexBuffer::Create(indices.data(), (uint32_t)indices.size()));
+
+		m_ShaderHandle = AssetManager::LoadShader(s_TilemapVertexSrc, s_TilemapFragmentSrc);
+		m_Shader = AssetManager::Get<Shader>(m_ShaderHandle);
+		m_Shader->Bind();
+		m_Shader->SetInt("u_Tileset", 0);
+	}
+
+	Tilemap::~Tilemap()
+	{
+		AssetManager::Release(m_ShaderHandle);
+	}
+
+	void Tilemap::SetTile(uint32_t x, uint32_t y, uint16_t tile)
+	{
+		HZ_CORE_ASSERT(x < m_Specification.Width && y < m_Specification.Height, "Tile coordinates out of range!");
+
+		uint16_t& current = m_Tiles[(size_t)y * m_Specification.Width + x];
+		if (current == tile)
+			return;
+
+		current = tile;
+		// I chunk non caricati verranno costruiti con i dati aggiornati quando servono.
+		Chunk& chunk = m_Chunks[(size_t)(y / m_Specification.ChunkSize) * m_ChunksX + x / m_Specification.ChunkSize];
+		if (chunk.Resident)
+			chunk.Dirty = true;
+	}
+
+	uint16_t Tilemap::GetTile(uint32_t x, uint32_t y) const
+	{
+		HZ_CORE_ASSERT(x < m_Specification.Width && y < m_Specification.Height, "Tile coordinates out of range!");
+		return m_Tiles[(size_t)y * m_Specification.Width + x];
+	}
+
+	void Tilemap::BuildChunk(uint32_t chunkX, uint32_t chunkY)
+	{
+		Chunk& chunk = m_Chunks[(size_t)chunkY * m_ChunksX + chunkX];
+		const uint32_t chunkSize = m_Specification.ChunkSize;
+		const float tileSize = m_Specification.TileSize;
+
+		// Mezzo texel di margine: con il filtraggio lineare il bordo di un tile non legge i pixel del vicino.
+		const glm::vec2 cellSize = { 1.0f / m_Tileset.Columns, 1.0f / m_Tileset.Rows };
+		const glm::vec2 inset = { 0.5f / m_Tileset.Texture->GetWidth(), 0.5f / m_Tileset.Texture->GetHeight() };
+		const uint32_t tileCount = m_Tileset.Columns * m_Tileset.Rows;
+
+		m_BuildVertices.clear();
+		uint32_t xEnd = std::min((chunkX + 1) * chunkSize, m_Specification.Width);
+		uint32_t yEnd = std::min((chunkY + 1) * chunkSize, m_Specification.Height);
+		for (uint32_t y = chunkY * chunkSize; y < yEnd; y++)
+		{
+			for (uint32_t x = chunkX * chunkSize; x < xEnd; x++)
+			{
+				uint16_t tile = m_Tiles[(size_t)y * m_Specification.Width + x];
+				if (tile == 0 || tile > tileCount)
+					continue;
+
+				uint32_t cell = tile - 1u;
+				glm::vec2 uvMin = glm::vec2(cell % m_Tileset.Columns, cell / m_Tileset.Columns) * cellSize + inset;
+				glm::vec2 uvMax = uvMin + cellSize - 2.0f * inset;
+
+				glm::vec2 min = m_Specification.Origin + glm::vec2(x, y) * tileSize;
+				glm::vec2 max = min + tileSize;
+				m_BuildVertices.push_back({ { min.x, min.y }, VertexPacking::PackUShort2N({ uvMin.x, uvMin.y }) });
+				m_BuildVertices.push_back({ { max.x, min.y }, VertexPacking::PackUShort2N({ uvMax.x, uvMin.y }) });
+				m_BuildVertices.push_back({ { max.x, max.y }, VertexPacking::PackUShort2N({ uvMax.x, uvMax.y }) });
+				m_BuildVertices.push_back({ { min.x, max.y }, VertexPacking::PackUShort2N({ uvMin.x, uvMax.y }) });
+			}
+		}
+
+		uint32_t size = (uint32_t)(m_BuildVertices.size() * sizeof(TileVertex));
+		if (size == 0)
+		{
+			// Un chunk vuoto resta "caricato" senza buffer, così non viene riesaminato ad ogni frame.
+			ReleaseChunk(chunk);
+		}
+		else if (size > chunk.Capacity)
+		{
+			// Il vertex array punta al buffer con cui è stato configurato: se il buffer cambia va ricreato anche lui.
+			ReleaseChunk(chunk);
+			chunk.Vertices.reset(VertexBuffer::Create(m_BuildVertices.data(), size));
+			chunk.Vertices->SetLayout({
+				{ ShaderDataType::Float2,   "a_Position" },
+				{ ShaderDataType::UShort2N, "a_TexCoord" }
+			});
+			chunk.Mesh.reset(VertexArray::Create());
+			chunk.Mesh->AddVertexBuffer(chunk.Vertices);
+			chunk.Mesh->SetIndexBuffer(m_IndexBuffer);
+			chunk.Capacity = size;
+			m_Stats.MemoryUsage += size;
+		}
+		else
+		{
+			chunk.Vertices->SetData(m_BuildVertices.data(), size);
+		}
+
+		chunk.QuadCount = (uint32_t)(m_BuildVertices.size() / 4);
+		chunk.Dirty = false;
+		if (!chunk.Resident)
+		{
+			chunk.Resident = true;
+			m_ResidentChunks.push_back(chunkY * m_ChunksX + chunkX);
+		}
+		m_Stats.ChunkBuilds++;
+	}
+
+	void Tilemap::ReleaseChunk(Chunk& chunk)
+	{
+		m_Stats.MemoryUsage -= chunk.Capacity;
+		chunk.Mesh.reset();
+		chunk.Vertices.reset();
+		chunk.Capacity = 0;
+		chunk.QuadCount = 0;
+	}
+
+	void Tilemap::ReleaseChunks()
+	{
+		for (uint32_t index : m_ResidentChunks)
+		{
+			ReleaseChunk(m_Chunks[index]);
+			m_Chunks[index].Resident = false;
+			m_Chunks[index].Dirty = false;
+		}
+		m_ResidentChunks.clear();
+	}
+
+	void Tilemap::EvictChunks()
+	{
+		if (m_Stats.MemoryUsage <= m_StreamingSettings.MemoryBudget)
+			return;
+
+		// Dal chunk usato meno di recente; quelli usati in questo frame non vengono mai scaricati,
+		// quindi se il budget è troppo piccolo per la vista corrente viene superato invece di ricostruire ogni frame.
+		std::sort(m_ResidentChunks.begin(), m_ResidentChunks.end(), [this](uint32_t a, uint32_t b)
+		{
+			return m_Chunks[a].LastUsedFrame < m_Chunks[b].LastUsedFrame;
+		});
+
+		size_t evicted = 0;
+		for (; evicted < m_ResidentChunks.size() && m_Stats.MemoryUsage > m_StreamingSettings.MemoryBudget; evicted++)
+		{
+			Chunk& chunk = m_Chunks[m_ResidentChunks[evicted]];
+			if (chunk.LastUsedFrame == m_Frame)
+				break;
+
+			ReleaseChunk(chunk);
+			chunk.Resident = false;
+			chunk.Dirty = false;
+			m_Stats.ChunkEvictions++;
+		}
+		m_ResidentChunks.erase(m_ResidentChunks.begin(), m_ResidentChunks.begin() + evicted);
+	}
+
+	void Tilemap::Render(const Camera& camera)
+	{
+		m_Frame++;
+		m_Stats.VisibleChunks = 0;
+		m_Stats.DrawCalls = 0;
+		m_Stats.TileCount = 0;
+		m_Stats.ChunkBuilds = 0;
+		m_Stats.ChunkEvictions = 0;
+
+		// Area vista dalla camera sul piano z = 0: intersechiamo con il piano i raggi che passano per gli angoli dello schermo.
+		const glm::mat4& projectionView = camera.GetProjectionViewMatrix();
+		const glm::mat4 inverse = glm::inverse(projectionView);
+		glm::vec2 viewMin(FLT_MAX), viewMax(-FLT_MAX);
+		const glm::vec2 corners[4] = { { -1.0f, -1.0f }, { 1.0f, -1.0f }, { 1.0f, 1.0f }, { -1.0f, 1.0f } };
+		for (const glm::vec2& corner : corners)
+		{
+			glm::vec4 nearPoint = inverse * glm::vec4(corner, -1.0f, 1.0f);
+			glm::vec4 farPoint = inverse * glm::vec4(corner, 1.0f, 1.0f);
+			nearPoint /= nearPoint.w;
+			farPoint /= farPoint.w;
+
+			float t = std::abs(farPoint.z - nearPoint.z) > 1e-6f ? nearPoint.z / (nearPoint.z - farPoint.z) : 0.0f;
+			glm::vec2 point = glm::vec2(nearPoint.x, nearPoint.y) + glm::vec2(farPoint.x - nearPoint.x, farPoint.y - nearPoint.y) * t;
+			viewMin = glm::min(viewMin, point);
+			viewMax = glm::max(viewMax, point);
+		}
+
+		const float chunkWorldSize = m_Specification.ChunkSize * m_Specification.TileSize;
+		const glm::vec2 first = glm::floor((viewMin - m_Specification.Origin) / chunkWorldSize);
+		const glm::vec2 last = glm::floor((viewMax - m_Specification.Origin) / chunkWorldSize);
+		const int32_t margin = (int32_t)m_StreamingSettings.Margin;
+		auto clampX = [this](float value) { return (int32_t)std::min(std::max(value, 0.0f), (float)m_ChunksX - 1); };
+		auto clampY = [this](float value) { return (int32_t)std::min(std::max(value, 0.0f), (float)m_ChunksY - 1); };
+
+		// Con la camera ruotata il rettangolo contiene chunk fuori dallo schermo: il test esatto lo fa CullBoxes.
+		m_CandidateChunks.clear();
+		m_CandidateBoxes.clear();
+		if (last.x >= 0.0f && last.y >= 0.0f && first.x < m_ChunksX && first.y < m_ChunksY)
+		{
+			for (int32_t y = clampY(first.y); y <= clampY(last.y); y++)
+			{
+				for (int32_t x = clampX(first.x); x <= clampX(last.x); x++)
+				{
+					glm::vec2 min = m_Specification.Origin + glm::vec2(x, y) * chunkWorldSize;
+					m_CandidateChunks.push_back((uint32_t)y * m_ChunksX + (uint32_t)x);
+					m_CandidateBoxes.push_back({ { min, 0.0f }, { min + chunkWorldSize, 0.0f } });
+				}
+			}
+		}
+
+		m_Visibility.resize(m_CandidateChunks.size());
+		if (!m_CandidateChunks.empty())
+			MathKernels::CullBoxes(Frustum::FromMatrix(projectionView), m_CandidateBoxes.data(), m_Visibility.data(), (uint32_t)m_CandidateChunks.size());
+
+		Renderer::BeginScene(camera);
+		m_Tileset.Texture->Bind(0);
+		m_Shader->Bind();
+
+		for (size_t i = 0; i < m_CandidateChunks.size(); i++)
+		{
+			if (!m_Visibility[i])
+				continue;
+
+			uint32_t index = m_CandidateChunks[i];
+			Chunk& chunk = m_Chunks[index];
+			if (!chunk.Resident || chunk.Dirty)
+				BuildChunk(index % m_ChunksX, index / m_ChunksX);
+			chunk.LastUsedFrame = m_Frame;
+			m_Stats.VisibleChunks++;
+
+			if (chunk.QuadCount == 0)
+				continue;
+
+			chunk.Mesh->Bind();
+			RenderCommand::DrawIndexed(chunk.Mesh, chunk.QuadCount * 6);
+			m_Stats.DrawCalls++;
+			m_Stats.TileCount += chunk.QuadCount;
+		}
+
+		// Prefetch: i chunk attorno alla vista vengono costruiti un po' per frame, prima che diventino visibili.
+		uint32_t prefetched = 0;
+		bool nearMap = last.x + margin >= 0.0f && last.y + margin >= 0.0f && first.x - margin < m_ChunksX && first.y - margin < m_ChunksY;
+		for (int32_t y = clampY(first.y - margin); nearMap && y <= clampY(last.y + margin) && prefetched < m_StreamingSettings.MaxPrefetchPerFrame; y++)
+		{
+			for (int32_t x = clampX(first.x - margin); x <= clampX(last.x + margin) && prefetched < m_StreamingSettings.MaxPrefetchPerFrame; x++)
+			{
+				Chunk& chunk = m_Chunks[(size_t)y * m_ChunksX + x];
+				if (chunk.Resident && !chunk.Dirty)
+					continue;
+
+				BuildChunk((uint32_t)x, (uint32_t)y);
+				chunk.LastUsedFrame = m_Frame;
+				prefetched++;
+			}
+		}
+
+		EvictChunks();
+		m_Stats.ResidentChunks = (uint32_t)m_ResidentChunks.size();
+	}
+
+}
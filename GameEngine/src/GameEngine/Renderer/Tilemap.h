@@ -0,0 +1,127 @@
+#pragma once
+
+#include "GameEngine/Core.h"
+#include "GameEngine/Renderer/Camera.h"
+#include "GameEngine/Renderer/Texture.h"
+#include "GameEngine/Renderer/Shader.h"
+#include "GameEngine/Renderer/VertexArray.h"
+#include "GameEngine/Asset/AssetManager.h"
+#include "GameEngine/Math/MathKernels.h"
+
+#include <glm/glm.hpp>
+
+namespace GameEngine {
+
+	struct TilemapSpecification
+	{
+		uint32_t Width = 0, Height = 0;
+		// Lato di un tile in unità del mondo; Origin è l'angolo in basso a sinistra del tile (0, 0).
+		float TileSize = 1.0f;
+		glm::vec2 Origin = { 0.0f, 0.0f };
+		// Lato di un chunk in tile: ogni chunk è un vertex buffer e una draw call.
+		uint32_t ChunkSize = 32;
+	};
+
+	// Texture divisa in una griglia di tile uguali. Il tile n (n >= 1) è la cella n - 1,
+	// contando da sinistra verso destra a partire dalla prima riga di pixel.
+	struct Tileset
+	{
+		Ref<Texture2D> Texture;
+		uint32_t Columns = 1, Rows = 1;
+	};
+
+	struct TilemapStreamingSettings
+	{
+		// Chunk caricati in anticipo attorno a quelli visibili, per lato.
+		uint32_t Margin = 1;
+		// Chunk non visibili costruiti al massimo per frame: i chunk visibili vengono sempre costruiti subito.
+		uint32_t MaxPrefetchPerFrame = 4;
+		// Memoria GPU massima per i vertex buffer dei chunk: oltre, i chunk usati meno di recente vengono scaricati.
+		uint64_t MemoryBudget = 32ull * 1024 * 1024;
+	};
+
+	// Tilemap divisa in chunk quadrati. Ogni chunk ha un vertex buffer statico con un quad per tile non vuoto,
+	// ricostruito solo quando uno dei suoi tile cambia; tutti i chunk condividono lo stesso index buffer.
+	// I tile restano in memoria, mentre i buffer GPU esistono solo per i chunk vicini alla camera.
+	class Tilemap
+	{
+	public:
+		Tilemap(const TilemapSpecification& specification, const Tileset& tileset);
+		~Tilemap();
+
+		// 0 = tile vuoto.
+		void SetTile(uint32_t x, uint32_t y, uint16_t tile);
+		uint16_t GetTile(uint32_t x, uint32_t y) const;
+
+		// Disegna i chunk visibili dalla camera, dopo averli costruiti o aggiornati se necessario.
+		// Imposta la camera come Renderer::BeginScene.
+		void Render(const Camera& camera);
+
+		// Scarica tutti i buffer GPU (ad es. cambiando livello); i chunk verranno ricostruiti quando servono.
+		void ReleaseChunks();
+
+		inline TilemapStreamingSettings& GetStreamingSettings() { return m_StreamingSettings; }
+		inline const TilemapSpecification& GetSpecification() const { return m_Specification; }
+
+		struct Statistics
+		{
+			uint32_t VisibleChunks = 0;
+			uint32_t ResidentChunks = 0;
+			uint32_t DrawCalls = 0;
+			uint32_t TileCount = 0;
+			// Chunk costruiti o ricostruiti e chunk scaricati nell'ultimo Render.
+			uint32_t ChunkBuilds = 0;
+			uint32_t ChunkEvictions = 0;
+			uint64_t MemoryUsage = 0;
+		};
+		inline const Statistics& GetStats() const { return m_Stats; }
+
+	private:
+		// 12 byte per vertice: la posizione è già nel mondo, quindi non serve nessuna trasformazione per chunk.
+		struct TileVertex
+		{
+			glm::vec2 Position;
+			uint32_t TexCoord;	// UShort2N
+		};
+
+		struct Chunk
+		{
+			Ref<VertexArray> Mesh;
+			Ref<VertexBuffer> Vertices;
+			uint32_t QuadCount = 0;
+			// Byte allocati nel vertex buffer: un chunk modificato viene riscritto in place se ci sta.
+			uint32_t Capacity = 0;
+			uint64_t LastUsedFrame = 0;
+			bool Resident = false;
+			bool Dirty = false;
+		};
+
+		void BuildChunk(uint32_t chunkX, uint32_t chunkY);
+		void ReleaseChunk(Chunk& chunk);
+		void EvictChunks();
+
+	private:
+		TilemapSpecification m_Specification;
+		Tileset m_Tileset;
+		TilemapStreamingSettings m_StreamingSettings;
+
+		std::vector<uint16_t> m_Tiles;
+		uint32_t m_ChunksX, m_ChunksY;
+		std::vector<Chunk> m_Chunks;
+		std::vector<uint32_t> m_ResidentChunks;
+
+		Ref<IndexBuffer> m_IndexBuffer;
+		AssetHandle m_ShaderHandle;
+		Ref<Shader> m_Shader;
+
+		// Memoria riutilizzata tra un frame e l'altro.
+		std::vector<TileVertex> m_BuildVertices;
+		std::vector<uint32_t> m_CandidateChunks;
+		std::vector<BoundingBox> m_CandidateBoxes;
+		std::vector<uint8_t> m_Visibility;
+
+		uint64_t m_Frame = 0;
+		Statistics m_Stats;
+	};
+
+}
@@ -0,0 +1,29 @@
+#include "hzpch.h"
+#include "UniformBuffer.h"
+
+#include "Renderer.h"
+#include "RenderCapture.h"
+#include "Platform/OpenGL/OpenGLUniformBuffer.h"
+
+namespace GameEngine {
+
+	UniformBuffer* UniformBuffer::Create(uint32_t size, uint32_t binding)
+	{
+		switch (Renderer::GetAPI())
+		{
+			case RendererAPI::API::None:
+			{
+				HZ_CORE_ASSERT(false, "RendererAPI::None is currently not supported");
+				return nullptr;
+			}
+
+			case RendererAPI::API::OpenGL:
+				return RenderCapture::Capture(new OpenGLUniformBuffer(size, binding), size, binding);
+
+		}
+
+		HZ_CORE_ASSERT(false, "Unknown Renderer API!");
+		return nullptr;
+	}
+
+}
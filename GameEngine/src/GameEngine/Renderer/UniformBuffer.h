@@ -0,0 +1,21 @@
+#pragma once
+
+#include "GameEngine/Core.h"
+
+namespace GameEngine {
+
+	// Uniform buffer collegato ad un binding point fisso: tutti gli shader che dichiarano
+	// layout(std140, binding = N) leggono gli stessi dati senza upload per-shader.
+	class UniformBuffer
+	{
+	public:
+		virtual ~UniformBuffer() {}
+
+		virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) = 0;
+		// Collega il buffer a un binding point, ad es. quando più buffer si alternano sullo stesso binding.
+		virtual void Bind(uint32_t binding) const = 0;
+
+		static UniformBuffer* Create(uint32_t size, uint32_t binding);
+	};
+
+}
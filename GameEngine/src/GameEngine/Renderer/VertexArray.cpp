@@ -2,6 +2,7 @@
 #include "VertexArray.h"
 
 #include "Renderer.h"
+#include "RenderCapture.h"
 #include "Platform/OpenGL/OpenGLVertexArray.h"
 
 namespace GameEngine {
@@ -17,7 +18,7 @@ namespace GameEngine {
 			}
 
 			case RendererAPI::API::OpenGL:
-				return new OpenGLVertexArray();
+				return RenderCapture::Capture(new OpenGLVertexArray());
 
 		}
 
@@ -13,11 +13,16 @@ namespace GameEngine {
 		virtual void Bind() const = 0;
 		virtual void Unbind() const = 0;
 
-		virtual void AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer) = 0;
+		// Con instanceDivisor > 0 gli attributi del buffer avanzano una volta ogni instanceDivisor istanze
+		// invece che ad ogni vertice (dati per-istanza nel rendering instanced).
+		virtual void AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer, uint32_t instanceDivisor = 0) = 0;
 		virtual void SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer) = 0;
 
 		virtual const std::vector<Ref<VertexBuffer>>& GetVertexBuffers() const = 0;
 		virtual const Ref<IndexBuffer>& GetIndexBuffers() const = 0;
+
+		// Vertici disponibili per una draw call: il minimo tra i buffer per-vertice (quelli per-istanza sono esclusi).
+		virtual uint32_t GetVertexCount() const = 0;
 		
 		static VertexArray* Create();
 	};
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <glm/gtc/packing.hpp>
+
+namespace GameEngine {
+
+	// Funzioni per convertire i dati dei vertici nei formati compatti di ShaderDataType.
+	// Ogni funzione indica il tipo di attributo da usare nel BufferLayout.
+	namespace VertexPacking {
+
+		// ShaderDataType::Half
+		inline uint16_t PackHalf(float value) { return glm::packHalf1x16(value); }
+		// ShaderDataType::Half2
+		inline uint32_t PackHalf2(const glm::vec2& value) { return glm::packHalf2x16(value); }
+		// ShaderDataType::Half4
+		inline uint64_t PackHalf4(const glm::vec4& value) { return glm::packHalf4x16(value); }
+
+		// ShaderDataType::UByte4N, tipicamente per i colori: ogni componente va da 0 a 1.
+		inline uint32_t PackUByte4N(const glm::vec4& value) { return glm::packUnorm4x8(glm::clamp(value, 0.0f, 1.0f)); }
+
+		// ShaderDataType::Short2N, componenti in [-1, 1].
+		inline uint32_t PackShort2N(const glm::vec2& value) { return glm::packSnorm2x16(glm::clamp(value, -1.0f, 1.0f)); }
+		// ShaderDataType::UShort2N, tipicamente per le UV in [0, 1]: 16 bit bastano per atlas fino a 65536 texel.
+		inline uint32_t PackUShort2N(const glm::vec2& value) { return glm::packUnorm2x16(glm::clamp(value, 0.0f, 1.0f)); }
+
+		// ShaderDataType::Int1010102N, tipicamente per normali e tangenti (w = segno della bitangente).
+		inline uint32_t PackInt1010102N(const glm::vec4& value) { return glm::packSnorm3x10_1x2(glm::clamp(value, -1.0f, 1.0f)); }
+		// ShaderDataType::UInt1010102N, componenti in [0, 1].
+		inline uint32_t PackUInt1010102N(const glm::vec4& value) { return glm::packUnorm3x10_1x2(glm::clamp(value, 0.0f, 1.0f)); }
+
+	}
+
+}
@@ -4,6 +4,7 @@
 
 #include "GameEngine/Core.h"
 #include "GameEngine/Events/Event.h"
+#include "GameEngine/Renderer/GraphicsContext.h"
 
 namespace GameEngine {
 
@@ -13,11 +14,15 @@ namespace GameEngine {
 		std::string Title;
 		unsigned int Width;
 		unsigned int Height;
+		// Nessuna finestra visibile: il rendering avviene in un contesto offscreen
+		// (EGL su Linux, anche senza display né GPU; finestra nascosta su Windows).
+		bool Headless;
 
 		WindowProps(const std::string& title = "Hazel Engine",
 			unsigned int width = 1280,
-			unsigned int height = 720)
-			: Title(title), Width(width), Height(height)
+			unsigned int height = 720,
+			bool headless = false)
+			: Title(title), Width(width), Height(height), Headless(headless)
 		{
 		}
 
@@ -33,6 +38,9 @@ namespace GameEngine {
 		virtual ~Window() {}
 
 		virtual void OnUpdate() = 0;
+		// Processa gli eventi senza disegnare, bloccando il thread finché non ne arriva uno
+		// o per al massimo timeout secondi. Usata dall'applicazione quando non c'è niente da mostrare.
+		virtual void WaitEvents(float timeout) = 0;
 
 		virtual unsigned int GetWidth() const = 0;
 		virtual unsigned int GetHeight() const = 0;
@@ -41,9 +49,12 @@ namespace GameEngine {
 		virtual void SetEventCallback(const EventCallbackFn& callback) = 0;
 		virtual void SetVSync(bool enabled) = 0;
 		virtual bool IsVSync() const = 0;
+		// Senza finestra nativa GetNativeWindow() ritorna nullptr e non arrivano eventi di input.
+		virtual bool IsHeadless() const { return false; }
 
 		// Ritorna la finestra di GLFW
 		virtual void* GetNativeWindow() const = 0;
+		virtual GraphicsContext* GetContext() const = 0;
 
 		// L'implementazione di questa funzione sarà diversa per piattaforma.
 		static Window* Create(const WindowProps& props = WindowProps());
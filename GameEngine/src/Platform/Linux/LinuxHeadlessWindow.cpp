@@ -0,0 +1,35 @@
+#include "hzpch.h"
+#include "LinuxHeadlessWindow.h"
+
+#include "OpenGLHeadlessContext.h"
+
+#include <chrono>
+#include <thread>
+
+namespace GameEngine {
+
+	LinuxHeadlessWindow::LinuxHeadlessWindow(const WindowProps& props)
+		: m_Width(props.Width), m_Height(props.Height)
+	{
+		HZ_CORE_INFO("Creating headless surface {0} ({1}, {2})", props.Title, props.Width, props.Height);
+
+		m_Context = new OpenGLHeadlessContext(props.Width, props.Height);
+		m_Context->Init();
+	}
+
+	LinuxHeadlessWindow::~LinuxHeadlessWindow()
+	{
+		delete m_Context;
+	}
+
+	void LinuxHeadlessWindow::OnUpdate()
+	{
+		m_Context->SwapBuffers();
+	}
+
+	void LinuxHeadlessWindow::WaitEvents(float timeout)
+	{
+		std::this_thread::sleep_for(std::chrono::duration<float>(timeout));
+	}
+
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "GameEngine/Window.h"
+#include "GameEngine/Renderer/GraphicsContext.h"
+
+namespace GameEngine {
+
+	// "Finestra" senza display: il framebuffer di default è una pbuffer surface EGL.
+	// Non genera eventi, quindi l'applicazione gira finché non viene fermata da fuori (ad es. --frames).
+	class LinuxHeadlessWindow : public Window
+	{
+	public:
+		LinuxHeadlessWindow(const WindowProps& props);
+		virtual ~LinuxHeadlessWindow();
+
+		void OnUpdate() override;
+		// Non ci sono eventi da attendere: dorme per tutto il timeout.
+		void WaitEvents(float timeout) override;
+
+		inline unsigned int GetWidth() const override { return m_Width; }
+		inline unsigned int GetHeight() const override { return m_Height; }
+
+		inline void SetEventCallback(const EventCallbackFn& callback) override { m_EventCallback = callback; }
+		// Una pbuffer non viene mai presentata: il V-sync non ha effetto.
+		void SetVSync(bool enabled) override {}
+		bool IsVSync() const override { return false; }
+		bool IsHeadless() const override { return true; }
+
+		inline virtual void* GetNativeWindow() const { return nullptr; }
+		inline virtual GraphicsContext* GetContext() const override { return m_Context; }
+
+	private:
+		unsigned int m_Width, m_Height;
+		EventCallbackFn m_EventCallback;
+
+		GraphicsContext* m_Context;
+	};
+
+}
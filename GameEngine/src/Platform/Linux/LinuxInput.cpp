@@ -0,0 +1,61 @@
+#include "hzpch.h"
+#include "LinuxInput.h"
+
+#include "GameEngine/Application.h"
+#include "GLFW/glfw3.h"
+
+namespace GameEngine {
+
+	Input* Input::s_Instance = new LinuxInput();
+
+	// In modalità headless non c'è una finestra GLFW: nessun tasto premuto e mouse fermo nell'origine.
+	static GLFWwindow* GetNativeWindow()
+	{
+		return static_cast<GLFWwindow*>(Application::Get().GetWindow().GetNativeWindow());
+	}
+
+	bool LinuxInput::IsKeyPressedImpl(int keycode)
+	{
+		GLFWwindow* window = GetNativeWindow();
+		if (!window)
+			return false;
+
+		auto state = glfwGetKey(window, keycode);
+		return state == GLFW_PRESS || state == GLFW_REPEAT;
+	}
+
+	bool LinuxInput::IsMouseButtonPressedImpl(int button)
+	{
+		GLFWwindow* window = GetNativeWindow();
+		if (!window)
+			return false;
+
+		auto state = glfwGetMouseButton(window, button);
+		return state == GLFW_PRESS;
+	}
+
+	std::pair<float, float> LinuxInput::GetMousePositionImpl()
+	{
+		GLFWwindow* window = GetNativeWindow();
+		if (!window)
+			return { 0.0f, 0.0f };
+
+		double xpos, ypos;
+		glfwGetCursorPos(window, &xpos, &ypos);
+
+		return { (float)xpos, (float)ypos };
+	}
+
+	float LinuxInput::GetMouseXImpl()
+	{
+		auto [x, y] = GetMousePositionImpl();
+		return x;
+	}
+
+	float LinuxInput::GetMouseYImpl()
+	{
+		auto [x, y] = GetMousePositionImpl();
+		return y;
+	}
+
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "GameEngine/Input.h"
+
+namespace GameEngine {
+
+	class LinuxInput : public Input
+	{
+	protected:
+		virtual bool IsKeyPressedImpl(int keycode) override;
+
+		virtual bool IsMouseButtonPressedImpl(int button) override;
+		virtual std::pair<float, float> GetMousePositionImpl() override;
+		virtual float GetMouseXImpl() override;
+		virtual float GetMouseYImpl() override;
+	};
+
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "GameEngine/Window.h"
+#include "GameEngine/Renderer/GraphicsContext.h"
+
+#include "GLFW/glfw3.h"
+
+namespace GameEngine {
+
+	// Finestra GLFW su X11/Wayland: stessa struttura di WindowsWindow.
+	class LinuxWindow : public Window
+	{
+	public:
+		LinuxWindow(const WindowProps& props);
+		virtual ~LinuxWindow();
+
+		void OnUpdate() override;
+		void WaitEvents(float timeout) override;
+
+		inline unsigned int GetWidth() const override { return m_Data.Width; }
+		inline unsigned int GetHeight() const override { return m_Data.Height; }
+
+		// Attributi della finestra
+		inline void SetEventCallback(const EventCallbackFn& callback) override { m_Data.EventCallback = callback; }
+		void SetVSync(bool enabled) override;
+		bool IsVSync() const override;
+
+		inline virtual void* GetNativeWindow() const { return m_Window; }
+		inline virtual GraphicsContext* GetContext() const override { return m_Context; }
+
+	private:
+		virtual void Init(const WindowProps& props);
+		virtual void Shutdown();
+
+	private:
+		GLFWwindow* m_Window;
+
+		GraphicsContext* m_Context;
+
+		struct WindowData
+		{
+			std::string Title;
+			unsigned int Width, Height;
+			bool VSync;
+
+			EventCallbackFn EventCallback;
+		};
+
+		WindowData m_Data;
+	};
+
+}
@@ -0,0 +1,136 @@
+#include "hzpch.h"
+#include "OpenGLHeadlessContext.h"
+#include "Platform/OpenGL/OpenGLExtensions.h"
+
+#include <EGL/eglext.h>
+#include <glad/glad.h>
+
+namespace GameEngine {
+
+	OpenGLHeadlessContext::OpenGLHeadlessContext(uint32_t width, uint32_t height)
+		: m_Width(width), m_Height(height)
+	{
+	}
+
+	OpenGLHeadlessContext::~OpenGLHeadlessContext()
+	{
+		if (m_Display == EGL_NO_DISPLAY)
+			return;
+
+		// Un contesto condiviso viene distrutto dal thread principale, dove è corrente il contesto principale:
+		// lo rilasciamo solo se è il nostro, altrimenti le chiamate GL successive resterebbero senza contesto.
+		if (eglGetCurrentContext() == m_Context)
+			eglMakeCurrent(m_Display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+		if (m_Context != EGL_NO_CONTEXT)
+			eglDestroyContext(m_Display, m_Context);
+		if (m_Surface != EGL_NO_SURFACE)
+			eglDestroySurface(m_Display, m_Surface);
+		if (m_OwnsDisplay)
+			eglTerminate(m_Display);
+	}
+
+	static const EGLint s_ContextAttributes[] = {
+		EGL_CONTEXT_MAJOR_VERSION, 4,
+		EGL_CONTEXT_MINOR_VERSION, 5,
+		EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+		EGL_NONE
+	};
+
+	static EGLDisplay GetHeadlessDisplay()
+	{
+		// La piattaforma surfaceless di Mesa non richiede X11 né Wayland; se manca proviamo il display di default.
+#ifdef EGL_PLATFORM_SURFACELESS_MESA
+		auto getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+		if (getPlatformDisplay)
+		{
+			EGLDisplay display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+			if (display != EGL_NO_DISPLAY)
+				return display;
+		}
+#endif
+		return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+	}
+
+	void OpenGLHeadlessContext::Init()
+	{
+		m_Display = GetHeadlessDisplay();
+		HZ_CORE_ASSERT(m_Display != EGL_NO_DISPLAY, "Could not get an EGL display!");
+
+		EGLint major, minor;
+		EGLBoolean initialized = eglInitialize(m_Display, &major, &minor);
+		HZ_CORE_ASSERT(initialized, "Could not initialize EGL!");
+
+		eglBindAPI(EGL_OPENGL_API);
+
+		const EGLint configAttributes[] = {
+			EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+			EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+			EGL_RED_SIZE, 8, EGL_GREEN_SIZE, 8, EGL_BLUE_SIZE, 8, EGL_ALPHA_SIZE, 8,
+			EGL_DEPTH_SIZE, 24, EGL_STENCIL_SIZE, 8,
+			EGL_NONE
+		};
+		EGLint configCount = 0;
+		eglChooseConfig(m_Display, configAttributes, &m_Config, 1, &configCount);
+		HZ_CORE_ASSERT(configCount > 0, "No EGL config supports pbuffer surfaces!");
+
+		// La pbuffer fa da framebuffer di default, con le dimensioni richieste per la finestra.
+		const EGLint surfaceAttributes[] = { EGL_WIDTH, (EGLint)m_Width, EGL_HEIGHT, (EGLint)m_Height, EGL_NONE };
+		m_Surface = eglCreatePbufferSurface(m_Display, m_Config, surfaceAttributes);
+		HZ_CORE_ASSERT(m_Surface != EGL_NO_SURFACE, "Could not create the EGL pbuffer surface!");
+
+		m_Context = eglCreateContext(m_Display, m_Config, EGL_NO_CONTEXT, s_ContextAttributes);
+		HZ_CORE_ASSERT(m_Context != EGL_NO_CONTEXT, "Could not create an OpenGL 4.5 context with EGL!");
+
+		eglMakeCurrent(m_Display, m_Surface, m_Surface, m_Context);
+
+		int status = gladLoadGLLoader((GLADloadproc)eglGetProcAddress);
+		HZ_CORE_ASSERT(status, "Failed to initialize Glad!");
+
+		HZ_CORE_INFO("OpenGL Info (headless, EGL {0}.{1}):", major, minor);
+		HZ_CORE_INFO("  Vendor: {0}", (const char*)glGetString(GL_VENDOR));
+		HZ_CORE_INFO("  Renderer: {0}", (const char*)glGetString(GL_RENDERER));
+		HZ_CORE_INFO("  Version: {0}", (const char*)glGetString(GL_VERSION));
+
+		OpenGLExtensions::Load((OpenGLExtensions::LoadProc)eglGetProcAddress);
+	}
+
+	void OpenGLHeadlessContext::SwapBuffers()
+	{
+		// Su una pbuffer lo swap non fa nulla: aspettiamo che il frame sia stato eseguito davvero,
+		// altrimenti il driver accumulerebbe lavoro e i tempi per frame misurati non sarebbero realistici.
+		eglSwapBuffers(m_Display, m_Surface);
+		glFinish();
+	}
+
+	GraphicsContext* OpenGLHeadlessContext::CreateSharedContext()
+	{
+		// Stessa config del contesto principale, con una pbuffer di 1x1 come surface (il contesto non disegna a schermo).
+		OpenGLHeadlessContext* shared = new OpenGLHeadlessContext(1, 1);
+		shared->m_OwnsDisplay = false;
+		shared->m_Display = m_Display;
+		shared->m_Config = m_Config;
+
+		const EGLint surfaceAttributes[] = { EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE };
+		shared->m_Surface = eglCreatePbufferSurface(m_Display, m_Config, surfaceAttributes);
+		shared->m_Context = eglCreateContext(m_Display, m_Config, m_Context, s_ContextAttributes);
+		if (shared->m_Surface == EGL_NO_SURFACE || shared->m_Context == EGL_NO_CONTEXT)
+		{
+			delete shared;
+			return nullptr;
+		}
+		return shared;
+	}
+
+	void OpenGLHeadlessContext::MakeCurrent()
+	{
+		// L'API corrente di EGL è per thread: su un thread nuovo vale OpenGL ES.
+		eglBindAPI(EGL_OPENGL_API);
+		eglMakeCurrent(m_Display, m_Surface, m_Surface, m_Context);
+	}
+
+	void OpenGLHeadlessContext::ReleaseCurrent()
+	{
+		eglMakeCurrent(m_Display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+	}
+
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "GameEngine/Renderer/GraphicsContext.h"
+
+#include <EGL/egl.h>
+
+namespace GameEngine {
+
+	// Contesto OpenGL 4.5 core creato direttamente con EGL, senza finestra né server grafico.
+	// Con Mesa funziona anche senza GPU (llvmpipe), ad es. sulle macchine di CI.
+	class OpenGLHeadlessContext : public GraphicsContext
+	{
+	public:
+		OpenGLHeadlessContext(uint32_t width, uint32_t height);
+		virtual ~OpenGLHeadlessContext();
+
+		virtual void Init() override;
+		virtual void SwapBuffers() override;
+
+		virtual GraphicsContext* CreateSharedContext() override;
+		virtual void MakeCurrent() override;
+		virtual void ReleaseCurrent() override;
+
+	private:
+		uint32_t m_Width, m_Height;
+
+		// Il display EGL è del contesto principale: i contesti condivisi lo usano senza terminarlo.
+		bool m_OwnsDisplay = true;
+		EGLDisplay m_Display = EGL_NO_DISPLAY;
+		EGLConfig m_Config = nullptr;
+		EGLSurface m_Surface = EGL_NO_SURFACE;
+		EGLContext m_Context = EGL_NO_CONTEXT;
+	};
+
+}
@@ -1,13 +1,25 @@
 #include "hzpch.h"
 #include "OpenGLBuffer.h"
 
+#include "GameEngine/Renderer/Renderer.h"
+
 #include <glad/glad.h>
 
 namespace GameEngine {
 
 	#pragma region Vertex Buffer
-	OpenGLVertexBuffer::OpenGLVertexBuffer(float* vertices, uint32_t size)
+	OpenGLVertexBuffer::OpenGLVertexBuffer(uint32_t size)
+	{
+		glCreateBuffers(1, &m_RendererID);
+		glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+		// GL_DYNAMIC_DRAW: il contenuto verrà riscritto spesso (ad es. ogni frame dal batch renderer).
+		glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
+	}
+
+	OpenGLVertexBuffer::OpenGLVertexBuffer(const void* vertices, uint32_t size)
+		: m_Size(size)
 	{
+		Renderer::GetStats().BufferBytesUploaded += size;
 		glCreateBuffers(1, &m_RendererID);
 		glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
 		glBufferData(GL_ARRAY_BUFFER, size, vertices, GL_STATIC_DRAW);
@@ -27,16 +39,51 @@ namespace GameEngine {
 	{
 		glBindBuffer(GL_ARRAY_BUFFER, 0);
 	}
+
+	void OpenGLVertexBuffer::SetData(const void* data, uint32_t size)
+	{
+		m_Size = size;
+		Renderer::GetStats().BufferBytesUploaded += size;
+		glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+		glBufferSubData(GL_ARRAY_BUFFER, 0, size, data);
+	}
+
+	void* OpenGLVertexBuffer::Map(uint32_t size)
+	{
+		m_Size = size;
+		Renderer::GetStats().BufferBytesUploaded += size;
+		return glMapNamedBufferRange(m_RendererID, 0, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+	}
+
+	void OpenGLVertexBuffer::Unmap()
+	{
+		glUnmapNamedBuffer(m_RendererID);
+	}
 	#pragma endregion
 
 	#pragma region Index Buffer
 
 	OpenGLIndexBuffer::OpenGLIndexBuffer(uint32_t* indices, uint32_t count)
-		: m_Count(count)
+		: m_Count(count), m_IndexSize(sizeof(uint32_t))
 	{
+		uint32_t maxIndex = 0;
+		for (uint32_t i = 0; i < count; i++)
+			maxIndex = std::max(maxIndex, indices[i]);
+
+		// Upload DSA: legare GL_ELEMENT_ARRAY_BUFFER qui cambierebbe l'index buffer del VAO attivo.
 		glCreateBuffers(1, &m_RendererID);
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_RendererID);
-		glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(uint32_t), indices, GL_STATIC_DRAW);
+		Renderer::GetStats().BufferBytesUploaded += count * (maxIndex <= UINT16_MAX ? sizeof(uint16_t) : sizeof(uint32_t));
+
+		if (maxIndex <= UINT16_MAX)
+		{
+			std::vector<uint16_t> shortIndices(indices, indices + count);
+			m_IndexSize = sizeof(uint16_t);
+			glNamedBufferData(m_RendererID, count * sizeof(uint16_t), shortIndices.data(), GL_STATIC_DRAW);
+		}
+		else
+		{
+			glNamedBufferData(m_RendererID, count * sizeof(uint32_t), indices, GL_STATIC_DRAW);
+		}
 	}
 
 	OpenGLIndexBuffer::~OpenGLIndexBuffer()
@@ -7,17 +7,26 @@ namespace GameEngine {
 	class OpenGLVertexBuffer : public VertexBuffer
 	{
 	public:
-		OpenGLVertexBuffer(float* vertices, uint32_t size);
+		OpenGLVertexBuffer(uint32_t size);
+		OpenGLVertexBuffer(const void* vertices, uint32_t size);
 		virtual ~OpenGLVertexBuffer();
 
 		virtual void Bind() const override;
 		virtual void Unbind() const override;
 
+		virtual void SetData(const void* data, uint32_t size) override;
+
+		virtual void* Map(uint32_t size) override;
+		virtual void Unmap() override;
+
+		virtual uint32_t GetSize() const override { return m_Size; }
+
 		virtual const BufferLayout& GetLayout() const override { return m_Layout; }
 		virtual void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
 
 	private:
 		uint32_t m_RendererID;
+		uint32_t m_Size = 0;
 		BufferLayout m_Layout;
 	};
 
@@ -31,10 +40,12 @@ namespace GameEngine {
 		virtual void Unbind() const override;
 
 		virtual uint32_t GetCount() const { return m_Count; }
+		virtual uint32_t GetIndexSize() const override { return m_IndexSize; }
 
 	private:
 		uint32_t m_RendererID;
 		uint32_t m_Count;
+		uint32_t m_IndexSize;
 	};
 
 }
\ No newline at end of file
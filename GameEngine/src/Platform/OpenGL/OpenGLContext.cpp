@@ -1,17 +1,24 @@
 #include "hzpch.h"
 #include "OpenGLContext.h"
+#include "OpenGLExtensions.h"
 
 #include "GLFW/glfw3.h"
 #include <glad/glad.h>
 
 namespace GameEngine {
 
-	OpenGLContext::OpenGLContext(GLFWwindow* windowHandle)
-		: m_WindowHandle(windowHandle)
+	OpenGLContext::OpenGLContext(GLFWwindow* windowHandle, bool ownsWindow)
+		: m_WindowHandle(windowHandle), m_OwnsWindow(ownsWindow)
 	{
 		HZ_CORE_ASSERT(m_WindowHandle, "Window handle is null!")
 	}
 
+	OpenGLContext::~OpenGLContext()
+	{
+		if (m_OwnsWindow)
+			glfwDestroyWindow(m_WindowHandle);
+	}
+
 	void OpenGLContext::Init()
 	{
 		// Rende il contesto di m_Window il contesto OpenGL corrente sul thread che sta eseguendo la chiamata.
@@ -24,6 +31,8 @@ namespace GameEngine {
 		HZ_CORE_INFO("  Vendor: {0}", (const char*)glGetString(GL_VENDOR));
 		HZ_CORE_INFO("  Renderer: {0}", (const char*)glGetString(GL_RENDERER));
 		HZ_CORE_INFO("  Version: {0}", (const char*)glGetString(GL_VERSION));
+
+		OpenGLExtensions::Load((OpenGLExtensions::LoadProc)glfwGetProcAddress);
 	}
 
 	void OpenGLContext::SwapBuffers()
@@ -38,4 +47,28 @@ namespace GameEngine {
 		// Con il double buffering, disegni dietro le quinte e poi mostri tutto in un colpo solo quando il frame  completo.
 		glfwSwapBuffers(m_WindowHandle);
 	}
+
+	GraphicsContext* OpenGLContext::CreateSharedContext()
+	{
+		// GLFW crea un contesto solo insieme a una finestra: ne usiamo una nascosta di 1x1, con gli stessi hint
+		// (versione e profilo) della finestra principale. L'ultimo argomento  il contesto con cui condividere le risorse.
+		glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+		GLFWwindow* window = glfwCreateWindow(1, 1, "", nullptr, m_WindowHandle);
+		glfwWindowHint(GLFW_VISIBLE, GLFW_TRUE);
+		if (!window)
+			return nullptr;
+
+		// Glad non va ricaricato: i puntatori a funzione valgono per tutti i contesti dello stesso driver.
+		return new OpenGLContext(window, true);
+	}
+
+	void OpenGLContext::MakeCurrent()
+	{
+		glfwMakeContextCurrent(m_WindowHandle);
+	}
+
+	void OpenGLContext::ReleaseCurrent()
+	{
+		glfwMakeContextCurrent(nullptr);
+	}
 }
\ No newline at end of file
@@ -8,13 +8,20 @@ namespace GameEngine {
 	class OpenGLContext : public GraphicsContext
 	{
 	public:
-		OpenGLContext(GLFWwindow* windowHandle);
+		// Con ownsWindow il contesto distrugge la finestra (nascosta) creata per un contesto condiviso.
+		OpenGLContext(GLFWwindow* windowHandle, bool ownsWindow = false);
+		virtual ~OpenGLContext();
 
 		virtual void Init() override;
 		virtual void SwapBuffers() override;
 
+		virtual GraphicsContext* CreateSharedContext() override;
+		virtual void MakeCurrent() override;
+		virtual void ReleaseCurrent() override;
+
 	private:
 		GLFWwindow* m_WindowHandle;
+		bool m_OwnsWindow;
 	};
 
 }
\ No newline at end of file
@@ -0,0 +1,66 @@
+#include "hzpch.h"
+#include "OpenGLExtensions.h"
+
+#include <glad/glad.h>
+
+namespace GameEngine {
+
+	typedef GLuint64 (APIENTRYP PFNGLGETTEXTUREHANDLEARBPROC)(GLuint texture);
+	typedef void (APIENTRYP PFNGLMAKETEXTUREHANDLERESIDENTARBPROC)(GLuint64 handle);
+	typedef void (APIENTRYP PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC)(GLuint64 handle);
+
+	static PFNGLGETTEXTUREHANDLEARBPROC s_GetTextureHandleARB = nullptr;
+	static PFNGLMAKETEXTUREHANDLERESIDENTARBPROC s_MakeTextureHandleResidentARB = nullptr;
+	static PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC s_MakeTextureHandleNonResidentARB = nullptr;
+
+	static bool s_BindlessTexture = false;
+
+	static bool IsExtensionSupported(const char* name)
+	{
+		GLint count = 0;
+		glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+		for (GLint i = 0; i < count; i++)
+		{
+			if (strcmp((const char*)glGetStringi(GL_EXTENSIONS, i), name) == 0)
+				return true;
+		}
+		return false;
+	}
+
+	void OpenGLExtensions::Load(LoadProc load)
+	{
+		if (IsExtensionSupported("GL_ARB_bindless_texture"))
+		{
+			s_GetTextureHandleARB = (PFNGLGETTEXTUREHANDLEARBPROC)load("glGetTextureHandleARB");
+			s_MakeTextureHandleResidentARB = (PFNGLMAKETEXTUREHANDLERESIDENTARBPROC)load("glMakeTextureHandleResidentARB");
+			s_MakeTextureHandleNonResidentARB = (PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC)load("glMakeTextureHandleNonResidentARB");
+		}
+		s_BindlessTexture = s_GetTextureHandleARB && s_MakeTextureHandleResidentARB && s_MakeTextureHandleNonResidentARB;
+
+		HZ_CORE_INFO("  Bindless textures: {0}", s_BindlessTexture ? "yes" : "no");
+	}
+
+	bool OpenGLExtensions::HasBindlessTexture()
+	{
+		return s_BindlessTexture;
+	}
+
+	uint64_t OpenGLExtensions::GetTextureHandle(uint32_t texture)
+	{
+		HZ_CORE_ASSERT(s_BindlessTexture, "GL_ARB_bindless_texture is not available!");
+		return s_GetTextureHandleARB(texture);
+	}
+
+	void OpenGLExtensions::MakeTextureHandleResident(uint64_t handle)
+	{
+		HZ_CORE_ASSERT(s_BindlessTexture, "GL_ARB_bindless_texture is not available!");
+		s_MakeTextureHandleResidentARB(handle);
+	}
+
+	void OpenGLExtensions::MakeTextureHandleNonResident(uint64_t handle)
+	{
+		HZ_CORE_ASSERT(s_BindlessTexture, "GL_ARB_bindless_texture is not available!");
+		s_MakeTextureHandleNonResidentARB(handle);
+	}
+
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+
+namespace GameEngine {
+
+	// Estensioni usate dal motore che non fanno parte del loader generato con Glad (solo core 4.5).
+	// I contesti chiamano Load subito dopo gladLoadGLLoader, con la stessa funzione di risoluzione dei simboli.
+	class OpenGLExtensions
+	{
+	public:
+		using LoadProc = void* (*)(const char* name);
+
+		static void Load(LoadProc load);
+
+		// GL_ARB_bindless_texture
+		static bool HasBindlessTexture();
+		static uint64_t GetTextureHandle(uint32_t texture);
+		static void MakeTextureHandleResident(uint64_t handle);
+		static void MakeTextureHandleNonResident(uint64_t handle);
+	};
+
+}
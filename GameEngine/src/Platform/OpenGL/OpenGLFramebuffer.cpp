@@ -0,0 +1,139 @@
+#include "hzpch.h"
+#include "OpenGLFramebuffer.h"
+
+#include "GameEngine/Renderer/Renderer.h"
+
+#include <glad/glad.h>
+
+namespace GameEngine {
+
+	// Limite di sicurezza contro dimensioni assurde (ad es. una finestra minimizzata che riporta valori spuri).
+	static const uint32_t s_MaxFramebufferSize = 8192;
+
+	static bool IsDepthFormat(FramebufferTextureFormat format)
+	{
+		return format == FramebufferTextureFormat::Depth24Stencil8;
+	}
+
+	static GLenum FramebufferTextureFormatToOpenGL(FramebufferTextureFormat format)
+	{
+		switch (format)
+		{
+			case FramebufferTextureFormat::RGBA8:			return GL_RGBA8;
+			case FramebufferTextureFormat::RGBA16F:			return GL_RGBA16F;
+			case FramebufferTextureFormat::Depth24Stencil8:	return GL_DEPTH24_STENCIL8;
+		}
+		HZ_CORE_ASSERT(false, "Unknown FramebufferTextureFormat!");
+		return 0;
+	}
+
+	OpenGLFramebuffer::OpenGLFramebuffer(const FramebufferSpecification& spec)
+		: m_Specification(spec)
+	{
+		Invalidate();
+	}
+
+	OpenGLFramebuffer::~OpenGLFramebuffer()
+	{
+		Release();
+	}
+
+	void OpenGLFramebuffer::Release()
+	{
+		glDeleteFramebuffers(1, &m_RendererID);
+		glDeleteTextures((GLsizei)m_ColorAttachments.size(), m_ColorAttachments.data());
+		glDeleteTextures(1, &m_DepthAttachment);
+
+		m_RendererID = 0;
+		m_ColorAttachments.clear();
+		m_DepthAttachment = 0;
+	}
+
+	void OpenGLFramebuffer::Invalidate()
+	{
+		if (m_RendererID)
+			Release();
+
+		glCreateFramebuffers(1, &m_RendererID);
+
+		std::vector<GLenum> drawBuffers;
+		for (FramebufferTextureFormat format : m_Specification.Attachments)
+		{
+			uint32_t texture;
+			glCreateTextures(GL_TEXTURE_2D, 1, &texture);
+			glTextureStorage2D(texture, 1, FramebufferTextureFormatToOpenGL(format), m_Specification.Width, m_Specification.Height);
+
+			if (IsDepthFormat(format))
+			{
+				HZ_CORE_ASSERT(!m_DepthAttachment, "Framebuffer supports a single depth attachment!");
+				glNamedFramebufferTexture(m_RendererID, GL_DEPTH_STENCIL_ATTACHMENT, texture, 0);
+				m_DepthAttachment = texture;
+				continue;
+			}
+
+			// Lineare: con la risoluzione dinamica il color attachment viene scalato fino alla finestra.
+			glTextureParameteri(texture, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+			glTextureParameteri(texture, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+			glTextureParameteri(texture, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+			glTextureParameteri(texture, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+			GLenum attachment = GL_COLOR_ATTACHMENT0 + (GLenum)m_ColorAttachments.size();
+			glNamedFramebufferTexture(m_RendererID, attachment, texture, 0);
+			m_ColorAttachments.push_back(texture);
+			drawBuffers.push_back(attachment);
+		}
+
+		if (drawBuffers.empty())
+			glNamedFramebufferDrawBuffer(m_RendererID, GL_NONE);
+		else
+			glNamedFramebufferDrawBuffers(m_RendererID, (GLsizei)drawBuffers.size(), drawBuffers.data());
+
+		HZ_CORE_ASSERT(glCheckNamedFramebufferStatus(m_RendererID, GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE, "Framebuffer is incomplete!");
+	}
+
+	void OpenGLFramebuffer::Bind()
+	{
+		Renderer::GetStats().StateChanges++;
+		glBindFramebuffer(GL_FRAMEBUFFER, m_RendererID);
+		glViewport(0, 0, m_Specification.Width, m_Specification.Height);
+	}
+
+	void OpenGLFramebuffer::Unbind()
+	{
+		Renderer::GetStats().StateChanges++;
+		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	}
+
+	void OpenGLFramebuffer::Resize(uint32_t width, uint32_t height)
+	{
+		if (width == 0 || height == 0 || width > s_MaxFramebufferSize || height > s_MaxFramebufferSize)
+		{
+			HZ_CORE_WARN("Attempted to resize framebuffer to {0}, {1}", width, height);
+			return;
+		}
+
+		if (width == m_Specification.Width && height == m_Specification.Height)
+			return;
+
+		m_Specification.Width = width;
+		m_Specification.Height = height;
+		Invalidate();
+	}
+
+	void OpenGLFramebuffer::ClearColorAttachment(uint32_t index, const glm::vec4& value)
+	{
+		HZ_CORE_ASSERT(index < m_ColorAttachments.size(), "Invalid color attachment index!");
+		const float color[4] = { value.r, value.g, value.b, value.a };
+		glClearNamedFramebufferfv(m_RendererID, GL_COLOR, (GLint)index, color);
+	}
+
+	void OpenGLFramebuffer::BlitToScreen(uint32_t srcWidth, uint32_t srcHeight, uint32_t dstWidth, uint32_t dstHeight) const
+	{
+		glNamedFramebufferReadBuffer(m_RendererID, GL_COLOR_ATTACHMENT0);
+		glBlitNamedFramebuffer(m_RendererID, 0,
+			0, 0, srcWidth, srcHeight,
+			0, 0, dstWidth, dstHeight,
+			GL_COLOR_BUFFER_BIT, GL_LINEAR);
+	}
+
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "GameEngine/Renderer/Framebuffer.h"
+
+namespace GameEngine {
+
+	class OpenGLFramebuffer : public Framebuffer
+	{
+	public:
+		OpenGLFramebuffer(const FramebufferSpecification& spec);
+		virtual ~OpenGLFramebuffer();
+
+		virtual void Bind() override;
+		virtual void Unbind() override;
+
+		virtual void Resize(uint32_t width, uint32_t height) override;
+
+		virtual void ClearColorAttachment(uint32_t index, const glm::vec4& value) override;
+
+		virtual void BlitToScreen(uint32_t srcWidth, uint32_t srcHeight, uint32_t dstWidth, uint32_t dstHeight) const override;
+
+		virtual uint32_t GetColorAttachmentRendererID(uint32_t index = 0) const override { return m_ColorAttachments[index]; }
+		virtual const FramebufferSpecification& GetSpecification() const override { return m_Specification; }
+
+	private:
+		void Invalidate();
+		void Release();
+
+	private:
+		uint32_t m_RendererID = 0;
+		FramebufferSpecification m_Specification;
+
+		std::vector<uint32_t> m_ColorAttachments;
+		uint32_t m_DepthAttachment = 0;
+	};
+
+}
@@ -0,0 +1,31 @@
+#include "hzpch.h"
+#include "OpenGLGPUFence.h"
+
+#include <glad/glad.h>
+
+namespace GameEngine {
+
+	OpenGLGPUFence::OpenGLGPUFence()
+	{
+		m_Sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		// Senza flush i comandi, fence compreso, potrebbero restare nel contesto che li ha generati
+		// e un altro contesto aspetterebbe per sempre.
+		glFlush();
+	}
+
+	OpenGLGPUFence::~OpenGLGPUFence()
+	{
+		glDeleteSync(m_Sync);
+	}
+
+	bool OpenGLGPUFence::IsSignaled()
+	{
+		if (m_Signaled)
+			return true;
+
+		GLenum result = glClientWaitSync(m_Sync, 0, 0);
+		m_Signaled = result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED;
+		return m_Signaled;
+	}
+
+}
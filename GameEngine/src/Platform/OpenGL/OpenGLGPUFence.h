@@ -0,0 +1,22 @@
+#pragma once
+
+#include "GameEngine/Renderer/GPUFence.h"
+
+struct __GLsync;
+
+namespace GameEngine {
+
+	class OpenGLGPUFence : public GPUFence
+	{
+	public:
+		OpenGLGPUFence();
+		virtual ~OpenGLGPUFence();
+
+		virtual bool IsSignaled() override;
+
+	private:
+		__GLsync* m_Sync;
+		bool m_Signaled = false;
+	};
+
+}
@@ -0,0 +1,55 @@
+#include "hzpch.h"
+#include "OpenGLGPUTimer.h"
+
+#include <glad/glad.h>
+
+namespace GameEngine {
+
+	OpenGLGPUTimer::OpenGLGPUTimer()
+	{
+		glCreateQueries(GL_TIME_ELAPSED, QueryCount, m_Queries);
+	}
+
+	OpenGLGPUTimer::~OpenGLGPUTimer()
+	{
+		glDeleteQueries(QueryCount, m_Queries);
+	}
+
+	void OpenGLGPUTimer::Begin()
+	{
+		// Tutte le query sono in volo: aspettiamo la più vecchia invece di sovrascriverla.
+		if (m_Issued - m_Resolved == QueryCount)
+		{
+			GLuint64 elapsed;
+			glGetQueryObjectui64v(m_Queries[m_Resolved % QueryCount], GL_QUERY_RESULT, &elapsed);
+			m_Milliseconds = (float)(elapsed / 1.0e6);
+			m_SampleIndex++;
+			m_Resolved++;
+		}
+
+		glBeginQuery(GL_TIME_ELAPSED, m_Queries[m_Issued % QueryCount]);
+	}
+
+	void OpenGLGPUTimer::End()
+	{
+		glEndQuery(GL_TIME_ELAPSED);
+		m_Issued++;
+
+		// Raccogliamo senza bloccare tutti i risultati già pronti, in ordine.
+		while (m_Resolved < m_Issued)
+		{
+			uint32_t query = m_Queries[m_Resolved % QueryCount];
+			GLint available = GL_FALSE;
+			glGetQueryObjectiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+			if (!available)
+				break;
+
+			GLuint64 elapsed;
+			glGetQueryObjectui64v(query, GL_QUERY_RESULT, &elapsed);
+			m_Milliseconds = (float)(elapsed / 1.0e6);
+			m_SampleIndex++;
+			m_Resolved++;
+		}
+	}
+
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "GameEngine/Renderer/GPUTimer.h"
+
+namespace GameEngine {
+
+	class OpenGLGPUTimer : public GPUTimer
+	{
+	public:
+		OpenGLGPUTimer();
+		virtual ~OpenGLGPUTimer();
+
+		virtual void Begin() override;
+		virtual void End() override;
+
+		virtual float GetMilliseconds() const override { return m_Milliseconds; }
+		virtual uint32_t GetSampleIndex() const override { return m_SampleIndex; }
+
+	private:
+		// Più query in volo: la GPU può essere indietro di alcuni frame rispetto alla CPU.
+		static const uint32_t QueryCount = 4;
+
+		uint32_t m_Queries[QueryCount];
+		uint32_t m_Issued = 0;		// query avviate in totale
+		uint32_t m_Resolved = 0;	// query di cui abbiamo già letto il risultato
+		float m_Milliseconds = 0.0f;
+		uint32_t m_SampleIndex = 0;
+	};
+
+}
@@ -1,10 +1,25 @@
 #include "hzpch.h"
 #include "OpenGLRendererAPI.h"
 
+#include "GameEngine/Renderer/Renderer.h"
+
 #include <glad/glad.h>
 
 namespace GameEngine {
 
+	void OpenGLRendererAPI::Init()
+	{
+		// Necessario per gli sprite con trasparenza (alpha blending classico).
+		glEnable(GL_BLEND);
+		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	}
+
+	void OpenGLRendererAPI::SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+	{
+		Renderer::GetStats().StateChanges++;
+		glViewport(x, y, width, height);
+	}
+
 	void OpenGLRendererAPI::SetClearColor(const glm::vec4& color)
 	{
 		glClearColor(color.r, color.g, color.b, color.a);
@@ -15,9 +30,51 @@ namespace GameEngine {
 		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 	}
 
-	void OpenGLRendererAPI::DrawIndexed(const Ref<VertexArray>& vertexArray)
+	void OpenGLRendererAPI::DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount)
+	{
+		const Ref<IndexBuffer>& indexBuffer = vertexArray->GetIndexBuffers();
+		uint32_t count = indexCount ? indexCount : indexBuffer->GetCount();
+		GLenum type = indexBuffer->GetIndexSize() == sizeof(uint16_t) ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+		glDrawElements(GL_TRIANGLES, count, type, nullptr);
+
+		Renderer::Statistics& stats = Renderer::GetStats();
+		stats.DrawCalls++;
+		stats.Indices += count;
+		stats.Vertices += vertexArray->GetVertexCount();
+	}
+
+	void OpenGLRendererAPI::DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t instanceCount, uint32_t indexCount)
+	{
+		const Ref<IndexBuffer>& indexBuffer = vertexArray->GetIndexBuffers();
+		uint32_t count = indexCount ? indexCount : indexBuffer->GetCount();
+		GLenum type = indexBuffer->GetIndexSize() == sizeof(uint16_t) ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+		glDrawElementsInstanced(GL_TRIANGLES, count, type, nullptr, instanceCount);
+
+		Renderer::Statistics& stats = Renderer::GetStats();
+		stats.DrawCalls++;
+		stats.Indices += count * instanceCount;
+		stats.Vertices += vertexArray->GetVertexCount() * instanceCount;
+	}
+
+	void OpenGLRendererAPI::DrawIndexedIndirect(const Ref<VertexArray>& vertexArray, const Ref<StorageBuffer>& commands, uint32_t drawCount, uint32_t offset)
 	{
-		glDrawElements(GL_TRIANGLES, vertexArray->GetIndexBuffers()->GetCount(), GL_UNSIGNED_INT, nullptr);
+		const Ref<IndexBuffer>& indexBuffer = vertexArray->GetIndexBuffers();
+		GLenum type = indexBuffer->GetIndexSize() == sizeof(uint16_t) ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+		glBindBuffer(GL_DRAW_INDIRECT_BUFFER, commands->GetRendererID());
+		glMultiDrawElementsIndirect(GL_TRIANGLES, type, (const void*)(uintptr_t)offset, drawCount, 0);
+
+		// Indici e vertici sono nel buffer dei comandi, sulla GPU: qui contiamo solo la chiamata.
+		Renderer::Statistics& stats = Renderer::GetStats();
+		stats.DrawCalls++;
+	}
+
+	void OpenGLRendererAPI::DispatchCompute(uint32_t groupsX, uint32_t groupsY, uint32_t groupsZ)
+	{
+		glDispatchCompute(groupsX, groupsY, groupsZ);
+		// I risultati del compute vengono letti come storage buffer dagli shader e come comandi da glMultiDrawElementsIndirect.
+		glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT | GL_COMMAND_BARRIER_BIT);
+
+		Renderer::GetStats().ComputeDispatches++;
 	}
 
 }
\ No newline at end of file
@@ -1,6 +1,8 @@
 ﻿#include "hzpch.h"
 #include "OpenGLShader.h"
 
+#include "GameEngine/Renderer/Renderer.h"
+
 #include <glad/glad.h>
 
 #include <glm/gtc/type_ptr.hpp>
@@ -120,6 +122,56 @@ namespace GameEngine {
 		glDetachShader(program, fragmentShader);
 	}
 
+	OpenGLShader::OpenGLShader(const std::string& computeSource)
+	{
+		// Stessi passaggi del costruttore con vertex e fragment shader, con un solo stage.
+		GLuint computeShader = glCreateShader(GL_COMPUTE_SHADER);
+		const GLchar* source = computeSource.c_str();
+		glShaderSource(computeShader, 1, &source, 0);
+		glCompileShader(computeShader);
+
+		GLint isCompiled = 0;
+		glGetShaderiv(computeShader, GL_COMPILE_STATUS, &isCompiled);
+		if (isCompiled == GL_FALSE)
+		{
+			GLint maxLength = 0;
+			glGetShaderiv(computeShader, GL_INFO_LOG_LENGTH, &maxLength);
+
+			std::vector<GLchar> infoLog(maxLength);
+			glGetShaderInfoLog(computeShader, maxLength, &maxLength, &infoLog[0]);
+			glDeleteShader(computeShader);
+
+			HZ_CORE_ERROR("{0}", infoLog.data());
+			HZ_CORE_ASSERT(false, "Compute shader compilation failure!");
+			return;
+		}
+
+		m_RendererID = glCreateProgram();
+		GLuint program = m_RendererID;
+		glAttachShader(program, computeShader);
+		glLinkProgram(program);
+
+		GLint isLinked = 0;
+		glGetProgramiv(program, GL_LINK_STATUS, (int*)&isLinked);
+		if (isLinked == GL_FALSE)
+		{
+			GLint maxLength = 0;
+			glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
+
+			std::vector<GLchar> infoLog(maxLength);
+			glGetProgramInfoLog(program, maxLength, &maxLength, &infoLog[0]);
+			glDeleteProgram(program);
+			glDeleteShader(computeShader);
+
+			HZ_CORE_ERROR("{0}", infoLog.data());
+			HZ_CORE_ASSERT(false, "Compute shader link failure!");
+			return;
+		}
+
+		glDetachShader(program, computeShader);
+		glDeleteShader(computeShader);
+	}
+
 	OpenGLShader::~OpenGLShader()
 	{
 		glDeleteProgram(m_RendererID);
@@ -127,6 +179,9 @@ namespace GameEngine {
 
 	void OpenGLShader::Bind() const
 	{
+		Renderer::Statistics& stats = Renderer::GetStats();
+		stats.ShaderBinds++;
+		stats.StateChanges++;
 		glUseProgram(m_RendererID);
 	}
 
@@ -135,12 +190,43 @@ namespace GameEngine {
 		glUseProgram(0);
 	}
 
+	void OpenGLShader::SetInt(const std::string& name, int value)
+	{
+		UploadUniformInt(name, value);
+	}
+
+	void OpenGLShader::SetIntArray(const std::string& name, int* values, uint32_t count)
+	{
+		UploadUniformIntArray(name, values, count);
+	}
+
+	void OpenGLShader::SetFloat3(const std::string& name, const glm::vec3& value)
+	{
+		UploadUniformFloat3(name, value);
+	}
+
+	void OpenGLShader::SetFloat4(const std::string& name, const glm::vec4& value)
+	{
+		UploadUniformFloat4(name, value);
+	}
+
+	void OpenGLShader::SetMat4(const std::string& name, const glm::mat4& value)
+	{
+		UploadUniformMat4(name, value);
+	}
+
 	void OpenGLShader::UploadUniformInt(const std::string& name, int value)
 	{
 		GLint location = glGetUniformLocation(m_RendererID, name.c_str());
 		glUniform1i(location, value);
 	}
 
+	void OpenGLShader::UploadUniformIntArray(const std::string& name, int* values, uint32_t count)
+	{
+		GLint location = glGetUniformLocation(m_RendererID, name.c_str());
+		glUniform1iv(location, count, values);
+	}
+
 	void OpenGLShader::UploadUniformFloat(const std::string& name, float value)
 	{
 		GLint location = glGetUniformLocation(m_RendererID, name.c_str());
@@ -0,0 +1,36 @@
+#include "hzpch.h"
+#include "OpenGLStorageBuffer.h"
+
+#include "GameEngine/Renderer/Renderer.h"
+
+#include <glad/glad.h>
+
+namespace GameEngine {
+
+	OpenGLStorageBuffer::OpenGLStorageBuffer(uint32_t size, uint32_t binding)
+		: m_Size(size)
+	{
+		glCreateBuffers(1, &m_RendererID);
+		glNamedBufferData(m_RendererID, size, nullptr, GL_DYNAMIC_DRAW);
+		glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, m_RendererID);
+	}
+
+	OpenGLStorageBuffer::~OpenGLStorageBuffer()
+	{
+		glDeleteBuffers(1, &m_RendererID);
+	}
+
+	void OpenGLStorageBuffer::SetData(const void* data, uint32_t size, uint32_t offset)
+	{
+		HZ_CORE_ASSERT(offset + size <= m_Size, "StorageBuffer::SetData out of range!");
+		Renderer::GetStats().BufferBytesUploaded += size;
+		glNamedBufferSubData(m_RendererID, offset, size, data);
+	}
+
+	void OpenGLStorageBuffer::Bind(uint32_t binding) const
+	{
+		Renderer::GetStats().StateChanges++;
+		glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, m_RendererID);
+	}
+
+}
@@ -0,0 +1,97 @@
+#include "hzpch.h"
+#include "OpenGLTexture.h"
+
+#include "GameEngine/Renderer/Renderer.h"
+#include "OpenGLExtensions.h"
+
+#include <glad/glad.h>
+
+namespace GameEngine {
+
+	OpenGLTexture2D::OpenGLTexture2D(uint32_t width, uint32_t height)
+		: m_Width(width), m_Height(height)
+	{
+		glCreateTextures(GL_TEXTURE_2D, 1, &m_RendererID);
+		// Allochiamo lo storage immutabile una sola volta: i dati verranno caricati con SetData().
+		glTextureStorage2D(m_RendererID, 1, GL_RGBA8, m_Width, m_Height);
+
+		glTextureParameteri(m_RendererID, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		glTextureParameteri(m_RendererID, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+		// Con un atlas i bordi delle regioni sono gestiti dal padding, quindi il clamp è sufficiente.
+		glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	}
+
+	OpenGLTexture2D::~OpenGLTexture2D()
+	{
+		// Una texture con un handle residente non può essere distrutta.
+		if (m_BindlessHandle)
+			OpenGLExtensions::MakeTextureHandleNonResident(m_BindlessHandle);
+		glDeleteTextures(1, &m_RendererID);
+	}
+
+	void OpenGLTexture2D::SetData(void* data, uint32_t size)
+	{
+		HZ_CORE_ASSERT(size == m_Width * m_Height * 4, "Data must be entire texture!");
+		Renderer::GetStats().BufferBytesUploaded += size;
+		glTextureSubImage2D(m_RendererID, 0, 0, 0, m_Width, m_Height, GL_RGBA, GL_UNSIGNED_BYTE, data);
+	}
+
+	void OpenGLTexture2D::Bind(uint32_t slot) const
+	{
+		Renderer::GetStats().StateChanges++;
+		glBindTextureUnit(slot, m_RendererID);
+	}
+
+	uint64_t OpenGLTexture2D::GetBindlessHandle() const
+	{
+		if (m_BindlessHandle || !OpenGLExtensions::HasBindlessTexture())
+			return m_BindlessHandle;
+
+		// Dopo la creazione dell'handle i parametri di sampling della texture non sono più modificabili.
+		m_BindlessHandle = OpenGLExtensions::GetTextureHandle(m_RendererID);
+		OpenGLExtensions::MakeTextureHandleResident(m_BindlessHandle);
+		return m_BindlessHandle;
+	}
+
+	OpenGLTextureArray::OpenGLTextureArray(uint32_t width, uint32_t height, uint32_t layers)
+		: m_Width(width), m_Height(height), m_Layers(layers)
+	{
+		glCreateTextures(GL_TEXTURE_2D_ARRAY, 1, &m_RendererID);
+		glTextureStorage3D(m_RendererID, 1, GL_RGBA8, m_Width, m_Height, m_Layers);
+
+		// Stessi parametri di OpenGLTexture2D, così una texture si vede uguale in entrambi i percorsi.
+		glTextureParameteri(m_RendererID, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		glTextureParameteri(m_RendererID, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+		glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	}
+
+	OpenGLTextureArray::~OpenGLTextureArray()
+	{
+		glDeleteTextures(1, &m_RendererID);
+	}
+
+	void OpenGLTextureArray::SetData(void* data, uint32_t size)
+	{
+		HZ_CORE_ASSERT(size == m_Width * m_Height * 4 * m_Layers, "Data must be entire texture!");
+		Renderer::GetStats().BufferBytesUploaded += size;
+		glTextureSubImage3D(m_RendererID, 0, 0, 0, 0, m_Width, m_Height, m_Layers, GL_RGBA, GL_UNSIGNED_BYTE, data);
+	}
+
+	void OpenGLTextureArray::SetLayerData(uint32_t layer, const void* data, uint32_t size)
+	{
+		HZ_CORE_ASSERT(layer < m_Layers, "TextureArray layer out of range!");
+		HZ_CORE_ASSERT(size == m_Width * m_Height * 4, "Data must be an entire layer!");
+		Renderer::GetStats().BufferBytesUploaded += size;
+		glTextureSubImage3D(m_RendererID, 0, 0, 0, layer, m_Width, m_Height, 1, GL_RGBA, GL_UNSIGNED_BYTE, data);
+	}
+
+	void OpenGLTextureArray::Bind(uint32_t slot) const
+	{
+		Renderer::GetStats().StateChanges++;
+		glBindTextureUnit(slot, m_RendererID);
+	}
+
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "GameEngine/Renderer/Texture.h"
+
+namespace GameEngine {
+
+	class OpenGLTexture2D : public Texture2D
+	{
+	public:
+		OpenGLTexture2D(uint32_t width, uint32_t height);
+		virtual ~OpenGLTexture2D();
+
+		virtual uint32_t GetWidth() const override { return m_Width; }
+		virtual uint32_t GetHeight() const override { return m_Height; }
+		virtual uint32_t GetRendererID() const override { return m_RendererID; }
+
+		virtual void SetData(void* data, uint32_t size) override;
+
+		virtual void Bind(uint32_t slot = 0) const override;
+
+		virtual uint64_t GetBindlessHandle() const override;
+
+	private:
+		uint32_t m_Width, m_Height;
+		uint32_t m_RendererID;
+		mutable uint64_t m_BindlessHandle = 0;
+	};
+
+	class OpenGLTextureArray : public TextureArray
+	{
+	public:
+		OpenGLTextureArray(uint32_t width, uint32_t height, uint32_t layers);
+		virtual ~OpenGLTextureArray();
+
+		virtual uint32_t GetWidth() const override { return m_Width; }
+		virtual uint32_t GetHeight() const override { return m_Height; }
+		virtual uint32_t GetLayerCount() const override { return m_Layers; }
+		virtual uint32_t GetRendererID() const override { return m_RendererID; }
+
+		virtual void SetData(void* data, uint32_t size) override;
+		virtual void SetLayerData(uint32_t layer, const void* data, uint32_t size) override;
+
+		virtual void Bind(uint32_t slot = 0) const override;
+
+	private:
+		uint32_t m_Width, m_Height, m_Layers;
+		uint32_t m_RendererID;
+	};
+
+}
@@ -0,0 +1,34 @@
+#include "hzpch.h"
+#include "OpenGLUniformBuffer.h"
+
+#include "GameEngine/Renderer/Renderer.h"
+
+#include <glad/glad.h>
+
+namespace GameEngine {
+
+	OpenGLUniformBuffer::OpenGLUniformBuffer(uint32_t size, uint32_t binding)
+	{
+		glCreateBuffers(1, &m_RendererID);
+		glNamedBufferData(m_RendererID, size, nullptr, GL_DYNAMIC_DRAW);
+		glBindBufferBase(GL_UNIFORM_BUFFER, binding, m_RendererID);
+	}
+
+	OpenGLUniformBuffer::~OpenGLUniformBuffer()
+	{
+		glDeleteBuffers(1, &m_RendererID);
+	}
+
+	void OpenGLUniformBuffer::SetData(const void* data, uint32_t size, uint32_t offset)
+	{
+		Renderer::GetStats().BufferBytesUploaded += size;
+		glNamedBufferSubData(m_RendererID, offset, size, data);
+	}
+
+	void OpenGLUniformBuffer::Bind(uint32_t binding) const
+	{
+		Renderer::GetStats().StateChanges++;
+		glBindBufferBase(GL_UNIFORM_BUFFER, binding, m_RendererID);
+	}
+
+}
@@ -1,6 +1,8 @@
 #include "hzpch.h"
 #include "OpenGLVertexArray.h"
 
+#include "GameEngine/Renderer/Renderer.h"
+
 #include <glad/glad.h>	
 
 namespace GameEngine {
@@ -9,17 +11,28 @@ namespace GameEngine {
 	{
 		switch (type)
 		{
-			case GameEngine::ShaderDataType::Float:		return GL_FLOAT;
-			case GameEngine::ShaderDataType::Float2:	return GL_FLOAT;
-			case GameEngine::ShaderDataType::Float3:	return GL_FLOAT;
-			case GameEngine::ShaderDataType::Float4:	return GL_FLOAT;
-			case GameEngine::ShaderDataType::Mat3:		return GL_FLOAT;
-			case GameEngine::ShaderDataType::Mat4:		return GL_FLOAT;
-			case GameEngine::ShaderDataType::Int:		return GL_FLOAT;
-			case GameEngine::ShaderDataType::Int2:		return GL_INT;
-			case GameEngine::ShaderDataType::Int3:		return GL_INT;
-			case GameEngine::ShaderDataType::Int4:		return GL_INT;
-			case GameEngine::ShaderDataType::Bool:		return GL_BOOL;
+			case GameEngine::ShaderDataType::Float:			return GL_FLOAT;
+			case GameEngine::ShaderDataType::Float2:		return GL_FLOAT;
+			case GameEngine::ShaderDataType::Float3:		return GL_FLOAT;
+			case GameEngine::ShaderDataType::Float4:		return GL_FLOAT;
+			case GameEngine::ShaderDataType::Mat3:			return GL_FLOAT;
+			case GameEngine::ShaderDataType::Mat4:			return GL_FLOAT;
+			case GameEngine::ShaderDataType::Int:			return GL_INT;
+			case GameEngine::ShaderDataType::Int2:			return GL_INT;
+			case GameEngine::ShaderDataType::Int3:			return GL_INT;
+			case GameEngine::ShaderDataType::Int4:			return GL_INT;
+			case GameEngine::ShaderDataType::UInt:			return GL_UNSIGNED_INT;
+			// GL_BOOL non è un tipo valido per gli attributi: un bool occupa un byte intero.
+			case GameEngine::ShaderDataType::Bool:			return GL_UNSIGNED_BYTE;
+			case GameEngine::ShaderDataType::Half:			return GL_HALF_FLOAT;
+			case GameEngine::ShaderDataType::Half2:			return GL_HALF_FLOAT;
+			case GameEngine::ShaderDataType::Half4:			return GL_HALF_FLOAT;
+			case GameEngine::ShaderDataType::UByte4:		return GL_UNSIGNED_BYTE;
+			case GameEngine::ShaderDataType::UByte4N:		return GL_UNSIGNED_BYTE;
+			case GameEngine::ShaderDataType::Short2N:		return GL_SHORT;
+			case GameEngine::ShaderDataType::UShort2N:		return GL_UNSIGNED_SHORT;
+			case GameEngine::ShaderDataType::Int1010102N:	return GL_INT_2_10_10_10_REV;
+			case GameEngine::ShaderDataType::UInt1010102N:	return GL_UNSIGNED_INT_2_10_10_10_REV;
 		}
 
 		HZ_CORE_ASSERT(false, "Unknown ShaderDataType!");
@@ -38,6 +51,7 @@ namespace GameEngine {
 
 	void OpenGLVertexArray::Bind() const
 	{
+		Renderer::GetStats().StateChanges++;
 		glBindVertexArray(m_RendererID);
 	}
 
@@ -46,27 +60,54 @@ namespace GameEngine {
 		glBindVertexArray(0);
 	}
 
-	void OpenGLVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer)
+	void OpenGLVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer, uint32_t instanceDivisor)
 	{
 		HZ_CORE_ASSERT(vertexBuffer->GetLayout().GetElements().size(), "Vertex Buffer has no layout!");
 		
 		glBindVertexArray(m_RendererID);
 		vertexBuffer->Bind();
 
-		uint32_t index = 0;
+		uint32_t& index = m_VertexAttribIndex;
 		const auto& layout = vertexBuffer->GetLayout();
 		for (const auto& element : layout)
 		{
 			glEnableVertexAttribArray(index);
-			glVertexAttribPointer(index,
-				element.GetComponentCount(),
-				ShaderDataTypeToOpenGLBaseType(element.Type),
-				element.Normalized ? GL_TRUE : GL_FALSE,
-				layout.GetStride(),
-				(const void*)element.Offset);
+			if (element.IsInteger())
+			{
+				// Gli interi arrivano allo shader senza conversione (int/ivec/uint).
+				glVertexAttribIPointer(index,
+					element.GetComponentCount(),
+					ShaderDataTypeToOpenGLBaseType(element.Type),
+					layout.GetStride(),
+					(const void*)(uintptr_t)element.Offset);
+			}
+			else
+			{
+				glVertexAttribPointer(index,
+					element.GetComponentCount(),
+					ShaderDataTypeToOpenGLBaseType(element.Type),
+					element.Normalized ? GL_TRUE : GL_FALSE,
+					layout.GetStride(),
+					(const void*)(uintptr_t)element.Offset);
+			}
+			glVertexAttribDivisor(index, instanceDivisor);
 			index++;
 		}
 		m_VertexBuffers.push_back(vertexBuffer);
+		if (instanceDivisor == 0)
+			m_PerVertexBuffers.push_back(vertexBuffer.get());
+	}
+
+	uint32_t OpenGLVertexArray::GetVertexCount() const
+	{
+		uint32_t count = UINT32_MAX;
+		for (const VertexBuffer* vertexBuffer : m_PerVertexBuffers)
+		{
+			uint32_t stride = vertexBuffer->GetLayout().GetStride();
+			if (stride)
+				count = std::min(count, vertexBuffer->GetSize() / stride);
+		}
+		return count == UINT32_MAX ? 0 : count;
 	}
 
 	void OpenGLVertexArray::SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer)
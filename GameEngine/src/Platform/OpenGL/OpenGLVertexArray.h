@@ -13,15 +13,21 @@ namespace GameEngine {
 		virtual void Bind() const override;
 		virtual void Unbind() const override;
 
-		virtual void AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer) override;
+		virtual void AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer, uint32_t instanceDivisor = 0) override;
 		virtual void SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer) override;
 
 		virtual const std::vector<Ref<VertexBuffer>>& GetVertexBuffers() const { return m_VertexBuffers; }
 		virtual const Ref<IndexBuffer>& GetIndexBuffers() const { return m_IndexBuffers; }
 
+		virtual uint32_t GetVertexCount() const override;
+
 	private:
 		uint32_t m_RendererID;
+		// Gli attributi di più vertex buffer occupano location consecutive.
+		uint32_t m_VertexAttribIndex = 0;
 		std::vector<Ref<VertexBuffer>> m_VertexBuffers;
+		// Sottoinsieme di m_VertexBuffers con instanceDivisor = 0.
+		std::vector<VertexBuffer*> m_PerVertexBuffers;
 		Ref<IndexBuffer> m_IndexBuffers;
 	};
 
@@ -51,6 +51,8 @@ namespace GameEngine {
 		// Il terzo argomento è il titolo della finestra.
 		// Il quarto è GLFWmonitor *monitor. Indica il monitor da usare se vuoi una finestra fullscreen. Con nullptr ottieni una finestra standard. 
 		// Il quinto è share. È un contesto OpenGL da condividere, se vuoi condividere risorse tra più finestre. Con nullptr, non condividi nessun contesto.
+		// In modalità headless la finestra esiste (serve per il contesto OpenGL) ma non viene mostrata.
+		glfwWindowHint(GLFW_VISIBLE, props.Headless ? GLFW_FALSE : GLFW_TRUE);
 		m_Window = glfwCreateWindow((int)props.Width, (int)props.Height, m_Data.Title.c_str(), nullptr, nullptr);
 
 		m_Context = new OpenGLContext(m_Window);
@@ -59,7 +61,8 @@ namespace GameEngine {
 		// Associa un puntatore utente alla finestra. È un modo per salvare dati personalizzati all’interno della struttura GLFWwindow.
 		glfwSetWindowUserPointer(m_Window, &m_Data);
 		
-		SetVSync(true);
+		// Senza monitor da sincronizzare il V-sync limiterebbe solo le misure dei tempi.
+		SetVSync(!props.Headless);
 
 
 		// Settiamo i callback di GLFW
@@ -88,6 +91,28 @@ namespace GameEngine {
 			data.EventCallback(event);
 		});
 
+		glfwSetWindowFocusCallback(m_Window, [](GLFWwindow* window, int focused)
+		{
+			WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
+			if (focused)
+			{
+				WindowFocusEvent event;
+				data.EventCallback(event);
+			}
+			else
+			{
+				WindowLostFocusEvent event;
+				data.EventCallback(event);
+			}
+		});
+
+		glfwSetWindowIconifyCallback(m_Window, [](GLFWwindow* window, int iconified)
+		{
+			WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
+			WindowIconifyEvent event(iconified == GLFW_TRUE);
+			data.EventCallback(event);
+		});
+
 		// key: il codice del tasto premuto (o rilasciato). Ad esempio GLFW_KEY_A, GLFW_KEY_ESCAPE, ecc.
 		// scancode: il codice di scansione del tasto (dipende dal sistema operativo / hardware). Può servire per differenziare layout di tastiera particolari.
 		// action: indica se il tasto è stato premuto (GLFW_PRESS), rilasciato (GLFW_RELEASE) o ripetuto (GLFW_REPEAT).
@@ -184,6 +209,13 @@ namespace GameEngine {
 
 	}
 
+	void WindowsWindow::WaitEvents(float timeout)
+	{
+		// Come glfwPollEvents, ma il thread dorme finché il sistema operativo non consegna un evento
+		// (o scade il timeout): niente CPU consumata in attesa.
+		glfwWaitEventsTimeout(timeout);
+	}
+
 	void WindowsWindow::SetVSync(bool enabled)
 	{
 		// glfwSwapInterval: imposta l’intervallo di swap per il contesto OpenGL corrente, 
@@ -14,6 +14,7 @@ namespace GameEngine {
 		virtual ~WindowsWindow();
 
 		void OnUpdate() override;
+		void WaitEvents(float timeout) override;
 
 		inline unsigned int GetWidth() const override { return m_Data.Width; }
 		inline unsigned int GetHeight() const override { return m_Data.Height; }
@@ -24,6 +25,7 @@ namespace GameEngine {
 		bool IsVSync() const override;
 
 		inline virtual void* GetNativeWindow() const { return m_Window; }
+		inline virtual GraphicsContext* GetContext() const override { return m_Context; }
 
 	private:
 		virtual void Init(const WindowProps& props);
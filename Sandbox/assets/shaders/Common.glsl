@@ -0,0 +1,8 @@
+// Dati della camera caricati da Renderer::BeginScene nell'uniform buffer al binding 0.
+layout(std140, binding = 0) uniform ViewData
+{
+	mat4 u_ProjectionView;
+	mat4 u_View;
+	mat4 u_Projection;
+	vec4 u_CameraPosition;
+};
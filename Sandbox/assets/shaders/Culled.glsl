@@ -0,0 +1,47 @@
+// Oggetti disegnati con CulledInstanceBatch: arrivano qui solo le istanze sopravvissute al culling sulla GPU.
+#type vertex
+#version 450 core
+
+#include "Common.glsl"
+
+layout(location = 0) in vec3 a_Position;
+
+struct InstanceRecord
+{
+	mat4 Transform;
+	vec4 BoundsMin;
+	vec4 BoundsMax;
+};
+
+layout(std430, binding = 0) readonly buffer InstanceData
+{
+	InstanceRecord u_Instances[];
+};
+
+layout(std430, binding = 1) readonly buffer VisibleInstances
+{
+	uint u_VisibleInstances[];
+};
+
+out vec4 v_Color;
+
+void main()
+{
+	mat4 transform = u_Instances[u_VisibleInstances[gl_InstanceID]].Transform;
+	// Verde con una variazione che dipende dalla posizione, per distinguere gli oggetti vicini.
+	vec2 position = transform[3].xy;
+	v_Color = vec4(0.1 + 0.1 * fract(position.x * 0.37), 0.3 + 0.2 * fract(position.y * 0.21), 0.1, 1.0);
+	gl_Position = u_ProjectionView * transform * vec4(a_Position, 1.0);
+}
+
+#type fragment
+#version 450 core
+
+layout(location = 0) out vec4 color;
+
+in vec4 v_Color;
+
+void main()
+{
+	color = v_Color;
+}
@@ -0,0 +1,64 @@
+// Shader delle forme disegnate con MultiDrawBatch: transform e materiale arrivano dagli storage buffer,
+// mentre il materiale indica quale texture della TextureLibrary usare.
+#pragma multi_compile _ BINDLESS
+
+#type vertex
+#version 450 core
+
+#include "Common.glsl"
+
+layout(location = 0) in vec3 a_Position;
+layout(location = 1) in uint a_DrawIndex;
+
+struct DrawRecord
+{
+	mat4 Transform;
+	uint MaterialIndex;
+};
+
+layout(std430, binding = 0) readonly buffer DrawData
+{
+	DrawRecord u_Draws[];
+};
+
+struct ShapeMaterial
+{
+	vec4 Color;
+	uint TextureIndex;
+};
+
+layout(std430, binding = 1) readonly buffer MaterialTable
+{
+	ShapeMaterial u_Materials[];
+};
+
+out vec4 v_Color;
+out vec2 v_TexCoord;
+flat out uint v_TextureIndex;
+
+void main()
+{
+	DrawRecord draw = u_Draws[a_DrawIndex];
+	ShapeMaterial material = u_Materials[draw.MaterialIndex];
+	v_Color = material.Color;
+	v_TextureIndex = material.TextureIndex;
+	// Le mesh delle forme stanno in [-0.5, 0.5]: la posizione locale fa da coordinata texture.
+	v_TexCoord = a_Position.xy + 0.5;
+	gl_Position = u_ProjectionView * draw.Transform * vec4(a_Position, 1.0);
+}
+
+#type fragment
+#version 450 core
+
+#include "TextureLibrary.glsl"
+
+layout(location = 0) out vec4 color;
+
+in vec4 v_Color;
+in vec2 v_TexCoord;
+flat in uint v_TextureIndex;
+
+void main()
+{
+	color = v_Color * SampleLibraryTexture(v_TextureIndex, v_TexCoord);
+}
@@ -0,0 +1,47 @@
+// Shader della scena: quadrati a tinta unita (parametro u_Color del materiale) oppure, con VERTEX_COLOR, colore per vertice.
+#pragma multi_compile _ VERTEX_COLOR
+
+#type vertex
+#version 450 core
+
+#include "Common.glsl"
+
+layout(location = 0) in vec3 a_Position;
+#ifdef VERTEX_COLOR
+layout(location = 1) in vec4 a_Color;
+
+out vec4 v_Color;
+#endif
+
+uniform mat4 u_Transform;
+
+void main()
+{
+#ifdef VERTEX_COLOR
+	v_Color = a_Color;
+#endif
+	gl_Position = u_ProjectionView * u_Transform * vec4(a_Position, 1.0);
+}
+
+#type fragment
+#version 450 core
+
+layout(location = 0) out vec4 color;
+
+#ifdef VERTEX_COLOR
+in vec4 v_Color;
+#else
+layout(std140, binding = 1) uniform MaterialData
+{
+	vec4 u_Color;
+};
+#endif
+
+void main()
+{
+#ifdef VERTEX_COLOR
+	color = v_Color;
+#else
+	color = u_Color;
+#endif
+}
@@ -0,0 +1,48 @@
+// Texture di una TextureLibrary, lette con l'indice scritto nei dati della draw.
+// Va incluso subito dopo #version (l'#extension deve precedere il resto del codice) da uno shader che dichiara
+// "#pragma multi_compile _ BINDLESS" e usa la variante BINDLESS quando TextureLibrary::IsBindless() restituisce true.
+#ifdef BINDLESS
+#extension GL_ARB_bindless_texture : require
+#endif
+
+struct TextureEntry
+{
+	uvec2 Handle;
+	uint Array;
+	uint Layer;
+};
+
+layout(std430, binding = 3) readonly buffer TextureTable
+{
+	TextureEntry u_TextureTable[];
+};
+
+#ifdef BINDLESS
+vec4 SampleLibraryTexture(uint index, vec2 uv)
+{
+	return texture(sampler2D(u_TextureTable[index].Handle), uv);
+}
+#else
+// Un array per dimensione di texture, collegati da TextureLibrary::Bind alle texture unit 0 .. MaxArrays - 1.
+layout(binding = 0) uniform sampler2DArray u_TextureArrays[8];
+
+// L'indice di un array di sampler deve essere dinamicamente uniforme, mentre entry.Array cambia da una draw
+// all'altra dentro la stessa multi-draw: ogni caso usa un indice costante. All'interno di una primitiva
+// l'indice non cambia, quindi le derivate per il mipmapping restano valide.
+vec4 SampleLibraryTexture(uint index, vec2 uv)
+{
+	TextureEntry entry = u_TextureTable[index];
+	vec3 coords = vec3(uv, float(entry.Layer));
+	switch (entry.Array)
+	{
+		case 0u: return texture(u_TextureArrays[0], coords);
+		case 1u: return texture(u_TextureArrays[1], coords);
+		case 2u: return texture(u_TextureArrays[2], coords);
+		case 3u: return texture(u_TextureArrays[3], coords);
+		case 4u: return texture(u_TextureArrays[4], coords);
+		case 5u: return texture(u_TextureArrays[5], coords);
+		case 6u: return texture(u_TextureArrays[6], coords);
+		default: return texture(u_TextureArrays[7], coords);
+	}
+}
+#endif
@@ -1,7 +1,5 @@
 #include <GameEngine.h>
 
-#include "Platform/OpenGL/OpenGLShader.h"
-
 #include "imgui/imgui.h"
 
 #include <glm/gtc/matrix_transform.hpp>
@@ -11,8 +9,47 @@ class ExampleLayer : public GameEngine::Layer
 {
 public:
 	ExampleLayer()
-		: Layer("Example"), m_Camera(-1.6f, 1.6f, -0.9f, 0.9f), m_CameraPosition(0.0f)
+		: Layer("Example"), m_Camera(-1.6f, 1.6f, -0.9f, 0.9f), m_MinimapCamera(-6.4f, 6.4f, -3.6f, 3.6f), m_CameraPosition(0.0f), m_Particles(200000),
+		  m_DynamicResolution(GameEngine::Application::Get().GetWindow().GetWidth(), GameEngine::Application::Get().GetWindow().GetHeight())
 	{
+		// Nel repository non ci sono font: usiamo uno di quelli installati con il sistema.
+#ifdef HZ_PLATFORM_WINDOWS
+		m_Font = std::make_shared<GameEngine::Font>("C:/Windows/Fonts/arial.ttf");
+#else
+		m_Font = std::make_shared<GameEngine::Font>("/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf");
+#endif
+		m_Font->Preload("0123456789(), ");
+		for (int y = 0; y < 20; y++)
+			for (int x = 0; x < 20; x++)
+				m_Labels.push_back("(" + std::to_string(x) + ", " + std::to_string(y) + ")");
+
+		// Terreno di 1024x1024 tile sotto la scena. Il tileset viene generato qui: 4x4 tile di 16 pixel a tinta unita.
+		GameEngine::Tileset tileset;
+		tileset.Texture.reset(GameEngine::Texture2D::Create(64, 64));
+		tileset.Columns = 4;
+		tileset.Rows = 4;
+		std::vector<uint32_t> tilesetPixels(64 * 64);
+		for (uint32_t y = 0; y < 64; y++)
+		{
+			for (uint32_t x = 0; x < 64; x++)
+			{
+				uint32_t tile = (y / 16) * 4 + x / 16;
+				uint32_t shade = 40 + tile * 6 + ((x % 16 == 0 || y % 16 == 0) ? 0 : 10);
+				tilesetPixels[y * 64 + x] = 0xff000000 | (shade / 2 << 16) | (shade << 8) | (shade / 2);
+			}
+		}
+		tileset.Texture->SetData(tilesetPixels.data(), (uint32_t)(tilesetPixels.size() * sizeof(uint32_t)));
+
+		GameEngine::TilemapSpecification tilemapSpec;
+		tilemapSpec.Width = 1024;
+		tilemapSpec.Height = 1024;
+		tilemapSpec.TileSize = 0.1f;
+		tilemapSpec.Origin = { -51.2f, -51.2f };
+		m_Tilemap = std::make_shared<GameEngine::Tilemap>(tilemapSpec, tileset);
+		for (uint32_t y = 0; y < tilemapSpec.Height; y++)
+			for (uint32_t x = 0; x < tilemapSpec.Width; x++)
+				m_Tilemap->SetTile(x, y, (uint16_t)(1 + (x * 7 + y * 13 + (x / 8) * (y / 8)) % 16));
+
 		#pragma region Disegna un triangolo 
 		m_VertexArray.reset(GameEngine::VertexArray::Create());
 
@@ -60,80 +97,232 @@ public:
 		squareIB.reset(GameEngine::IndexBuffer::Create(squareIndices, sizeof(squareIndices) / sizeof(uint32_t)));
 		m_SquareVA->SetIndexBuffer(squareIB);
 
-		// Vertex Shader
-		std::string vertexSrc = R"(
-			#version 330 core
-
-			layout(location = 0) in vec3 a_Position;
-			layout(location = 1) in vec4 a_Color;
-
-			uniform mat4 u_ProjectionView;
-			uniform mat4 u_Transform;
-
-			out vec3 v_Position;
-			out vec4 v_Color;
-
-			void main()
+		// I due shader sono varianti dello stesso file, ognuna compilata alla prima richiesta.
+		m_SceneShaderHandle = GameEngine::AssetManager::LoadShaderFile("assets/shaders/Scene.glsl");
+		auto sceneShader = GameEngine::AssetManager::Get<GameEngine::ShaderFile>(m_SceneShaderHandle);
+		HZ_ASSERT(sceneShader, "Could not load assets/shaders/Scene.glsl");
+		m_TriangleMaterial = std::make_shared<GameEngine::MaterialInstance>(std::make_shared<GameEngine::Material>(sceneShader->GetVariant({ "VERTEX_COLOR" })));
+
+		// Due istanze dello stesso materiale: i quadrati alternano i colori, ma il Renderer le raggruppa
+		// e collega ogni blocco di parametri una volta sola.
+		auto flatColorMaterial = std::make_shared<GameEngine::Material>(sceneShader->GetVariant(), std::vector<GameEngine::MaterialParameter>{
+			{ GameEngine::ShaderDataType::Float4, "u_Color" }
+		});
+		m_SquareMaterials[0] = std::make_shared<GameEngine::MaterialInstance>(flatColorMaterial);
+		m_SquareMaterials[1] = std::make_shared<GameEngine::MaterialInstance>(flatColorMaterial);
+
+		// 24 texture a scacchi di due dimensioni diverse: senza bindless finiscono in due texture array.
+		m_ShapeTextures = std::make_shared<GameEngine::TextureLibrary>();
+		uint32_t shapeTextures[24];
+		for (uint32_t i = 0; i < 24; i++)
+		{
+			uint32_t size = i < 12 ? 16 : 32;
+			uint32_t cell = 2 + i % 4;
+			uint32_t light = 0xFFFFFFFF, dark = 0xFF000000 | ((i * 40) % 256) << 8 | ((i * 90) % 256);
+			std::vector<uint32_t> pixels(size * size);
+			for (uint32_t y = 0; y < size; y++)
 			{
-				v_Position = a_Position;
-				v_Color = a_Color;
-				gl_Position = u_ProjectionView * u_Transform * vec4(a_Position, 1.0);
+				for (uint32_t x = 0; x < size; x++)
+					pixels[y * size + x] = ((x / cell + y / cell) % 2) ? light : dark;
 			}
-		)";
-
-		// Fragment Shader
-		std::string fragmentSrc = R"(
-			#version 330 core
+			shapeTextures[i] = m_ShapeTextures->Add(size, size, pixels.data());
+		}
 
-			layout(location = 0) out vec4 color;
+		// 4096 forme di tre mesh diverse a sinistra della griglia: tutte insieme sono una sola draw call indiretta,
+		// anche se usano 24 texture diverse.
+		m_IndirectShaderHandle = GameEngine::AssetManager::LoadShaderFile("assets/shaders/Indirect.glsl");
+		auto indirectShader = GameEngine::AssetManager::Get<GameEngine::ShaderFile>(m_IndirectShaderHandle);
+		HZ_ASSERT(indirectShader, "Could not load assets/shaders/Indirect.glsl");
+		std::vector<std::string> indirectKeywords;
+		if (m_ShapeTextures->IsBindless())
+			indirectKeywords.push_back("BINDLESS");
+		m_Shapes = std::make_shared<GameEngine::MultiDrawBatch>(indirectShader->GetVariant(indirectKeywords), GameEngine::BufferLayout{
+			{ GameEngine::ShaderDataType::Float3, "a_Position" }
+		});
+
+		float triangle[3 * 3] = { -0.5f, -0.43f, 0.0f, 0.5f, -0.43f, 0.0f, 0.0f, 0.43f, 0.0f };
+		uint32_t triangleIndices[3] = { 0, 1, 2 };
+		m_Shapes->AddMesh(triangle, 3, triangleIndices, 3);
+		float quad[4 * 3] = { -0.5f, -0.5f, 0.0f, 0.5f, -0.5f, 0.0f, 0.5f, 0.5f, 0.0f, -0.5f, 0.5f, 0.0f };
+		m_Shapes->AddMesh(quad, 4, squareIndices, 6);
+
+		float hexagon[7 * 3] = { 0.0f, 0.0f, 0.0f };
+		uint32_t hexagonIndices[6 * 3];
+		for (uint32_t i = 0; i < 6; i++)
+		{
+			hexagon[(i + 1) * 3 + 0] = 0.5f * cosf(glm::radians(60.0f * i));
+			hexagon[(i + 1) * 3 + 1] = 0.5f * sinf(glm::radians(60.0f * i));
+			hexagon[(i + 1) * 3 + 2] = 0.0f;
+			hexagonIndices[i * 3 + 0] = 0;
+			hexagonIndices[i * 3 + 1] = i + 1;
+			hexagonIndices[i * 3 + 2] = (i + 1) % 6 + 1;
+		}
+		m_Shapes->AddMesh(hexagon, 7, hexagonIndices, 6 * 3);
 
-			in vec3 v_Position;
-			in vec4 v_Color;
+		// Stesso layout di ShapeMaterial in Indirect.glsl (std430: struct arrotondata a 16 byte).
+		struct ShapeMaterial
+		{
+			glm::vec4 Color;
+			uint32_t TextureIndex;
+			uint32_t Padding[3];
+		};
+		glm::vec4 shapeColors[4] = { { 0.9f, 0.4f, 0.3f, 1.0f }, { 0.3f, 0.8f, 0.4f, 1.0f }, { 0.9f, 0.8f, 0.3f, 1.0f }, { 0.6f, 0.4f, 0.9f, 1.0f } };
+		ShapeMaterial shapeMaterials[24];
+		for (uint32_t i = 0; i < 24; i++)
+			shapeMaterials[i] = { shapeColors[i % 4], shapeTextures[i] };
+		m_Shapes->SetMaterialTable(shapeMaterials, sizeof(shapeMaterials));
 
-			void main()
+		for (uint32_t y = 0; y < 64; y++)
+		{
+			for (uint32_t x = 0; x < 64; x++)
 			{
-				color = vec4(v_Position * 0.5 + 0.5, 1.0);
-				color = v_Color;
+				glm::vec3 position(-7.0f + x * 0.08f, -2.4f + y * 0.08f, 0.0f);
+				glm::mat4 transform = glm::translate(glm::mat4(1.0f), position)
+					* glm::rotate(glm::mat4(1.0f), glm::radians((float)((x * 37 + y * 11) % 360)), glm::vec3(0, 0, 1))
+					* glm::scale(glm::mat4(1.0f), glm::vec3(0.06f));
+				m_ShapeTransforms.push_back(transform);
 			}
-		)";
+		}
 
-		m_Shader.reset(GameEngine::Shader::Create(vertexSrc, fragmentSrc));
+		// 512x512 cespugli sparsi sul terreno: il culling sulla GPU lascia disegnare solo quelli inquadrati.
+		m_CulledShaderHandle = GameEngine::AssetManager::LoadShaderFile("assets/shaders/Culled.glsl");
+		auto culledShader = GameEngine::AssetManager::Get<GameEngine::ShaderFile>(m_CulledShaderHandle);
+		HZ_ASSERT(culledShader, "Could not load assets/shaders/Culled.glsl");
+		m_Bushes = std::make_shared<GameEngine::CulledInstanceBatch>(culledShader->GetVariant(), m_SquareVA);
+
+		std::vector<glm::mat4> bushTransforms;
+		std::vector<GameEngine::BoundingBox> bushBounds;
+		bushTransforms.reserve(512 * 512);
+		bushBounds.reserve(512 * 512);
+		for (uint32_t y = 0; y < 512; y++)
+		{
+			for (uint32_t x = 0; x < 512; x++)
+			{
+				glm::vec3 position(-51.2f + x * 0.2f + (float)((x * 13 + y * 7) % 10) * 0.01f, -51.2f + y * 0.2f + (float)((x * 3 + y * 17) % 10) * 0.01f, 0.0f);
+				float size = 0.03f + (float)((x * 5 + y * 11) % 4) * 0.005f;
+				bushTransforms.push_back(glm::translate(glm::mat4(1.0f), position) * glm::scale(glm::mat4(1.0f), glm::vec3(size)));
+				// m_SquareVA va da -0.75 a 0.75.
+				glm::vec3 extents(0.75f * size, 0.75f * size, 0.0f);
+				bushBounds.push_back({ position - extents, position + extents });
+			}
+		}
+		m_Bushes->SetInstances(bushTransforms.data(), bushBounds.data(), (uint32_t)bushTransforms.size());
+		#pragma endregion
 
-		std::string flatColorShaderVertexSrc = R"(
-			#version 330 core
+		m_Particles.SetGravity({ 0.0f, -1.0f });
+		m_ParticleProps.Velocity = { 0.0f, 1.0f };
+		m_ParticleProps.VelocityVariation = { 2.0f, 1.0f };
+		m_ParticleProps.ColorBegin = { 1.0f, 0.6f, 0.1f, 1.0f };
+		m_ParticleProps.ColorEnd = { 0.8f, 0.1f, 0.1f, 0.0f };
+		m_ParticleProps.SizeBegin = 0.03f;
+		m_ParticleProps.SizeEnd = 0.005f;
+		m_ParticleProps.SizeVariation = 0.5f;
+		m_ParticleProps.LifeTime = 2.0f;
+
+		StreamTexture();
+		StartCoroutine(PulseSquares());
+	}
 
-			layout(location = 0) in vec3 a_Position;
+	~ExampleLayer()
+	{
+		GameEngine::AssetManager::Release(m_SceneShaderHandle);
+		GameEngine::AssetManager::Release(m_IndirectShaderHandle);
+		GameEngine::AssetManager::Release(m_CulledShaderHandle);
+	}
 
-			uniform mat4 u_ProjectionView;
-			uniform mat4 u_Transform;
+	// La texture viene generata e caricata sul thread del ResourceLoader: anche un'immagine grande non blocca il frame.
+	// Arriva in m_StreamedSprite solo quando la GPU ha terminato l'upload.
+	void StreamTexture()
+	{
+		uint32_t seed = ++m_StreamedTextureCount;
+		auto texture = std::make_shared<GameEngine::Ref<GameEngine::Texture2D>>();
+		GameEngine::ResourceLoader::Enqueue([texture, seed]()
+			{
+				const uint32_t size = 1024;
+				std::vector<uint32_t> pixels(size * size);
+				for (uint32_t y = 0; y < size; y++)
+				{
+					for (uint32_t x = 0; x < size; x++)
+					{
+						uint32_t r = ((x ^ y) * seed) & 0xff, g = (x / 4 * seed) & 0xff, b = (y / 4) & 0xff;
+						pixels[y * size + x] = 0xff000000 | (b << 16) | (g << 8) | r;
+					}
+				}
+				texture->reset(GameEngine::Texture2D::Create(size, size));
+				(*texture)->SetData(pixels.data(), (uint32_t)(pixels.size() * sizeof(uint32_t)));
+			},
+			[this, texture]()
+			{
+				m_StreamedSprite.Texture = *texture;
+				m_StreamedSprite.Width = m_StreamedSprite.Height = 1024;
+			});
+	}
 
-			out vec3 v_Position;
+	// Il conteggio gira su un worker del JobSystem; il risultato torna al layer attraverso la coda del thread principale,
+	// quindi m_PrimeCount viene scritto solo dal thread che lo legge.
+	void CountPrimes(uint32_t limit)
+	{
+		m_PrimeJobRunning = true;
+		GameEngine::JobSystem::Execute([this, limit]()
+			{
+				std::vector<bool> composite(limit + 1, false);
+				uint32_t count = 0;
+				for (uint32_t i = 2; i <= limit; i++)
+				{
+					if (composite[i])
+						continue;
+					count++;
+					for (uint64_t j = (uint64_t)i * i; j <= limit; j += i)
+						composite[j] = true;
+				}
+
+				GameEngine::Application::Get().Post([this, count]()
+					{
+						m_PrimeCount = count;
+						m_PrimeJobRunning = false;
+					});
+			});
+	}
 
-			void main()
+	// Ogni due secondi i quadrati si schiariscono e tornano al colore scelto: un'animazione in più frame
+	// scritta come codice sequenziale invece che come macchina a stati in OnUpdate.
+	GameEngine::Coroutine PulseSquares()
+	{
+		while (true)
+		{
+			float start = GameEngine::Application::GetTime();
+			float t;
+			while ((t = GameEngine::Application::GetTime() - start) < 1.0f)
 			{
-				v_Position = a_Position;
-				gl_Position = u_ProjectionView * u_Transform * vec4(a_Position, 1.0);
+				m_SquarePulse = 0.5f - 0.5f * std::cos(t * glm::radians(360.0f));
+				co_await GameEngine::NextFrame();
 			}
-		)";
-
-		// Fragment Shader
-		std::string flatColorShaderFragmentSrc = R"(
-			#version 330 core
-
-			layout(location = 0) out vec4 color;
+			m_SquarePulse = 0.0f;
+			co_await GameEngine::Seconds(2.0f);
+		}
+	}
 
-			in vec3 v_Position;
-			
-			uniform vec3 u_Color;
+	// I file vengono letti da un worker e le righe contate da un altro job: il frame continua mentre la coroutine aspetta.
+	GameEngine::Coroutine InspectShaderSources()
+	{
+		m_ShaderSourceInfo = "loading...";
+		const char* paths[] = { "assets/shaders/Common.glsl", "assets/shaders/Scene.glsl", "assets/shaders/Indirect.glsl", "assets/shaders/Culled.glsl" };
 
-			void main()
-			{
-				color = vec4(u_Color, 1.0);
-			}
-		)";
+		uint64_t bytes = 0;
+		uint32_t lines = 0;
+		for (const char* path : paths)
+		{
+			GameEngine::AssetHandle handle = co_await GameEngine::LoadAsset(path);
+			GameEngine::Ref<std::vector<uint8_t>> contents = GameEngine::AssetManager::Get<std::vector<uint8_t>>(handle);
+			if (!contents)
+				continue;
+
+			lines += co_await GameEngine::RunOnWorker([contents]() { return (uint32_t)std::count(contents->begin(), contents->end(), '\n'); });
+			bytes += contents->size();
+			GameEngine::AssetManager::Release(handle);
+		}
 
-		m_FlatColorShader.reset(GameEngine::Shader::Create(flatColorShaderVertexSrc, flatColorShaderFragmentSrc));
-		#pragma endregion
+		m_ShaderSourceInfo = std::to_string(lines) + " lines, " + std::to_string(bytes) + " bytes";
 	}
 
 	void OnUpdate(GameEngine::Timestep ts) override
@@ -153,18 +342,53 @@ public:
 		if (GameEngine::Input::IsKeyPressed(HZ_KEY_D))
 			m_CameraRotation -= m_CameraRotationSpeed * ts;
 
+		// Le matrici vengono ricalcolate una sola volta, alla prima lettura in BeginScene.
+		m_Camera.SetPosition(m_CameraPosition);
+		m_Camera.SetRotation(m_CameraRotation);
+		m_MinimapCamera.SetPosition(m_CameraPosition);
+
+		// Tenendo premuto SPAZIO la camera emette particelle.
+		if (GameEngine::Input::IsKeyPressed(HZ_KEY_SPACE))
+		{
+			m_ParticleProps.Position = { m_CameraPosition.x, m_CameraPosition.y };
+			m_Particles.Emit(m_ParticleProps, m_ParticlesPerFrame);
+		}
+		m_Particles.OnUpdate(ts);
+
+		// La scena viene disegnata alla risoluzione scelta da DynamicResolution e poi scalata fino alla finestra.
+		m_DynamicResolution.Begin();
 		GameEngine::RenderCommand::SetClearColor({ 0.1f, 0.1f, 0.1f, 1 });
 		GameEngine::RenderCommand::Clear();
 
-		m_Camera.SetPosition(m_CameraPosition);
-		m_Camera.SetRotation(m_CameraRotation);
+		DrawScene(m_Camera);
+		// Le statistiche della tilemap si riferiscono all'ultimo Render: teniamo quelle della vista principale.
+		m_TilemapStats = m_Tilemap->GetStats();
+
+		// Seconda vista nello stesso frame: la minimappa nell'angolo in alto a destra.
+		uint32_t width = m_DynamicResolution.GetRenderWidth(), height = m_DynamicResolution.GetRenderHeight();
+		GameEngine::RenderCommand::SetViewport(width - width / 4, height - height / 4, width / 4, height / 4);
+		DrawScene(m_MinimapCamera);
+
+		m_DynamicResolution.End();
+	}
+
+	void DrawScene(const GameEngine::Camera& camera)
+	{
+		// Solo i chunk vicini alla camera hanno un vertex buffer: una draw call per chunk visibile.
+		if (m_ShowTilemap)
+			m_Tilemap->Render(camera);
 
-		GameEngine::Renderer::BeginScene(m_Camera);
+		GameEngine::Renderer::BeginScene(camera);
+
+		// Culling e draw senza passare dalla CPU: disegnati prima della scena, restano sotto ai quadrati.
+		if (m_ShowBushes)
+			m_Bushes->Draw();
 
 		glm::mat4 scale = glm::scale(glm::mat4(1.0f), glm::vec3(0.1f));
 
-		std::dynamic_pointer_cast<GameEngine::OpenGLShader>(m_FlatColorShader)->Bind();
-		std::dynamic_pointer_cast<GameEngine::OpenGLShader>(m_FlatColorShader)->UploadUniformFloat3("u_Color", m_SquareColor);
+		// Il blocco viene caricato sulla GPU solo quando il colore cambia.
+		m_SquareMaterials[0]->SetFloat4("u_Color", glm::vec4(glm::mix(m_SquareColors[0], glm::vec3(1.0f), m_SquarePulse * 0.5f), 1.0f));
+		m_SquareMaterials[1]->SetFloat4("u_Color", glm::vec4(glm::mix(m_SquareColors[1], glm::vec3(1.0f), m_SquarePulse * 0.5f), 1.0f));
 
 		for (int y = 0; y < 20; y++)
 		{
@@ -173,40 +397,147 @@ public:
 				glm::vec3 pos(x * 0.11f, y * 0.11f, 0.0f);
 				glm::mat4 transform = glm::translate(glm::mat4(1.0f), pos) * scale;
 				
-				GameEngine::Renderer::Submit(m_FlatColorShader, m_SquareVA, transform);
+				GameEngine::Renderer::Submit(m_SquareMaterials[(x + y) % 2], m_SquareVA, transform);
 			}
 		}
 
-		GameEngine::Renderer::Submit(m_Shader, m_VertexArray);
+		GameEngine::Renderer::Submit(m_TriangleMaterial, m_VertexArray);
 
 		GameEngine::Renderer::EndScene();
+
+		if (m_ShowShapes)
+		{
+			m_ShapeTextures->Bind();
+			m_Shapes->Begin();
+			for (uint32_t i = 0; i < (uint32_t)m_ShapeTransforms.size(); i++)
+				m_Shapes->Submit(i % 3, m_ShapeTransforms[i], (i / 3) % 24);
+			m_Shapes->End();
+		}
+
+		GameEngine::Renderer2D::BeginScene(camera);
+		GameEngine::Renderer2D::DrawParticles(m_Particles);
+		if (m_StreamedSprite.Texture)
+			GameEngine::Renderer2D::DrawSprite({ -0.8f, 0.5f }, { 1.0f, 1.0f }, m_StreamedSprite);
+
+		// Un'etichetta per quadrato: le stringhe non cambiano, quindi vengono impaginate una volta sola
+		// e tutte insieme richiedono una sola draw call.
+		if (m_ShowLabels && m_Font->IsLoaded())
+		{
+			for (int y = 0; y < 20; y++)
+			{
+				for (int x = 0; x < 20; x++)
+				{
+					GameEngine::Renderer2D::DrawString(m_Labels[y * 20 + x], m_Font, { x * 0.11f - 0.045f, y * 0.11f - 0.01f, 0.1f }, 0.025f);
+				}
+			}
+		}
+		GameEngine::Renderer2D::EndScene();
 	}
 
 	virtual void OnImGuiRender() override
 	{
 		ImGui::Begin("Settings");
-		ImGui::ColorEdit3("Square Color", glm::value_ptr(m_SquareColor));
+		ImGui::ColorEdit3("Square Color", glm::value_ptr(m_SquareColors[0]));
+		ImGui::ColorEdit3("Alternate Square Color", glm::value_ptr(m_SquareColors[1]));
+		ImGui::SliderInt("Particles per frame", &m_ParticlesPerFrame, 1, 5000);
+		ImGui::Text("Alive particles: %u", m_Particles.GetAliveCount());
+		ImGui::Checkbox("Text labels", &m_ShowLabels);
+		ImGui::Text("Glyphs: %u, cached strings: %u", m_Font->GetGlyphCount(), m_Font->GetCachedLayoutCount());
+
+		ImGui::Checkbox("Tilemap", &m_ShowTilemap);
+		ImGui::Checkbox("Indirect shapes", &m_ShowShapes);
+		ImGui::Checkbox("GPU culled bushes", &m_ShowBushes);
+		ImGui::Text("Indirect: %u draws in %u commands", m_Shapes->GetStats().Draws, m_Shapes->GetStats().Commands);
+		ImGui::Text("Shape textures: %u (%s)", m_ShapeTextures->GetTextureCount(), m_ShapeTextures->IsBindless() ? "bindless" : "texture arrays");
+		if (ImGui::Button("Stream texture"))
+			StreamTexture();
+		ImGui::SameLine();
+		ImGui::Text("%u pending (%s)", GameEngine::ResourceLoader::GetPendingCount(), GameEngine::ResourceLoader::IsAsync() ? "background thread" : "synchronous");
+		if (ImGui::Button("Count primes below 50M") && !m_PrimeJobRunning)
+			CountPrimes(50000000);
+		ImGui::SameLine();
+		if (m_PrimeJobRunning)
+			ImGui::Text("running on a worker...");
+		else
+			ImGui::Text("%u", m_PrimeCount);
+		if (ImGui::Button("Inspect shader sources"))
+			StartCoroutine(InspectShaderSources());
+		ImGui::SameLine();
+		ImGui::Text("%s", m_ShaderSourceInfo.c_str());
+		ImGui::Text("Chunks: %u visible, %u resident (%.1f MB)", m_TilemapStats.VisibleChunks, m_TilemapStats.ResidentChunks, m_TilemapStats.MemoryUsage / (1024.0f * 1024.0f));
+
+		GameEngine::Application::IdleSettings& idle = GameEngine::Application::Get().GetIdleSettings();
+		ImGui::Checkbox("Pause when minimized", &idle.PauseWhenMinimized);
+		ImGui::SliderFloat("Unfocused FPS (0 = unlimited)", &idle.UnfocusedFrameRate, 0.0f, 60.0f, "%.0f");
+
+		bool dynamicResolution = m_DynamicResolution.IsEnabled();
+		if (ImGui::Checkbox("Dynamic resolution", &dynamicResolution))
+			m_DynamicResolution.SetEnabled(dynamicResolution);
+		ImGui::SliderFloat("Target GPU time (ms)", &m_DynamicResolution.GetSettings().TargetFrameTime, 1.0f, 33.3f);
+		ImGui::Text("Scene GPU time: %.2f ms", m_DynamicResolution.GetGPUTime());
+		ImGui::Text("Render resolution: %ux%u (%.0f%%)", m_DynamicResolution.GetRenderWidth(), m_DynamicResolution.GetRenderHeight(), m_DynamicResolution.GetScale() * 100.0f);
 		ImGui::End();
 	}
 
 	void OnEvent(GameEngine::Event& event) override
 	{
+		GameEngine::EventDispatcher dispatcher(event);
+		dispatcher.Dispatch<GameEngine::WindowResizeEvent>(HZ_BIND_EVENT_FN(ExampleLayer::OnWindowResize));
+	}
 
+	bool OnWindowResize(GameEngine::WindowResizeEvent& e)
+	{
+		m_DynamicResolution.Resize(e.GetWidth(), e.GetHeight());
+		return false;
 	}
 
 private:
-	GameEngine::Ref<GameEngine::Shader> m_Shader;
+	GameEngine::AssetHandle m_SceneShaderHandle;
+	GameEngine::AssetHandle m_IndirectShaderHandle;
+	GameEngine::AssetHandle m_CulledShaderHandle;
+
+	GameEngine::Ref<GameEngine::MaterialInstance> m_TriangleMaterial;
 	GameEngine::Ref<GameEngine::VertexArray> m_VertexArray;
-	GameEngine::Ref<GameEngine::Shader> m_FlatColorShader;
+	GameEngine::Ref<GameEngine::MaterialInstance> m_SquareMaterials[2];
 	GameEngine::Ref<GameEngine::VertexArray> m_SquareVA;
 
 	GameEngine::OrthographicCamera m_Camera;
+	GameEngine::OrthographicCamera m_MinimapCamera;
 	glm::vec3 m_CameraPosition;
 	float m_CameraMoveSpeed = 5.0f;
 	float m_CameraRotation = 0.0f;
 	float m_CameraRotationSpeed = 180.0f;
 
-	glm::vec3 m_SquareColor = { 0.2f, 0.3f, 0.8f };
+	glm::vec3 m_SquareColors[2] = { { 0.2f, 0.3f, 0.8f }, { 0.3f, 0.2f, 0.7f } };
+	float m_SquarePulse = 0.0f;
+	std::string m_ShaderSourceInfo;
+
+	GameEngine::ParticleEmitter m_Particles;
+	GameEngine::ParticleProps m_ParticleProps;
+	int m_ParticlesPerFrame = 500;
+
+	GameEngine::DynamicResolution m_DynamicResolution;
+
+	GameEngine::Ref<GameEngine::Font> m_Font;
+	std::vector<std::string> m_Labels;
+	bool m_ShowLabels = true;
+
+	GameEngine::Ref<GameEngine::Tilemap> m_Tilemap;
+	GameEngine::Tilemap::Statistics m_TilemapStats;
+
+	GameEngine::Ref<GameEngine::MultiDrawBatch> m_Shapes;
+	GameEngine::Ref<GameEngine::TextureLibrary> m_ShapeTextures;
+	std::vector<glm::mat4> m_ShapeTransforms;
+	bool m_ShowShapes = true;
+	GameEngine::Ref<GameEngine::CulledInstanceBatch> m_Bushes;
+	bool m_ShowBushes = true;
+	bool m_ShowTilemap = true;
+
+	GameEngine::SpriteRegion m_StreamedSprite;
+	uint32_t m_StreamedTextureCount = 0;
+
+	bool m_PrimeJobRunning = false;
+	uint32_t m_PrimeCount = 0;
 };
 
 class Sandbox : public GameEngine::Application
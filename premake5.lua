@@ -28,7 +28,7 @@ project "GameEngine"
     location "GameEngine"
     kind "StaticLib"
     language "C++"
-    cppdialect "C++17"
+    cppdialect "C++20"
     staticruntime "on"
 
     targetdir ("bin/" .. outputdir .. "/%{prj.name}")
@@ -64,9 +64,7 @@ project "GameEngine"
     {
         "GLFW",
         "Glad",
-        "ImGui",
-        "opengl32.lib",
-        "dwmapi.lib"
+        "ImGui"
     }
 
     -- I filtri sono utili per configurazioni che si applicano a una specifica piattaforma
@@ -80,6 +78,26 @@ project "GameEngine"
             "GLFW_INCLUDE_NONE"
         }
 
+        links
+        {
+            "opengl32.lib",
+            "dwmapi.lib"
+        }
+
+        removefiles { "%{prj.name}/src/Platform/Linux/**" }
+
+    -- Linux: finestra GLFW (X11/Wayland) oppure contesto EGL headless (--headless)
+    filter "system:linux"
+        pic "On"
+
+        defines
+        {
+            "HZ_PLATFORM_LINUX",
+            "GLFW_INCLUDE_NONE"
+        }
+
+        removefiles { "%{prj.name}/src/Platform/Windows/**" }
+
     filter "configurations:Debug"
         defines "HZ_DEBUG"
         runtime "Debug"
@@ -104,7 +122,83 @@ project "Sandbox"
     location "Sandbox"
     kind "ConsoleApp"
     language "C++"
-    cppdialect "C++17"
+    cppdialect "C++20"
+    staticruntime "on"
+
+    targetdir ("bin/" .. outputdir .. "/%{prj.name}")
+    objdir ("bin-int/" .. outputdir .. "/%{prj.name}")
+
+    files
+    {
+        "%{prj.name}/src/**.h",
+        "%{prj.name}/src/**.cpp"
+    }
+
+    includedirs
+    {
+        "GameEngine/vendor/spdlog/include",
+        "GameEngine/src",
+        "GameEngine/vendor",
+        "%{IncludeDir.glm}"
+    }
+
+    links
+    {
+        "GameEngine"
+    }
+
+    filter "system:windows"
+        systemversion "latest"
+
+        defines 
+        {
+            "HZ_PLATFORM_WINDOWS"
+        }
+
+    -- Con gmake le dipendenze di una libreria statica vanno ripetute nell'eseguibile, in ordine.
+    filter "system:linux"
+        defines
+        {
+            "HZ_PLATFORM_LINUX"
+        }
+
+        links
+        {
+            "GLFW",
+            "Glad",
+            "ImGui",
+            "GL",
+            "EGL",
+            "X11",
+            "dl",
+            "pthread"
+        }
+
+    filter "configurations:Debug"
+        defines "HZ_DEBUG"
+        runtime "Debug"
+        symbols "on"
+    
+    filter "configurations:Release"
+        defines "HZ_RELEASE"
+        runtime "Release"
+        optimize "on"
+
+    filter "configurations:Dist"
+        defines "HZ_DIST"
+        runtime "Release"
+        optimize "on"
+
+    filter "action:vs2022"
+        buildoptions { "/utf-8" }
+
+
+
+project "Benchmarks"
+    location "Benchmarks"
+    kind "ConsoleApp"
+    language "C++"
+    cppdialect "C++20"
     staticruntime "on"
 
     targetdir ("bin/" .. outputdir .. "/%{prj.name}")
@@ -121,6 +215,8 @@ project "Sandbox"
         "GameEngine/vendor/spdlog/include",
         "GameEngine/src",
         "GameEngine/vendor",
+        "%{IncludeDir.GLFW}",
+        "%{IncludeDir.Glad}",
         "%{IncludeDir.glm}"
     }
 
@@ -137,6 +233,25 @@ project "Sandbox"
             "HZ_PLATFORM_WINDOWS"
         }
 
+    -- Con gmake le dipendenze di una libreria statica vanno ripetute nell'eseguibile, in ordine.
+    filter "system:linux"
+        defines
+        {
+            "HZ_PLATFORM_LINUX"
+        }
+
+        links
+        {
+            "GLFW",
+            "Glad",
+            "ImGui",
+            "GL",
+            "EGL",
+            "X11",
+            "dl",
+            "pthread"
+        }
+
     filter "configurations:Debug"
         defines "HZ_DEBUG"
         runtime "Debug"